@@ -3,7 +3,9 @@
 #include <kos.h>
 #include <kos/thread.h>
 
+#include <arena.h>
 #include <backend/gd_item.h>
+#include <dbgprint.h>
 #include <openmenu_settings.h>
 #include "backend/cb_loader.h"
 #include "backend/controls.p1.h"
@@ -80,6 +82,8 @@ bloom_launch(gd_item* disc) {
     /* Patch */
     ((uint16_t*)0xAC000198)[0] = 0xFF86;
 
+    arena_reset_all();
+    log_flush();
     arch_exec(bloom_buf, bloom_size);
 }
 
@@ -120,6 +124,8 @@ bleem_launch(gd_item* disc) {
 
     bleem_buf[0x1CA70] = 1;
 
+    arena_reset_all();
+    log_flush();
     arch_exec(bleem_buf, bleem_size);
 }
 
@@ -149,6 +155,8 @@ dreamcast_launch_disc(gd_item* disc) {
         }
 
         /* Exit to BIOS (don't send VM2 ID for non-game discs) */
+        arena_reset_all();
+        log_flush();
         arch_exec_at(bloader_data, bloader_size, 0xacf00000);
         return;
     }
@@ -205,6 +213,8 @@ dreamcast_launch_disc(gd_item* disc) {
 
     memcpy((void*)0xACCFFF00, &param, 32);
 
+    arena_reset_all();
+    log_flush();
     arch_exec(gdmenu_loader, gdmenu_loader_length);
 }
 
@@ -325,5 +335,7 @@ dreamcast_launch_cb(gd_item* disc) {
         memcpy((void*)0xACE10000, cb_loader_data, cb_loader_size);
     }
 
+    arena_reset_all();
+    log_flush();
     arch_exec(cb_buf, cb_size);
 }
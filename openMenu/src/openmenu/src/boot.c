@@ -0,0 +1,158 @@
+/*
+ * File: boot.c
+ * Project: openmenu
+ * File Created: Monday, 19th October 2026 2:05:32 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdio.h>
+
+#include <kos/thread.h>
+
+#define LOG_MODULE BOOT
+#include <arena.h>
+#include <dbgprint.h>
+#include <profiler.h>
+#include "boot.h"
+
+enum {
+    STAGE_PENDING = 0,
+    STAGE_RUNNING,
+    STAGE_DONE,
+};
+
+static boot_stage* stages = NULL;
+static uint32_t boot_start_us;
+static int boot_frames = 0;
+static int boot_reported = 0;
+
+static uint32_t
+boot_now_us(void) {
+    return prof_now_us() - boot_start_us;
+}
+
+static void
+boot_report(const boot_stage* stage) {
+    LOG_INFO("BOOT:%-9s %5lu.%03lu ms, done at %lu ms%s\n", stage->name,
+             (unsigned long)((stage->end_us - stage->start_us) / 1000),
+             (unsigned long)((stage->end_us - stage->start_us) % 1000), (unsigned long)(stage->end_us / 1000),
+             stage->result ? " (failed)" : "");
+    PROF_MARK(stage->name, boot_start_us + stage->start_us, boot_start_us + stage->end_us);
+}
+
+static void
+boot_run_stage(boot_stage* stage) {
+    stage->state = STAGE_RUNNING;
+    stage->start_us = boot_now_us();
+    stage->result = stage->run();
+    stage->end_us = boot_now_us();
+    stage->state = STAGE_DONE;
+}
+
+static void*
+boot_thread(void* param) {
+    boot_run_stage((boot_stage*)param);
+    return NULL;
+}
+
+static int
+boot_deps_done(const boot_stage* stage) {
+    for (int i = 0; i < BOOT_NUM_STAGES; i++) {
+        if ((stage->deps & BOOT_DEP(i)) && stages[i].state != STAGE_DONE) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void
+boot_init(boot_stage* table) {
+    stages = table;
+    boot_start_us = prof_now_us();
+    boot_frames = 0;
+    boot_reported = 0;
+    for (int i = 0; i < BOOT_NUM_STAGES; i++) {
+        stages[i].state = STAGE_PENDING;
+        stages[i].result = 0;
+    }
+}
+
+int
+boot_require(BOOT_STAGE id) {
+    boot_stage* stage = &stages[id];
+    int ret = 0;
+
+    if (stage->state == STAGE_DONE) {
+        return 0;
+    }
+    if (stage->state == STAGE_RUNNING) {
+        if (stage->where != BOOT_THREAD) {
+            LOG_ERROR("BOOT:%s depends on itself!\n", stage->name);
+            return 1;
+        }
+        while (stage->state != STAGE_DONE) {
+            thd_pass();
+        }
+        return stage->result;
+    }
+
+    for (int i = 0; i < BOOT_NUM_STAGES; i++) {
+        if (stage->deps & BOOT_DEP(i)) {
+            ret += boot_require((BOOT_STAGE)i);
+        }
+    }
+    boot_run_stage(stage);
+    boot_report(stage);
+    return ret + stage->result;
+}
+
+void
+boot_step(void) {
+    if (boot_reported) {
+        return;
+    }
+    if (!boot_frames++) {
+        int left = 0;
+        for (int i = 0; i < BOOT_NUM_STAGES; i++) {
+            left += (stages[i].state != STAGE_DONE);
+        }
+        LOG_INFO("BOOT:interactive at %lu ms, %d stages left\n", (unsigned long)(boot_now_us() / 1000), left);
+    }
+
+    int ran_inline = 0;
+    int all_done = 1;
+    for (int i = 0; i < BOOT_NUM_STAGES; i++) {
+        boot_stage* stage = &stages[i];
+        if (stage->state == STAGE_DONE) {
+            continue;
+        }
+        all_done = 0;
+        if (stage->state != STAGE_PENDING || !boot_deps_done(stage)) {
+            continue;
+        }
+        if (stage->where == BOOT_THREAD) {
+            stage->state = STAGE_RUNNING;
+            thd_create(1, boot_thread, stage);
+        } else if (!ran_inline) {
+            boot_run_stage(stage);
+            boot_report(stage);
+            ran_inline = 1;
+        }
+    }
+
+    /* Thread stages only get reported once the main thread sees them finish */
+    if (all_done) {
+        for (int i = 0; i < BOOT_NUM_STAGES; i++) {
+            if (stages[i].where == BOOT_THREAD) {
+                boot_report(&stages[i]);
+            }
+        }
+        LOG_INFO("BOOT:complete at %lu ms\n", (unsigned long)(boot_now_us() / 1000));
+        arena_log_report();
+        boot_reported = 1;
+    }
+}
+
@@ -0,0 +1,62 @@
+/*
+ * File: boot.h
+ * Project: openmenu
+ * File Created: Monday, 19th October 2026 2:05:32 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/* Startup is split into stages with explicit dependencies. Only what the
+ * first frame needs runs before the main loop, pulled in by requiring
+ * BOOT_UI; everything else finishes between frames, one stage per frame, or
+ * on its own thread. A stage can pull in another with boot_require when a
+ * dependency only exists for some settings (genre filter needs META.DAT) */
+typedef enum BOOT_STAGE {
+    BOOT_VM2 = 0,
+    BOOT_SETTINGS,
+    BOOT_POOLS,
+    BOOT_REMAP,
+    BOOT_LIST,
+    BOOT_META,
+    BOOT_THEMES,
+    BOOT_SORT,
+    BOOT_DRAW,
+    BOOT_UI,
+    BOOT_ART,
+    BOOT_VMU,
+    BOOT_NUM_STAGES,
+} BOOT_STAGE;
+
+typedef enum BOOT_RUN {
+    BOOT_INLINE = 0, /* on the main thread */
+    BOOT_THREAD,     /* on its own thread, for work that mostly sleeps on maple */
+} BOOT_RUN;
+
+typedef struct boot_stage {
+    const char* name;
+    int (*run)(void);
+    uint32_t deps; /* BOOT_DEP of every stage that has to finish first */
+    BOOT_RUN where;
+
+    /* Filled in by the scheduler, times are since boot_init */
+    volatile int state;
+    int result;
+    uint32_t start_us;
+    uint32_t end_us;
+} boot_stage;
+
+#define BOOT_DEP(stage) (1u << (stage))
+
+void boot_init(boot_stage* stages);
+/* Runs stage and its dependencies now unless already done, waits for it if it
+ * is running on a thread. Returns the summed results of what it ran */
+int boot_require(BOOT_STAGE stage);
+/* After every frame: starts thread stages that are ready and runs at most one
+ * inline stage. The first call reports time to interactive */
+void boot_step(void);
@@ -21,16 +21,24 @@
 #include <dc/video.h>
 #include <kos/thread.h>
 
+#include <arena.h>
 #include <backend/db_list.h>
 #include <backend/gd_list.h>
+#include <dbgprint.h>
 #include <openmenu_debug.h>
 #include <openmenu_savefile.h>
 #include <openmenu_settings.h>
+#include <profiler.h>
+#include <texture/serial_sanitize.h>
 #include "backend/gdemu_sdk.h"
+#include "boot.h"
 #include "ui/common.h"
 #include "ui/dc/input.h"
 #include "ui/dc/pvr_texture.h"
 #include "ui/draw_prototypes.h"
+#include "ui/input_control.h"
+#include "ui/input_script.h"
+#include "ui/profiler_overlay.h"
 #include "ui/ui_common.h"
 #include "ui/ui_menu_credits.h"
 #include "vm2/vm2_api.h"
@@ -167,6 +175,15 @@ ui_set_choice(int choice) {
     if (choice < UI_START || choice >= num_ui_choices) {
         choice = UI_START;
     }
+
+    /* Descriptions are on screen from the first frame, custom themes are
+     * picked up in init */
+    if (choice == UI_LINE_DESC) {
+        boot_require(BOOT_META);
+    }
+    if (sf_custom_theme[0]) {
+        boot_require(BOOT_THEMES);
+    }
     current_ui_init = ui_choices[choice].init;
     current_ui_setup = ui_choices[choice].setup;
     current_ui_draw_OP = ui_choices[choice].drawOP;
@@ -217,23 +234,28 @@ vm2_send_id_to_all(const char* product, const char* name) {
 }
 
 static int
-init() {
-    int ret = 0;
-
-    /* Load settings */
+boot_settings(void) {
     savefile_init();
+    return 0;
+}
 
-    ret += txr_create_small_pool();
-    ret += txr_create_large_pool();
-    ret += txr_load_DATs();
-    ret += list_read_default();
-    check_bloom_available();  /* Check for BLOOM.BIN once at startup */
-    ret += db_load_DAT();
-    ret += theme_manager_load();
+static int
+boot_pools(void) {
+    return txr_create_small_pool() + txr_create_large_pool();
+}
+
+static int
+boot_list(void) {
+    int ret = list_read_default();
+    check_bloom_available(); /* Check for BLOOM.BIN once at startup */
 
     /* Initialize folder tree after loading game list */
     list_folder_init();
+    return ret;
+}
 
+static int
+boot_sort(void) {
     if (!sf_filter[0]) {
         switch (sf_sort[0]) {
             case SORT_NAME: list_set_sort_name(); break;
@@ -247,17 +269,89 @@ init() {
             default:
             case SORT_DEFAULT: list_set_sort_alphabetical(); break;
         }
-    } else {
-        list_set_genre_sort((FLAGS_GENRE)sf_filter[0] - 1, sf_sort[0]);
+        return 0;
     }
 
+    /* Filtering goes by genre, so only then does the list wait on META.DAT */
+    const int ret = boot_require(BOOT_META);
+    list_set_genre_sort((FLAGS_GENRE)sf_filter[0] - 1, sf_sort[0]);
+    return ret;
+}
+
+static int
+boot_draw(void) {
     /* setup internal memory zones */
     draw_init();
+    return 0;
+}
 
-    /* Load UI */
+static int
+boot_ui(void) {
     ui_set_choice(sf_ui[0]);
+    return 0;
+}
 
-    return ret;
+/* VM2 style devices swap to the openMenu card on this, has to happen before
+ * the settings are looked for on it */
+static int
+boot_vm2(void) {
+    /* DEBUG: BLUE = before vm2_rescan */
+    DFLASH(0, 0, 255);
+
+    /* Scan for VM2/VMUPro/USB4Maple/Pico2Maple devices and send initial ID */
+    vm2_rescan();
+
+    /* DEBUG: YELLOW = after vm2_rescan */
+    DFLASH(255, 255, 0);
+
+    for (int i = 0; i < vm2_device_count; i++) {
+        maple_device_t* vmu = vm2_devices[i];
+        int port = vmu->port;
+        int unit = vmu->unit;
+
+        vm2_set_id(vmu, "openmenu", NULL);
+        thd_sleep(200);
+
+        while (!maple_enum_dev(port, unit)) {
+            thd_pass();
+        }
+    }
+    return 0;
+}
+
+/* VMU icon and clock sync after settings came off SD, mostly waiting on maple
+ * so it gets a thread */
+static int
+boot_vmu(void) {
+    savefile_init_late();
+    return 0;
+}
+
+/* Art shows the missing icon until BOOT_ART is done, txr_get_* is asked again
+ * every frame so it appears without the UI doing anything */
+static boot_stage boot_stages[BOOT_NUM_STAGES] = {
+    [BOOT_VM2] = {.name = "vm2", .run = boot_vm2},
+    [BOOT_SETTINGS] = {.name = "settings", .run = boot_settings, .deps = BOOT_DEP(BOOT_VM2)},
+    [BOOT_POOLS] = {.name = "pools", .run = boot_pools},
+    [BOOT_REMAP] = {.name = "remap", .run = serial_sanitizer_init},
+    [BOOT_LIST] = {.name = "list", .run = boot_list, .deps = BOOT_DEP(BOOT_REMAP)},
+    [BOOT_META] = {.name = "meta", .run = db_load_DAT},
+    [BOOT_THEMES] = {.name = "themes", .run = theme_manager_load},
+    [BOOT_SORT] = {.name = "sort", .run = boot_sort, .deps = BOOT_DEP(BOOT_SETTINGS) | BOOT_DEP(BOOT_LIST)},
+    [BOOT_DRAW] = {.name = "draw", .run = boot_draw},
+    [BOOT_UI] = {.name = "ui",
+                 .run = boot_ui,
+                 .deps = BOOT_DEP(BOOT_SETTINGS) | BOOT_DEP(BOOT_POOLS) | BOOT_DEP(BOOT_SORT) | BOOT_DEP(BOOT_DRAW)},
+    [BOOT_ART] = {.name = "art", .run = txr_load_DATs, .deps = BOOT_DEP(BOOT_POOLS)},
+    [BOOT_VMU] = {.name = "vmu", .run = boot_vmu, .deps = BOOT_DEP(BOOT_SETTINGS), .where = BOOT_THREAD},
+};
+
+static int
+init() {
+    boot_init(boot_stages);
+
+    /* Just what the first frame needs, the rest comes in through boot_step */
+    return boot_require(BOOT_UI);
 }
 
 static void
@@ -268,14 +362,21 @@ draw(void) {
     draw_set_list(PVR_LIST_OP_POLY);
     pvr_list_begin(PVR_LIST_OP_POLY);
 
+    PROF_BEGIN(DRAW_OP);
     (*current_ui_draw_OP)();
+    draw_flush();
+    PROF_END(DRAW_OP);
 
     pvr_list_finish();
 
     draw_set_list(PVR_LIST_TR_POLY);
     pvr_list_begin(PVR_LIST_TR_POLY);
 
+    PROF_BEGIN(DRAW_TR);
     (*current_ui_draw_TR)();
+    PROF_END(DRAW_TR);
+    profiler_overlay_draw_tr();
+    draw_flush();
 
     pvr_list_finish();
 
@@ -304,6 +405,7 @@ processInput(void) {
 
     if (!cont && !kbd) {
         /* No controller or keyboard - send neutral input */
+        input_record_frame(&_input);
         INPT_ReceiveFromHost(_input);
         return;
     }
@@ -346,110 +448,14 @@ processInput(void) {
         }
     }
 
+    input_record_frame(&_input);
     INPT_ReceiveFromHost(_input);
 }
 
 static int
 translate_input(void) {
     processInput();
-
-    /* D-Pad directions */
-    if (INPT_DPADDirection(DPAD_LEFT)) {
-        return LEFT;
-    }
-    if (INPT_DPADDirection(DPAD_RIGHT)) {
-        return RIGHT;
-    }
-    if (INPT_DPADDirection(DPAD_UP)) {
-        return UP;
-    }
-    if (INPT_DPADDirection(DPAD_DOWN)) {
-        return DOWN;
-    }
-
-    /* Analog stick */
-    if (INPT_AnalogI(AXES_X) < 128 - 24) {
-        return LEFT;
-    }
-    if (INPT_AnalogI(AXES_X) > 128 + 24) {
-        return RIGHT;
-    }
-
-    if (INPT_AnalogI(AXES_Y) < 128 - 24) {
-        return UP;
-    }
-    if (INPT_AnalogI(AXES_Y) > 128 + 24) {
-        return DOWN;
-    }
-
-    /* Buttons - use edge detection (BTN_PRESS) for A, B, Y, START to prevent
-     * double-press bugs when transitioning between UI states. X keeps hold
-     * detection for grid mode artwork zoom feature. */
-    if (INPT_ButtonEx(BTN_A, BTN_PRESS)) {
-        return A;
-    }
-    if (INPT_ButtonEx(BTN_B, BTN_PRESS)) {
-        return B;
-    }
-    if (INPT_Button(BTN_X)) {
-        return X;
-    }
-    if (INPT_ButtonEx(BTN_Y, BTN_PRESS)) {
-        return Y;
-    }
-    if (INPT_ButtonEx(BTN_START, BTN_PRESS)) {
-        return START;
-    }
-
-    /* Triggers */
-    if (INPT_TriggerPressed(TRIGGER_L)) {
-        return TRIG_L;
-    }
-    if (INPT_TriggerPressed(TRIGGER_R)) {
-        return TRIG_R;
-    }
-
-    /* Keyboard support - skip if no keys pressed */
-    if (!INPT_KeyboardNone()) {
-        /* Check if Shift is held — if so, skip letter/number button mappings
-         * so the UI quick-jump feature (Shift+Letter/Number) works without
-         * also triggering the action mapped to that key. */
-        uint8_t mods = INPT_KeyboardModifiers();
-        bool shift_held = (mods & KBD_MOD_LSHIFT) || (mods & KBD_MOD_RSHIFT);
-
-        /* Arrow keys → D-Pad (always active, even with Shift) */
-        if (INPT_KeyboardButton(KBD_KEY_LEFT)) {
-            return LEFT;
-        }
-        if (INPT_KeyboardButton(KBD_KEY_RIGHT)) {
-            return RIGHT;
-        }
-        if (INPT_KeyboardButton(KBD_KEY_UP)) {
-            return UP;
-        }
-        if (INPT_KeyboardButton(KBD_KEY_DOWN)) {
-            return DOWN;
-        }
-
-        if (!shift_held) {
-            /* Letter keys → button mappings (disabled when Shift held for quick-jump) */
-            if (INPT_KeyboardButtonPress(KBD_KEY_Z)) { return A; }
-            if (INPT_KeyboardButtonPress(KBD_KEY_X)) { return B; }
-            if (INPT_KeyboardButton(KBD_KEY_A))      { return X; }
-            if (INPT_KeyboardButtonPress(KBD_KEY_S)) { return Y; }
-            if (INPT_KeyboardButton(KBD_KEY_Q))      { return TRIG_L; }
-            if (INPT_KeyboardButton(KBD_KEY_W))      { return TRIG_R; }
-        }
-
-        /* Non-letter keys → button mappings (always active, not quick-jump targets) */
-        if (INPT_KeyboardButtonPress(KBD_KEY_SPACE))  { return A; }
-        if (INPT_KeyboardButtonPress(KBD_KEY_ESCAPE)) { return B; }
-        if (INPT_KeyboardButtonPress(KBD_KEY_ENTER))  { return START; }
-        if (INPT_KeyboardButton(KBD_KEY_PGUP))        { return TRIG_L; }
-        if (INPT_KeyboardButton(KBD_KEY_PGDOWN))      { return TRIG_R; }
-    }
-
-    return NONE;
+    return input_control();
 }
 
 static void
@@ -478,7 +484,7 @@ init_gfx_pvr(void) {
         256 * 1024,                                                                    /* 256kb Vertex buffer  */
         0,                                                                             /* No DMA, but maybe? */
         0,                                                                             /* No FSAA */
-        0,                                                                             /* Disable TR autosort */
+        0,                                                                             /* TR autosort on, draws are ordered by z */
         0};
 
     pvr_init(&params);
@@ -504,28 +510,6 @@ main(int argc, char* argv[]) {
     /* DEBUG: GREEN = after maple_wait_scan */
     DFLASH(0, 255, 0);
 
-    /* DEBUG: BLUE = before vm2_rescan */
-    DFLASH(0, 0, 255);
-
-    /* Scan for VM2/VMUPro/USB4Maple/Pico2Maple devices and send initial ID */
-    vm2_rescan();
-
-    /* DEBUG: YELLOW = after vm2_rescan */
-    DFLASH(255, 255, 0);
-
-    for (int i = 0; i < vm2_device_count; i++) {
-        maple_device_t* vmu = vm2_devices[i];
-        int port = vmu->port;
-        int unit = vmu->unit;
-
-        vm2_set_id(vmu, "openmenu", NULL);
-        thd_sleep(200);
-
-        while (!maple_enum_dev(port, unit)) {
-            thd_pass();
-        }
-    }
-
     /* fflush(stdout); */
     /* setbuf(stdout, NULL); */
 
@@ -534,7 +518,7 @@ main(int argc, char* argv[]) {
 
     init_gfx_pvr();
 
-    /* Show loading screen while init() runs (which includes a 1s delay) */
+    /* Show loading screen while the first frame's boot stages run */
     show_loading_screen();
 
     /* DEBUG: MAGENTA = before init/savefile_init */
@@ -542,6 +526,7 @@ main(int argc, char* argv[]) {
 
     if (init()) {
         /* puts("Init error."); */
+        log_flush();
         savefile_close();
         return 1;
     }
@@ -551,13 +536,19 @@ main(int argc, char* argv[]) {
 
     for (;;) {
         z_reset();
+        PROF_BEGIN(INPUT);
         (*current_ui_handle_input)(translate_input());
+        PROF_END(INPUT);
+        profiler_overlay_input();
         vid_waitvbl();
         if (need_reload_ui) {
             ui_set_choice(sf_ui[0]);
         } else {
             draw();
         }
+        boot_step();
+        PROF_FRAME_END();
+        log_flush();
     }
 
     savefile_close();
@@ -596,6 +587,9 @@ exit_to_bios_ex(int do_mount, int do_send_id) {
         }
     }
 
+    /* Everything from boot goes in one free per arena */
+    arena_reset_all();
+    log_flush();
     arch_exec_at(bloader_data, bloader_size, 0xacf00000);
 }
 
@@ -0,0 +1,104 @@
+/*
+ * File: pal_bank.c
+ * Project: texture
+ * File Created: Sunday, 18th October 2026 12:02:51 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License,
+ * http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <dc/pvr.h>
+
+#include <texture/pvr_palette.h>
+
+#include "pal_bank.h"
+
+/* Palette format is global to the PVR, first palette bound decides it */
+static int pal_format = -1;
+static unsigned char pal_owner[PAL_BANK_SLOTS];
+
+void
+pal_bank_init(void) {
+    pal_format = -1;
+    memset(pal_owner, '\0', sizeof(pal_owner));
+}
+
+static int
+pal_bank_set_format(unsigned int px_format) {
+    const int wanted = (px_format == PVR_PX_ARGB4444) ? PVR_PAL_ARGB4444 : PVR_PAL_RGB565;
+
+    if (pal_format == wanted) {
+        return 0;
+    }
+    /* Switching format reinterprets every resident palette, only allowed while nothing is bound */
+    for (int i = 0; i < PAL_BANK_SLOTS; i++) {
+        if (pal_owner[i]) {
+            return -1;
+        }
+    }
+    pvr_set_pal_format(wanted);
+    pal_format = wanted;
+    return 0;
+}
+
+int
+pal_bank_bind(int slot_num, void* pvr_data, uint32_t* pal_select) {
+    unsigned char* hdr = (unsigned char*)pvr_data;
+    const unsigned int px_format = hdr[PVR_PAL_HDR_SIZE - 8];
+    const pvr_pal_block* block;
+
+    *pal_select = 0;
+    if (px_format != PVR_PX_PAL4BPP && px_format != PVR_PX_PAL8BPP) {
+        return 0;
+    }
+
+    block = pvr_pal_block_get(pvr_data);
+    if (!block || slot_num < 0 || slot_num >= PAL_BANK_SLOTS || block->num_colors > PVR_PAL_SLOT_COLORS) {
+        return -1;
+    }
+    if (pal_bank_set_format(block->format)) {
+        return -1;
+    }
+
+    const unsigned int base = slot_num * PVR_PAL_SLOT_COLORS;
+    for (unsigned int i = 0; i < block->num_colors; i++) {
+        pvr_set_pal_entry(base + i, block->colors[i]);
+    }
+
+    if (px_format == PVR_PX_PAL8BPP) {
+        /* 8bpp selects a 256 entry bank, shift indices up to this slot's quarter of it */
+        const uint32_t width = hdr[PVR_PAL_HDR_SIZE - 4] | hdr[PVR_PAL_HDR_SIZE - 3] << 8;
+        const uint32_t height = hdr[PVR_PAL_HDR_SIZE - 2] | hdr[PVR_PAL_HDR_SIZE - 1] << 8;
+        const unsigned char offset = (unsigned char)(base & 0xFF);
+        unsigned char* texels = hdr + PVR_PAL_HDR_SIZE;
+        if (offset) {
+            for (uint32_t i = 0; i < width * height; i++) {
+                texels[i] += offset;
+            }
+        }
+        *pal_select = PVR_TXRFMT_8BPP_PAL(base / 256);
+    } else {
+        /* 4bpp selects a 16 entry bank directly */
+        *pal_select = PVR_TXRFMT_4BPP_PAL(base / 16);
+    }
+
+    pal_owner[slot_num] = 1;
+    return 0;
+}
+
+void
+pal_bank_release(unsigned int slot_num) {
+    if (slot_num < PAL_BANK_SLOTS) {
+        pal_owner[slot_num] = 0;
+    }
+}
+
+void
+pal_bank_release_all(void) {
+    memset(pal_owner, '\0', sizeof(pal_owner));
+}
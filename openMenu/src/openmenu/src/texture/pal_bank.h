@@ -0,0 +1,23 @@
+/*
+ * File: pal_bank.h
+ * Project: texture
+ * File Created: Sunday, 18th October 2026 12:02:51 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/* Palette RAM split evenly between the small pool slots, slot N owns entries N*64 .. N*64+63 */
+#define PAL_BANK_SLOTS (16)
+
+void pal_bank_init(void);
+/* Uploads the palette carried in pvr_data for slot_num, remaps PAL8 texels in place and
+ * returns the palette select bits to OR into the texture format. Non palettized data is left untouched. */
+int pal_bank_bind(int slot_num, void* pvr_data, uint32_t* pal_select);
+void pal_bank_release(unsigned int slot_num);
+void pal_bank_release_all(void);
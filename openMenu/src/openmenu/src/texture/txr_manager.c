@@ -15,11 +15,12 @@
 #include <dc/pvr.h>
 
 #include <backend/dat_format.h>
+#include <profiler.h>
 #include "ui/draw_kos.h"
 #include "ui/draw_prototypes.h"
 #include "block_pool.h"
 #include "lru.h"
-#include <texture/serial_sanitize.h>
+#include "pal_bank.h"
 
 #include "txr_manager.h"
 
@@ -63,22 +64,23 @@ block_pool_del_cb(const char* key, void* value, void* user) {
     block_pool* pool = (block_pool*)user;
     unsigned int slot_num = *(unsigned int*)value;
     pool_dealloc_slot(pool, slot_num);
+    if (pool == &icon_system.pool) {
+        pal_bank_release(slot_num);
+    }
     return 0;
 }
 
 int
 txr_load_DATs(void) {
-    serial_sanitizer_init(); /*@Todo: Move this */
-
     DAT_init(&icon_system.addon);
     DAT_init(&icon_system.primary);
     DAT_init(&box_system.addon);
     DAT_init(&box_system.primary);
 
-    DAT_load_parse(&icon_system.primary, "ICON.DAT");
-    DAT_load_parse(&box_system.primary, "BOX.DAT");
-    DAT_load_parse(&icon_system.addon, "ICON_EX.DAT");
-    DAT_load_parse(&box_system.addon, "BOX_EX.DAT");
+    DAT_load_parse(&icon_system.primary, "ICON.DAT", DAT_VERSION);
+    DAT_load_parse(&box_system.primary, "BOX.DAT", DAT_VERSION);
+    DAT_load_parse(&icon_system.addon, "ICON_EX.DAT", DAT_VERSION);
+    DAT_load_parse(&box_system.addon, "BOX_EX.DAT", DAT_VERSION);
 
     return 0;
 }
@@ -87,6 +89,7 @@ int
 txr_create_small_pool(void) {
     void* buffer = pvr_mem_malloc(SM_POOL_SIZE);
     pool_create(&icon_system.pool, buffer, SM_POOL_SIZE, SM_SLOT_NUM);
+    pal_bank_init();
     icon_system.cache.cache = NULL;
     cache_set_size(&icon_system.cache, SM_SLOT_NUM);
     cache_callback_userdata(&icon_system.cache, &icon_system.pool);
@@ -114,6 +117,7 @@ void
 txr_empty_small_pool(void) {
     empty_cache(&icon_system.cache);
     pool_dealloc_all(&icon_system.pool);
+    pal_bank_release_all();
 }
 
 void
@@ -126,13 +130,12 @@ static int
 txr_get_from_dat_set(const char* id, struct image* img, dat_system* system) {
     void* txr_ptr;
     int slot_num;
-    const char* id_santized = serial_santize_art(id);
 
     /* Initially check addon then fall back to regular */
-    uint32_t temp_offset = DAT_get_offset_by_ID(&system->addon, id_santized);
+    uint32_t temp_offset = DAT_get_offset_by_ID(&system->addon, id);
     const dat_file* dat_source = &system->addon;
     if (!temp_offset) {
-        temp_offset = DAT_get_offset_by_ID(&system->primary, id_santized);
+        temp_offset = DAT_get_offset_by_ID(&system->primary, id);
         dat_source = &system->primary;
         if (!temp_offset) {
             dat_source = NULL;
@@ -141,19 +144,25 @@ txr_get_from_dat_set(const char* id, struct image* img, dat_system* system) {
 
     /* check if exists in DAT and if not, return missing image */
     if (!dat_source) {
+        PROF_COUNT(TXR_MISSING);
         draw_load_missing_icon(img);
         return 0;
     }
-    slot_num = find_in_cache(&system->cache, id_santized);
+    slot_num = find_in_cache(&system->cache, id);
     if (slot_num == -1) {
-        add_to_cache(&system->cache, id_santized, 0);
-        slot_num = find_in_cache(&system->cache, id_santized);
+        PROF_COUNT(TXR_MISS);
+        PROF_BEGIN(TXR_LOAD);
+        add_to_cache(&system->cache, id, 0);
+        slot_num = find_in_cache(&system->cache, id);
         txr_ptr = pool_get_slot_addr(&system->pool, slot_num);
 
-        /* now load the texture into vram */
-        draw_load_texture_from_DAT_to_buffer(dat_source, id_santized, img, txr_ptr);
+        /* now load the texture into vram, only icon slots own palette RAM */
+        draw_load_texture_from_DAT_to_slot(dat_source, id, img, txr_ptr,
+                                           (system == &icon_system) ? slot_num : -1);
         pool_set_slot_format(&system->pool, slot_num, img->width, img->height, img->format);
+        PROF_END(TXR_LOAD);
     } else {
+        PROF_COUNT(TXR_HIT);
         const slot_format* fmt = pool_get_slot_format(&system->pool, slot_num);
         img->width = fmt->width;
         img->height = fmt->height;
@@ -10,6 +10,8 @@
 #include <dc/pvr.h>
 
 #include <dbgprint.h>
+#include <profiler.h>
+#include "ui/dc/glyph_cache.h"
 #include "ui/draw_prototypes.h"
 
 typedef struct bitmap_font {
@@ -22,19 +24,15 @@ static bitmap_font font;
 static uint32_t font_color;
 
 #define FONT_PERROW(font) (font.texture.width / font.char_width)
-#define BUFFER_MAX_CHARS  (128)
 
+static draw_text_hdr font_header;
 #ifdef KOS_SPRITE
-static pvr_sprite_hdr_t font_header;
 #define VERT_PER_CHAR (1)
-static pvr_sprite_txr_t charbuf[BUFFER_MAX_CHARS * VERT_PER_CHAR] __attribute__((aligned(32)));
 #else
-static pvr_poly_hdr_t font_header;
 #define VERT_PER_CHAR (4)
-static pvr_vertex_t charbuf[BUFFER_MAX_CHARS * VERT_PER_CHAR] __attribute__((aligned(32)));
 #endif
 
-static int charbuffered;
+_Static_assert(GLYPH_RUN_QUADS * VERT_PER_CHAR <= DRAW_TEXT_VERTS, "glyph run larger than the text buffer");
 
 int
 font_bmp_init(const char* filename, int char_width, int char_height) {
@@ -46,6 +44,7 @@ font_bmp_init(const char* filename, int char_width, int char_height) {
     font.char_width = char_width;
 
     font_color = 0xFFFFFFFF; // White
+    glyph_cache_clear(GLYPH_FONT_BMP);
 
     return 0;
 }
@@ -74,8 +73,9 @@ font_bmp_set_color(uint32_t color) {
 #ifdef KOS_SPRITE
     font_header.argb = color;
 #endif
-    /* Start a textured polygon set (with the font texture and color) */
-    pvr_prim(&font_header, sizeof(font_header));
+    /* Start a textured polygon set (with the font texture and color), only
+     * sprites keep the color in the header so polygons stay in one burst */
+    draw_text_header(&font_header);
 }
 
 void
@@ -88,30 +88,42 @@ font_bmp_set_color_components(int r, int g, int b, int a) {
     font_color = PVR_PACK_ARGB(a, r, g, b);
 }
 
-/* Draws a font letter using two triangle strips */
-static void
-font_bmp_draw_char(int x, int y, unsigned char ch) {
+/* Where a letter lands at x, y and its texture coords, 0 for a space */
+static int
+font_bmp_layout_char(int x, int y, unsigned char ch, glyph_quad* quad) {
     const int index = ch - 32;
     const int ix = (index % FONT_PERROW(font)) * font.char_width;
     const int iy = (index / FONT_PERROW(font)) * font.char_height;
 
+    if (index == -1) {
+        return 0;
+    }
+
     /* Upper left */
-    const float x1 = x;
-    const float y1 = y;
-    const float u1 = ix * 1.0f / font.texture.width;
-    const float v1 = iy * 1.0f / font.texture.height;
+    quad->x1 = x;
+    quad->y1 = y;
+    quad->u1 = ix * 1.0f / font.texture.width;
+    quad->v1 = iy * 1.0f / font.texture.height;
 
     /* Lower right */
-    const float x2 = x1 + font.char_width;
-    const float y2 = y1 + font.char_height;
-    const float u2 = (ix + font.char_width) * 1.0f / font.texture.width;
-    const float v2 = (iy + font.char_height) * 1.0f / font.texture.height;
-
-    const float z = z_get();
+    quad->x2 = quad->x1 + font.char_width;
+    quad->y2 = quad->y1 + font.char_height;
+    quad->u2 = (ix + font.char_width) * 1.0f / font.texture.width;
+    quad->v2 = (iy + font.char_height) * 1.0f / font.texture.height;
+    return 1;
+}
 
-    if (index == -1) {
+/* Draws a font letter using two triangle strips */
+static void
+font_bmp_draw_char(int x, int y, unsigned char ch) {
+    glyph_quad quad;
+    if (!font_bmp_layout_char(x, y, ch, &quad)) {
         return;
     }
+    const float x1 = quad.x1, y1 = quad.y1, u1 = quad.u1, v1 = quad.v1;
+    const float x2 = quad.x2, y2 = quad.y2, u2 = quad.u2, v2 = quad.v2;
+
+    const float z = z_get();
 
 #ifdef KOS_SPRITE
     pvr_sprite_txr_t vert = {
@@ -136,13 +148,13 @@ font_bmp_draw_char(int x, int y, unsigned char ch) {
         .cuv = PVR_PACK_16BIT_UV(u2, v2), /* UVS */
     };
 
-    charbuf[charbuffered] = vert;
+    *draw_text_reserve(VERT_PER_CHAR) = vert;
 #else
     pvr_vertex_t *vert1, *vert2, *vert3, *vert4;
-    vert1 = &charbuf[charbuffered + 0];
-    vert2 = &charbuf[charbuffered + 1];
-    vert3 = &charbuf[charbuffered + 2];
-    vert4 = &charbuf[charbuffered + 3];
+    vert1 = draw_text_reserve(VERT_PER_CHAR);
+    vert2 = vert1 + 1;
+    vert3 = vert1 + 2;
+    vert4 = vert1 + 3;
 
     vert1->flags = PVR_CMD_VERTEX;
     vert1->x = x1;
@@ -180,20 +192,51 @@ font_bmp_draw_char(int x, int y, unsigned char ch) {
     vert4->argb = font_color;
     vert4->oargb = 0;
 #endif
-    charbuffered += VERT_PER_CHAR;
 }
 
+#ifndef KOS_SPRITE
+static void
+_font_bmp_layout_run(glyph_run* run, const char* str) {
+    glyph_quad quad;
+    int x1 = 0;
+
+    do {
+        if (font_bmp_layout_char(x1, 0, *str, &quad)) {
+            glyph_run_add(run, &quad);
+        }
+        x1 += (int)(font.char_width);
+    } while (*++str);
+}
+#endif
+
 static void
 _font_bmp_draw_string(int x1, int y1, const char* str) {
-    z_inc();
-    charbuffered = 0;
+    const float z = z_inc();
+
+    if (!*str) {
+        return;
+    }
+
+#ifndef KOS_SPRITE
+    glyph_key key;
+    glyph_key_make(&key, GLYPH_FONT_BMP, 1.0f, 1.0f, str);
+    glyph_run* run = glyph_run_find(&key);
+    if (!run && (run = glyph_run_create(&key))) {
+        _font_bmp_layout_run(run, str);
+    }
+    if (run) {
+        glyph_run_emit(run, x1, y1, z, font_color, draw_text_reserve(glyph_run_verts(run)));
+        return;
+    }
+#else
+    (void)z;
+#endif
 
     do {
         unsigned char chr = (*str);
         font_bmp_draw_char(x1, y1, chr);
         x1 += (int)(font.char_width);
     } while (*++str);
-    pvr_prim(charbuf, charbuffered * sizeof(charbuf[0]));
 }
 
 /* @Note: revisit this */
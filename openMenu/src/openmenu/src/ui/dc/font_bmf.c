@@ -16,350 +16,19 @@
 #include <string.h>
 
 #include <dbgprint.h>
+#include <om_reader.h>
+#include <profiler.h>
+#include <texture/omf_format.h>
+#include "ui/dc/glyph_cache.h"
 #include "ui/draw_prototypes.h"
 
-#define PRINT_MEMBER(struct, member)                                                                                   \
-    do {                                                                                                               \
-        DBG_PRINT("%s: %d\n", #member, (int)((struct).member));                                                        \
-    } while (0)
-
 #define round(x)  (x)
 
-/* BMFont implementation */
-#define BMF_MAGIC (54938946) /* BMF(0x3) */
-
-typedef struct bm_header {
-    char bmf[3];
-    uint8_t version;
-} bm_header;
-
-/* Binary font info structures */
-
-// Tag header for each block type
-typedef enum BM_BLOCK_TYPE { INFO = 1, COMMON, PAGES, CHARS, KERNING } BM_BLOCK_TYPE;
-
-typedef struct __attribute__((__packed__)) bm_block_tag {
-    uint8_t type;
-    uint32_t size;
-} bm_block_tag;
-
-// Block type 1: info
-#define INFO_NAME_OFFSET (14)
-
-typedef struct __attribute__((__packed__)) bm_info {
-    int16_t fontSize;
-    uint8_t bitField;
-    uint8_t charSet;
-    uint16_t stretchH;
-    uint8_t aa;
-    uint8_t paddingUp;
-    uint8_t paddingRight;
-    uint8_t paddingDown;
-    uint8_t paddingLeft;
-    uint8_t spacingHoriz;
-    uint8_t spacingVert;
-    uint8_t outline;
-    char fontName[64];
-    /* VLA, size of block length - 14, null terminated string with length n */ // 64 for fix allign in stack
-} bm_info;
-
-// Block type 2: common
-typedef struct __attribute__((__packed__)) bm_common {
-    uint16_t lineHeight;
-    uint16_t base;
-    uint16_t scaleW;
-    uint16_t scaleH;
-    uint16_t pages;
-    uint8_t bitField; // bits 0-6: reserved, bit 7: packed
-    uint8_t alphaChnl;
-    uint8_t redChnl;
-    uint8_t greenChnl;
-    uint8_t blueChnl;
-} bm_common;
-
-// Block type 3: pages
-typedef struct __attribute__((__packed__)) bm_pages {
-    int name_len;
-    char pageNames[]; /*	p*(n+1)	strings	0	p null terminated strings, each
-                       with length n */
-} bm_pages;
-
-// Block type 4: chars
-typedef struct __attribute__((__packed__)) bm_char {
-    uint32_t id;
-    uint16_t x;
-    uint16_t y;
-    uint16_t width;
-    uint16_t height;
-    int16_t xoffset;
-    int16_t yoffset;
-    int16_t xadvance;
-    uint8_t page;
-    uint8_t chnl;
-} bm_char;
-
-// Block type 5: kerning pairs
-typedef struct __attribute__((__packed__)) bm_kern_pair {
-    uint32_t first;
-    uint32_t second;
-    int16_t amount;
-} bm_kern_pair;
-
-typedef struct __attribute__((__packed__)) bm_char_ex {
-    uint32_t id;
-    uint16_t x;
-    uint16_t y;
-    uint16_t width;
-    uint16_t height;
-    int16_t xoffset;
-    int16_t yoffset;
-    int16_t xadvance;
-    uint8_t page;
-    uint8_t chnl;
-    bm_kern_pair* kerns;
-} bm_char_ex;
-
-typedef struct __attribute__((__packed__)) bm_font {
-    uint16_t height;
-    uint16_t width;
-    uint32_t lineHeight;
-    uint32_t fontSize;
-    uint32_t num_chars;
-    uint32_t num_kerns;
-    bm_char_ex chars[256];
-    bm_kern_pair* kerns;
-} bm_font;
-
-static bm_font font_basilea;
+static omf_font font_basilea;
 static int font_loaded = 0;
 static float current_scale = 1.0;
 static unsigned int current_color;
 
-static int
-BMF_parse_info(file_t fd, size_t block_size, bm_font* font) {
-    DBG_PRINT("BMF found info block!\n");
-    /* Unsure why youd want to have this around or on heap */
-    static bm_info temp_info;
-    fs_read(fd, &temp_info, block_size);
-
-    /* Fix fontSize, its negative ? */
-    temp_info.fontSize *= -1;
-
-    font->fontSize = temp_info.fontSize;
-
-    PRINT_MEMBER(temp_info, fontSize);
-    PRINT_MEMBER(temp_info, bitField);
-    PRINT_MEMBER(temp_info, charSet);
-    PRINT_MEMBER(temp_info, stretchH);
-    PRINT_MEMBER(temp_info, aa);
-    PRINT_MEMBER(temp_info, paddingUp);
-    PRINT_MEMBER(temp_info, paddingRight);
-    PRINT_MEMBER(temp_info, paddingDown);
-    PRINT_MEMBER(temp_info, paddingLeft);
-    PRINT_MEMBER(temp_info, spacingHoriz);
-    PRINT_MEMBER(temp_info, spacingVert);
-    PRINT_MEMBER(temp_info, outline);
-    DBG_PRINT("name: %s\n", temp_info.fontName);
-    DBG_PRINT("\n");
-
-    return 0;
-}
-
-static int
-BMF_parse_common(file_t fd, size_t block_size, bm_font* font) {
-    DBG_PRINT("BMF found common block!\n");
-    bm_common temp_common;
-    fs_read(fd, &temp_common, block_size);
-
-    font->width = temp_common.scaleW;
-    font->height = temp_common.scaleH;
-    font->lineHeight = temp_common.lineHeight;
-
-    PRINT_MEMBER(temp_common, lineHeight);
-    PRINT_MEMBER(temp_common, base);
-    PRINT_MEMBER(temp_common, scaleW);
-    PRINT_MEMBER(temp_common, scaleH);
-    PRINT_MEMBER(temp_common, pages);
-    PRINT_MEMBER(temp_common, bitField);
-    PRINT_MEMBER(temp_common, alphaChnl);
-    PRINT_MEMBER(temp_common, redChnl);
-    PRINT_MEMBER(temp_common, greenChnl);
-    PRINT_MEMBER(temp_common, blueChnl);
-
-    DBG_PRINT("\n");
-    return 0;
-}
-
-static int
-BMF_parse_pages(file_t fd, size_t block_size, bm_font* font) {
-    DBG_PRINT("BMF found pages block!\n");
-    (void)font;
-
-    /* Do nothing! */
-    fs_seek(fd, block_size, SEEK_CUR);
-
-    DBG_PRINT("\n");
-
-    return 0;
-}
-
-static int
-BMF_parse_chars(file_t fd, size_t block_size, bm_font* font) {
-    DBG_PRINT("BMF found char block!\n");
-
-    int num_chars = block_size / sizeof(bm_char);
-    bm_char_ex temp_char;
-
-    font->num_chars = num_chars;
-
-    DBG_PRINT("BMF %d chars present\n", num_chars);
-
-    /* Read one at a time to font charset */
-    for (int i = 0; i < num_chars; i++) {
-        fs_read(fd, &temp_char, sizeof(bm_char));
-        if (temp_char.id < 256) {
-            /* Optionally print out info for each char parsed */
-#if defined(DBG_CHAR_INFO) && DBG_CHAR_INFO
-            char temp = (char)temp_char.id;
-            DBG_PRINT("Char: %c\n", temp);
-            PRINT_MEMBER(temp_char, id);
-            PRINT_MEMBER(temp_char, x);
-            PRINT_MEMBER(temp_char, y);
-            PRINT_MEMBER(temp_char, width);
-            PRINT_MEMBER(temp_char, height);
-            PRINT_MEMBER(temp_char, xoffset);
-            PRINT_MEMBER(temp_char, yoffset);
-            PRINT_MEMBER(temp_char, xadvance);
-            DBG_PRINT("\n");
-#endif
-
-            font->chars[temp_char.id] = temp_char;
-            font->chars[temp_char.id].kerns = NULL;
-        }
-    }
-
-    DBG_PRINT("\n");
-    return 0;
-}
-
-static int
-_kern_pair_sort(const void* a, const void* b) {
-    const bm_kern_pair* ia = (const bm_kern_pair*)a;
-    const bm_kern_pair* ib = (const bm_kern_pair*)b;
-    if (ia->first == ib->first) {
-        return ia->second - ib->second;
-    }
-    return ia->first - ib->first;
-}
-
-static int
-BMF_parse_kerning(file_t fd, size_t block_size, bm_font* font) {
-    DBG_PRINT("BMF found kerning block!\n");
-
-    /* Parse and save */
-    int num_pairs = block_size / sizeof(bm_kern_pair);
-
-    DBG_PRINT("BMF %d kerning pairs present\n", num_pairs);
-
-    font->kerns = malloc(sizeof(bm_kern_pair) * num_pairs);
-    if (!font->kerns) {
-        /* printf("%s no free memory\n", __func__); */
-        return 0;
-    }
-    font->num_kerns = num_pairs;
-    fs_read(fd, font->kerns, num_pairs * sizeof(bm_kern_pair));
-
-    /* Sort Kerning pairs */
-    qsort(font->kerns, num_pairs, sizeof(bm_kern_pair), _kern_pair_sort);
-
-    /* List the now sorted pairs*/
-    for (int i = 0; i < num_pairs; i++) {
-        bm_kern_pair* pair = &font->kerns[i];
-
-        if (pair->first < 256) {
-            font->chars[pair->first].kerns = pair;
-        }
-
-#if defined(DBG_KERN_INFO) && DBG_KERN_INFO
-        char first = (char)pair->first;
-        char second = (char)pair->second;
-        DBG_PRINT("First: %c\n", first);
-        DBG_PRINT("Second: %c\n", second);
-        DBG_PRINT("amount: %d\n", pair->amount);
-        DBG_PRINT("\n");
-#endif
-    }
-
-    DBG_PRINT("\n");
-    return 0;
-}
-
-/* BMFont specifics */
-static int
-BMF_load(const char* file, bm_font* font) {
-    // Zero out
-    memset(font, '\0', sizeof(bm_font));
-
-    file_t fd;
-    bool parsing = true;
-    fd = fs_open(file, O_RDONLY);
-
-    if (fd == -1) {
-        /* printf("BMF:Error file %s not found!\n", file); */
-        return 1;
-    }
-
-    bm_header file_header;
-    fs_read(fd, &file_header, sizeof(bm_header));
-    if (file_header.version != 3) {
-        fs_close(fd);
-        /* printf("BMF:Error font magic wrong %3s!\n", file_header.bmf); */
-        return 1;
-    }
-
-    static bm_block_tag next_block = {0, 0};
-    size_t ele_read;
-    while (parsing) {
-        ele_read = fs_read(fd, &next_block, sizeof(bm_block_tag));
-        DBG_PRINT("Found block type %d of size %ld\n", next_block.type, next_block.size);
-
-        if (ele_read != sizeof(bm_block_tag)) {
-            break;
-        }
-
-        switch (next_block.type) {
-            case INFO: BMF_parse_info(fd, next_block.size, font); break;
-            case COMMON: BMF_parse_common(fd, next_block.size, font); break;
-            case PAGES: BMF_parse_pages(fd, next_block.size, font); break;
-            case CHARS: BMF_parse_chars(fd, next_block.size, font); break;
-            case KERNING:
-                BMF_parse_kerning(fd, next_block.size, font);
-                parsing = false; /* should be end of file */
-                break;
-            default: /* printf("BMF:Error unknown block type %d\n", next_block.type); */ break;
-        }
-    }
-
-    fs_close(fd);
-
-    font_loaded = 1;
-
-    return 0;
-}
-
-int
-BMF_adjust_kerning(unsigned char first, unsigned char second, bm_font* font) {
-    const bm_kern_pair* kern_pairs = font->chars[first].kerns;
-    if (kern_pairs) {
-        do {
-            if (kern_pairs->second == second) {
-                return kern_pairs->amount;
-            }
-        } while ((unsigned char)(kern_pairs++)->first == first);
-    }
-    return 0;
-}
-
 /* Drawing */
 
 void
@@ -369,7 +38,7 @@ font_bmf_set_height_default(void) {
 
 void
 font_bmf_set_height(float height) {
-    current_scale = height / font_basilea.fontSize;
+    current_scale = height / font_basilea.font_size;
 }
 
 void
@@ -382,15 +51,51 @@ font_bmf_set_scale(float scale) {
 #define X_SCALE_16_9 (0.74941452f)
 static float X_SCALE;
 
+static draw_text_hdr font_header;
 #ifdef KOS_SPRITE
-static pvr_sprite_hdr_t font_header;
 #define VERT_PER_CHAR (1)
 #else
-static pvr_poly_hdr_t font_header;
 #define VERT_PER_CHAR (4)
 #endif
 static image font_texture;
 
+/* fontcompile output sits next to the texture as NAME.OMF, glyph table
+ * and texture in one file so it is one open and one read */
+static int
+font_bmf_load_omf(const char* texture, void* buffer) {
+    char path[128];
+    const char* ext = strrchr(texture, '.');
+    const int base = ext ? (int)(ext - texture) : (int)strlen(texture);
+    snprintf(path, sizeof(path), "/cd/%.*s.OMF", base, texture);
+
+    om_file file = om_file_open(path);
+    if (file == OM_FILE_INVALID) {
+        return 1;
+    }
+    const size_t size = om_file_size(file);
+    void* blob = pvr_get_internal_buffer();
+    if (!blob || size > PVR_INTERNAL_BUF_SIZE) {
+        LOG_ERROR("FONT:%s too big (%u)\n", path, (unsigned int)size);
+        om_file_close(file);
+        return 1;
+    }
+    const size_t got = om_file_read_at(file, 0, blob, size);
+    om_file_close(file);
+
+    /* Only the texture is wanted again after an aspect change */
+    const void* pvr;
+    size_t pvr_size;
+    if (omf_font_from_blob(blob, got, font_loaded ? NULL : &font_basilea, &pvr, &pvr_size)) {
+        LOG_ERROR("FONT:%s is not a valid OMF\n", path);
+        return 1;
+    }
+    font_loaded = 1;
+
+    font_texture.texture = load_pvr_from_buffer_to_buffer(pvr, &font_texture.width, &font_texture.height,
+                                                          &font_texture.format, buffer);
+    return 0;
+}
+
 /* Font prototype generics */
 int
 font_bmf_init(const char* fnt, const char* texture, int is_wide) {
@@ -400,16 +105,20 @@ font_bmf_init(const char* fnt, const char* texture, int is_wide) {
         X_SCALE = (X_SCALE_4_3);
     }
     int ret = 0;
-    char temp_fnt[128];
-    snprintf(temp_fnt, 127, "/cd/%s", fnt);
+    unsigned int temp = texman_create();
 
-    /* If we arent loaded then load eveyrthing, otherwise just load texture */
-    if (!font_loaded) {
-        ret += BMF_load(temp_fnt, &font_basilea);
+    if (font_bmf_load_omf(texture, texman_get_tex_data(temp))) {
+        /* Not converted, parse the .fnt and load the texture on its own */
+        if (!font_loaded) {
+            char temp_fnt[128];
+            snprintf(temp_fnt, 127, "/cd/%s", fnt);
+            ret += omf_font_from_fnt(temp_fnt, &font_basilea);
+            font_loaded = !ret;
+        }
+        draw_load_texture_buffer(texture, &font_texture, texman_get_tex_data(temp));
     }
-
-    unsigned int temp = texman_create();
-    draw_load_texture_buffer(texture, &font_texture, texman_get_tex_data(temp));
+    /* Runs hold positions scaled for the old aspect */
+    glyph_cache_clear(GLYPH_FONT_BMF);
     texman_reserve_memory(font_texture.width, font_texture.height, 2 /* 16Bit */);
 
     return ret;
@@ -450,41 +159,41 @@ font_bmf_begin_draw(void) {
     pvr_poly_compile(&font_header, &tmp);
 #endif
     font_bmf_set_height_default();
-    pvr_prim(&font_header, sizeof(font_header));
+    draw_text_header(&font_header);
     current_color = PVR_PACK_ARGB(0xff, 0xff, 0xff, 0xff);
 }
 
-#define BUFFER_MAX_CHARS (128)
-#ifdef KOS_SPRITE
-static pvr_sprite_txr_t charbuf[BUFFER_MAX_CHARS * VERT_PER_CHAR] __attribute__((aligned(32)));
-#else
-static pvr_vertex_t charbuf[BUFFER_MAX_CHARS * VERT_PER_CHAR] __attribute__((aligned(32)));
-#endif
-static int charbuffered;
+_Static_assert(GLYPH_RUN_QUADS * VERT_PER_CHAR <= DRAW_TEXT_VERTS, "glyph run larger than the text buffer");
 
-/* Draws a font letter using two triangle strips */
+/* Where a letter lands at x, y and its texture coords, returns the advance */
 static int
-font_bmf_draw_char(int x, int y, unsigned char chr) {
-    bm_font* font = &font_basilea;
+font_bmf_layout_char(int x, int y, unsigned char chr, glyph_quad* quad) {
+    const omf_glyph* glyph = &font_basilea.glyphs[chr];
 
     /* Upper left */
-    const float x1 = round(x + (current_scale * (float)font->chars[chr].xoffset) * X_SCALE);
-    const float y1 = round(y + current_scale * (float)font->chars[chr].yoffset);
-    const float u1 = (float)font->chars[chr].x / (float)font->width;
-    const float v1 = (float)font->chars[chr].y / (float)font->height;
+    quad->x1 = round(x + (current_scale * (float)glyph->xoffset) * X_SCALE);
+    quad->y1 = round(y + current_scale * (float)glyph->yoffset);
+    quad->u1 = glyph->u1;
+    quad->v1 = glyph->v1;
 
     /* Lower right */
-    const float x2 = round(x + (current_scale * ((float)font->chars[chr].width + font->chars[chr].xoffset)) * X_SCALE);
-    const float y2 = round(y + current_scale * ((float)font->chars[chr].height + font->chars[chr].yoffset));
-    const float u2 = (float)(font->chars[chr].x + font->chars[chr].width) / (float)font->width;
-    const float v2 = (float)(font->chars[chr].y + font->chars[chr].height) / (float)font->height;
+    quad->x2 = round(x + (current_scale * ((float)glyph->width + glyph->xoffset)) * X_SCALE);
+    quad->y2 = round(y + current_scale * ((float)glyph->height + glyph->yoffset));
+    quad->u2 = glyph->u2;
+    quad->v2 = glyph->v2;
 
-    const float z = z_get();
+    return (current_scale * glyph->xadvance) * X_SCALE;
+}
 
-    if (charbuffered > BUFFER_MAX_CHARS) {
-        pvr_prim(charbuf, charbuffered * sizeof(charbuf[0]));
-        charbuffered = 0;
-    }
+/* Draws a font letter using two triangle strips */
+static int
+font_bmf_draw_char(int x, int y, unsigned char chr) {
+    glyph_quad quad;
+    const int advance = font_bmf_layout_char(x, y, chr, &quad);
+    const float x1 = quad.x1, y1 = quad.y1;
+    const float x2 = quad.x2, y2 = quad.y2;
+
+    const float z = z_get();
 
 #ifdef KOS_SPRITE
     pvr_sprite_txr_t vert = {
@@ -504,18 +213,20 @@ font_bmf_draw_char(int x, int y, unsigned char chr) {
         /* interpolatied */
         .dx = x1,
         .dy = y2,
-        .auv = PVR_PACK_16BIT_UV(u1, v1), /* UVS */
-        .buv = PVR_PACK_16BIT_UV(u2, v1), /* UVS */
-        .cuv = PVR_PACK_16BIT_UV(u2, v2), /* UVS */
+        .auv = font_basilea.glyphs[chr].uv_a, /* UVS */
+        .buv = font_basilea.glyphs[chr].uv_b, /* UVS */
+        .cuv = font_basilea.glyphs[chr].uv_c, /* UVS */
     };
 
-    charbuf[charbuffered] = vert;
+    *draw_text_reserve(VERT_PER_CHAR) = vert;
 #else
+    const float u1 = quad.u1, v1 = quad.v1;
+    const float u2 = quad.u2, v2 = quad.v2;
     pvr_vertex_t *vert1, *vert2, *vert3, *vert4;
-    vert1 = &charbuf[charbuffered + 0];
-    vert2 = &charbuf[charbuffered + 1];
-    vert3 = &charbuf[charbuffered + 2];
-    vert4 = &charbuf[charbuffered + 3];
+    vert1 = draw_text_reserve(VERT_PER_CHAR);
+    vert2 = vert1 + 1;
+    vert3 = vert1 + 2;
+    vert4 = vert1 + 3;
 
     vert1->flags = PVR_CMD_VERTEX;
     vert1->x = x1;
@@ -553,47 +264,92 @@ font_bmf_draw_char(int x, int y, unsigned char chr) {
     vert4->argb = current_color;
     vert4->oargb = 0;
 #endif
-    charbuffered += VERT_PER_CHAR;
 
-    return (current_scale * font->chars[chr].xadvance) * X_SCALE;
+    return advance;
 }
 
+#ifndef KOS_SPRITE
+/* Lays the span out from 0, 0 the same way _font_bmf_draw_span places it */
 static void
-_font_bmf_draw_string(int x1, int y1, uint32_t color, const char* str) {
+_font_bmf_layout_run(glyph_run* run, const char* str, int len) {
+    glyph_quad quad;
+    int x1 = 0;
+
+    unsigned char prev = 0;
+    for (int i = 0; i < len; i++) {
+        unsigned char chr = str[i];
+        if (chr != ' ') {
+            x1 += round(current_scale * omf_font_kerning(&font_basilea, prev, chr));
+            x1 += font_bmf_layout_char(x1, 0, chr, &quad);
+            glyph_run_add(run, &quad);
+        } else {
+            x1 += round(current_scale * (float)font_basilea.glyphs[' '].width);
+        }
+
+        prev = chr;
+    }
+}
+#endif
+
+/* Draws the first len letters of str at depth z */
+static void
+_font_bmf_draw_span(int x1, int y1, float z, uint32_t color, const char* str, int len) {
     current_color = color;
-    charbuffered = 0;
-    z_inc();
+
+    if (len <= 0) {
+        return;
+    }
+
+#ifndef KOS_SPRITE
+    /* Most strings on screen are the same as last frame, only move them */
+    glyph_key key;
+    glyph_key_make_n(&key, GLYPH_FONT_BMF, current_scale, X_SCALE, str, len);
+    glyph_run* run = glyph_run_find(&key);
+    if (!run && (run = glyph_run_create(&key))) {
+        _font_bmf_layout_run(run, str, len);
+    }
+    if (run) {
+        glyph_run_emit(run, x1, y1, z, color, draw_text_reserve(glyph_run_verts(run)));
+        return;
+    }
+#else
+    (void)z;
+#endif
 
     unsigned char prev = 0;
-    do {
-        unsigned char chr = *str;
+    for (int i = 0; i < len; i++) {
+        unsigned char chr = str[i];
         if (chr != ' ') {
             /* Add possible kerning adjustment */
-            x1 += round(current_scale * BMF_adjust_kerning(prev, chr, &font_basilea));
+            x1 += round(current_scale * omf_font_kerning(&font_basilea, prev, chr));
             x1 += font_bmf_draw_char(x1, y1, chr);
         } else {
-            x1 += round(current_scale * (float)font_basilea.chars[' '].width);
+            x1 += round(current_scale * (float)font_basilea.glyphs[' '].width);
         }
 
         prev = chr;
-    } while (*++str);
+    }
+}
 
-    pvr_prim(charbuf, charbuffered * sizeof(charbuf[0]));
+static void
+_font_bmf_draw_string(int x1, int y1, uint32_t color, const char* str) {
+    const float z = z_inc();
+    _font_bmf_draw_span(x1, y1, z, color, str, strlen(str));
 }
 
 static float
 _font_bmf_calculate_length_full(const char* str, int length) {
     /* Not sure if its worth calculating kerning for this */
     float width = 0;
-    char prev = 0;
-    bm_font* font = &font_basilea;
+    unsigned char prev = 0;
+    omf_font* font = &font_basilea;
     int cursor = 0;
 
     while (*str && cursor++ < length) {
-        int chr = *str;
+        unsigned char chr = *str;
         /* Add possible kerning adjustment */
-        width += BMF_adjust_kerning(prev, chr, &font_basilea); /* slow */
-        width += font->chars[chr].xadvance;
+        width += omf_font_kerning(&font_basilea, prev, chr);
+        width += font->glyphs[chr].xadvance;
 
         prev = chr;
         str++;
@@ -602,9 +358,87 @@ _font_bmf_calculate_length_full(const char* str, int length) {
     return round(current_scale * round(width)) * X_SCALE;
 }
 
+/* Centered and auto sized strings are measured every frame, keep the result */
 static float
 _font_bmf_calculate_length(const char* str) {
-    return _font_bmf_calculate_length_full(str, strlen(str));
+    glyph_key key;
+    glyph_key_make(&key, GLYPH_FONT_BMF, current_scale, X_SCALE, str);
+    glyph_layout* layout = glyph_layout_find(&key, 0);
+    if (layout) {
+        return layout->width;
+    }
+
+    const float width = _font_bmf_calculate_length_full(str, key.len);
+    if ((layout = glyph_layout_create(&key, 0))) {
+        layout->width = width;
+    }
+    return width;
+}
+
+/* Greedy line breaks for str at the current scale, longest run of words that
+ * fits in width per line. A word wider than a line is broken where it runs out */
+static const glyph_layout*
+_font_bmf_layout_wrap(const char* str, int width) {
+    glyph_key key;
+    glyph_key_make(&key, GLYPH_FONT_BMF, current_scale, X_SCALE, str);
+    /* wrap_width 0 is a plain measurement */
+    const int wrap_width = (width > 0) ? width : -1;
+    glyph_layout* layout = glyph_layout_find(&key, wrap_width);
+    if (layout) {
+        return layout;
+    }
+    layout = glyph_layout_create(&key, wrap_width);
+    if (!layout) {
+        return NULL;
+    }
+
+    const int text_end = key.len;
+    int line_start = 0;
+
+    while (line_start < text_end && layout->num_lines < GLYPH_LAYOUT_LINES) {
+        float line_width = 0.0f;
+        unsigned char prev = ' ';
+        int line_len = 0;
+        int line_break = -1;
+
+        do {
+            const int pos = line_start + line_len;
+            if (pos >= text_end) {
+                line_break = text_end;
+                break;
+            }
+            const unsigned char chr = str[pos];
+            if (chr == ' ') {
+                line_break = pos;
+            }
+            if (chr == '\n') {
+                /* not space but safe breaking point */
+                line_break = pos;
+                break;
+            }
+            line_width += (int)((current_scale * font_basilea.glyphs[chr].xadvance) * X_SCALE);
+            line_width += round(current_scale * omf_font_kerning(&font_basilea, prev, chr));
+            prev = chr;
+            line_len++;
+        } while (line_width < width);
+
+        glyph_line* line = &layout->lines[layout->num_lines++];
+        line->start = line_start;
+        if (line_break >= 0) {
+            line->len = line_break - line_start;
+            line_start = line_break + 1;
+        } else {
+            /* No space on this line, keep what fit */
+            line->len = (line_len > 1) ? line_len - 1 : 1;
+            line_start += line->len;
+        }
+    }
+    return layout;
+}
+
+void
+font_bmf_layout_sub_wrap(const char* str, int width) {
+    _font_bmf_layout_wrap(str, width);
 }
 
 void
@@ -656,65 +490,16 @@ font_bmf_draw_sub(int x1, int y1, uint32_t color, const char* str) {
 
 void
 font_bmf_draw_sub_wrap(int x1, int y1, uint32_t color, const char* str, int width) {
-    z_inc();
-    current_color = color;
-    unsigned char prev = ' ';
-    unsigned int current_char = 0;
-
-    const int x_start = x1;
-    const char* text_end = strrchr(str, '\0');
-    const char* current_text_start = str;
-    const char* current_text_temp = str;
-    const char* last_known_space = str;
-    int current_text_len = 0;
-
-    do {
-        /* Try to find longest string broken by spaces that will fit in width */
-        float current_text_width = 0.0f;
-        prev = ' ';
-        do {
-            current_char = *(current_text_start + current_text_len);
-            if (current_char == ' ') {
-                last_known_space = current_text_start + current_text_len;
-            }
-            if (current_char == '\n') {
-                /* not space but safe breaking point */
-                last_known_space = current_text_start + current_text_len;
-                break;
-            }
-            if (current_text_start + current_text_len >= text_end) {
-                last_known_space = text_end;
-                break;
-            }
-            current_text_width += (int)((current_scale * font_basilea.chars[current_char].xadvance) * X_SCALE);
-            current_text_width += round(current_scale * BMF_adjust_kerning(prev, current_char, &font_basilea));
-            prev = current_char;
-            current_text_len++;
-        } while (current_text_width < width);
-
-        current_text_temp = current_text_start;
-        charbuffered = 0;
-        prev = 0;
-
-        do {
-            unsigned char chr = (*current_text_temp++);
-            if (chr != ' ') {
-                /* Add possible kerning adjustment */
-                x1 += round(current_scale * BMF_adjust_kerning(prev, chr, &font_basilea));
-                x1 += font_bmf_draw_char(x1, y1, chr);
-            } else {
-                x1 += round(current_scale * (float)font_basilea.chars[' '].width);
-            }
-            prev = chr;
-        } while (current_text_temp < last_known_space);
+    const float z = z_inc();
+    const glyph_layout* layout = _font_bmf_layout_wrap(str, width);
+    if (!layout) {
+        return;
+    }
 
-        pvr_prim(charbuf, charbuffered * sizeof(charbuf[0]));
+    for (uint32_t i = 0; i < layout->num_lines; i++) {
+        _font_bmf_draw_span(x1, y1, z, color, str + layout->lines[i].start, layout->lines[i].len);
 
         /* prepare for next row */
-        y1 += (current_scale * font_basilea.lineHeight * 1.2f /* Makes Text more natural */);
-        x1 = x_start;
-        current_text_start = last_known_space + 1;
-        current_text_len = 0;
-        prev = 0;
-    } while (current_text_start < text_end);
+        y1 += (current_scale * font_basilea.line_height * 1.2f /* Makes Text more natural */);
+    }
 }
@@ -0,0 +1,198 @@
+/*
+ * File: glyph_cache.c
+ * Project: ui
+ * File Created: Monday, 19th October 2026 9:26:40 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include <arena.h>
+#include <profiler.h>
+#include "ui/dc/glyph_cache.h"
+
+struct glyph_run {
+    glyph_key key;
+    uint32_t last_used; /* 0 when free */
+    uint32_t num_quads;
+    glyph_quad quads[GLYPH_RUN_QUADS];
+};
+
+static glyph_run* runs = NULL;
+static glyph_layout* layouts = NULL;
+static uint32_t glyph_clock = 0;
+
+void
+glyph_key_make(glyph_key* key, GLYPH_FONT font, float scale, float x_scale, const char* str) {
+    glyph_key_make_n(key, font, scale, x_scale, str, strlen(str));
+}
+
+void
+glyph_key_make_n(glyph_key* key, GLYPH_FONT font, float scale, float x_scale, const char* str, uint32_t len) {
+    /* FNV-1a */
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const unsigned char* c = (const unsigned char*)str;
+    for (uint32_t i = 0; i < len; i++) {
+        hash = (hash ^ c[i]) * 0x100000001b3ull;
+    }
+    key->hash = hash;
+    key->len = len;
+    key->font = font;
+    key->scale = scale;
+    key->x_scale = x_scale;
+}
+
+static int
+glyph_key_equal(const glyph_key* a, const glyph_key* b) {
+    return a->hash == b->hash && a->len == b->len && a->font == b->font && a->scale == b->scale
+           && a->x_scale == b->x_scale;
+}
+
+glyph_run*
+glyph_run_find(const glyph_key* key) {
+    if (!runs) {
+        return NULL;
+    }
+    for (int i = 0; i < GLYPH_RUNS; i++) {
+        if (runs[i].last_used && glyph_key_equal(&runs[i].key, key)) {
+            runs[i].last_used = ++glyph_clock;
+            PROF_COUNT(GLYPH_HIT);
+            return &runs[i];
+        }
+    }
+    return NULL;
+}
+
+glyph_run*
+glyph_run_create(const glyph_key* key) {
+    PROF_COUNT(GLYPH_MISS);
+    if (key->len > GLYPH_RUN_QUADS) {
+        return NULL;
+    }
+    if (!runs) {
+        runs = arena_calloc(ARENA_FONT, GLYPH_RUNS, sizeof(glyph_run));
+        if (!runs) {
+            return NULL;
+        }
+    }
+
+    glyph_run* victim = &runs[0];
+    for (int i = 0; i < GLYPH_RUNS && victim->last_used; i++) {
+        if (runs[i].last_used < victim->last_used) {
+            victim = &runs[i];
+        }
+    }
+    victim->key = *key;
+    victim->last_used = ++glyph_clock;
+    victim->num_quads = 0;
+    return victim;
+}
+
+void
+glyph_run_add(glyph_run* run, const glyph_quad* quad) {
+    if (run->num_quads < GLYPH_RUN_QUADS) {
+        run->quads[run->num_quads++] = *quad;
+    }
+}
+
+int
+glyph_run_verts(const glyph_run* run) {
+    return run->num_quads * 4;
+}
+
+int
+glyph_run_emit(const glyph_run* run, float x, float y, float z, uint32_t color, pvr_vertex_t* out) {
+    for (uint32_t i = 0; i < run->num_quads; i++) {
+        const glyph_quad* quad = &run->quads[i];
+        const float x1 = x + quad->x1;
+        const float y1 = y + quad->y1;
+        const float x2 = x + quad->x2;
+        const float y2 = y + quad->y2;
+        pvr_vertex_t* vert = &out[i * 4];
+
+        vert[0].flags = PVR_CMD_VERTEX;
+        vert[0].x = x1;
+        vert[0].y = y2;
+        vert[0].u = quad->u1;
+        vert[0].v = quad->v2;
+
+        vert[1].flags = PVR_CMD_VERTEX;
+        vert[1].x = x1;
+        vert[1].y = y1;
+        vert[1].u = quad->u1;
+        vert[1].v = quad->v1;
+
+        vert[2].flags = PVR_CMD_VERTEX;
+        vert[2].x = x2;
+        vert[2].y = y2;
+        vert[2].u = quad->u2;
+        vert[2].v = quad->v2;
+
+        vert[3].flags = PVR_CMD_VERTEX_EOL;
+        vert[3].x = x2;
+        vert[3].y = y1;
+        vert[3].u = quad->u2;
+        vert[3].v = quad->v1;
+
+        for (int v = 0; v < 4; v++) {
+            vert[v].z = z;
+            vert[v].argb = color;
+            vert[v].oargb = 0;
+        }
+    }
+    return run->num_quads * 4;
+}
+
+glyph_layout*
+glyph_layout_find(const glyph_key* key, int wrap_width) {
+    if (!layouts) {
+        return NULL;
+    }
+    for (int i = 0; i < GLYPH_LAYOUTS; i++) {
+        if (layouts[i].last_used && layouts[i].wrap_width == wrap_width && glyph_key_equal(&layouts[i].key, key)) {
+            layouts[i].last_used = ++glyph_clock;
+            return &layouts[i];
+        }
+    }
+    return NULL;
+}
+
+glyph_layout*
+glyph_layout_create(const glyph_key* key, int wrap_width) {
+    if (!layouts) {
+        layouts = arena_calloc(ARENA_FONT, GLYPH_LAYOUTS, sizeof(glyph_layout));
+        if (!layouts) {
+            return NULL;
+        }
+    }
+
+    glyph_layout* victim = &layouts[0];
+    for (int i = 0; i < GLYPH_LAYOUTS && victim->last_used; i++) {
+        if (layouts[i].last_used < victim->last_used) {
+            victim = &layouts[i];
+        }
+    }
+    victim->key = *key;
+    victim->wrap_width = wrap_width;
+    victim->last_used = ++glyph_clock;
+    victim->width = 0.0f;
+    victim->num_lines = 0;
+    return victim;
+}
+
+void
+glyph_cache_clear(GLYPH_FONT font) {
+    for (int i = 0; runs && i < GLYPH_RUNS; i++) {
+        if (runs[i].key.font == font) {
+            runs[i].last_used = 0;
+        }
+    }
+    for (int i = 0; layouts && i < GLYPH_LAYOUTS; i++) {
+        if (layouts[i].key.font == font) {
+            layouts[i].last_used = 0;
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * File: glyph_cache.h
+ * Project: ui
+ * File Created: Monday, 19th October 2026 9:26:40 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <dc/pvr.h>
+
+/* Laid out strings kept between frames. A run is the glyph quads of one
+ * string relative to where it starts, keyed on the string, the font and the
+ * scale it was laid out at. Drawing it again only adds the position, depth
+ * and colour. Runs live in one block out of ARENA_FONT, the least recently
+ * drawn one is reused when they are all taken */
+
+#define GLYPH_RUNS      (48)
+#define GLYPH_RUN_QUADS (64) /* longer strings are laid out every time */
+
+/* Measured strings, same key plus the width they were wrapped to. Widths for
+ * centering and auto sizing and the line breaks of wrapped text, so neither
+ * is worked out again while the string stays on screen */
+#define GLYPH_LAYOUTS      (32)
+#define GLYPH_LAYOUT_LINES (32) /* lines past this are not drawn */
+
+typedef enum GLYPH_FONT {
+    GLYPH_FONT_BMF = 0,
+    GLYPH_FONT_BMP,
+} GLYPH_FONT;
+
+typedef struct glyph_quad {
+    float x1, y1, x2, y2;
+    float u1, v1, u2, v2;
+} glyph_quad;
+
+typedef struct glyph_key {
+    uint64_t hash;
+    uint32_t len;
+    GLYPH_FONT font;
+    float scale;
+    float x_scale;
+} glyph_key;
+
+typedef struct glyph_run glyph_run;
+
+typedef struct glyph_line {
+    uint16_t start; /* offset into the string */
+    uint16_t len;
+} glyph_line;
+
+typedef struct glyph_layout {
+    glyph_key key;
+    int wrap_width; /* 0 when only measured */
+    uint32_t last_used;
+    float width;
+    uint32_t num_lines;
+    glyph_line lines[GLYPH_LAYOUT_LINES];
+} glyph_layout;
+
+void glyph_key_make(glyph_key* key, GLYPH_FONT font, float scale, float x_scale, const char* str);
+/* Key for the first len bytes of str */
+void glyph_key_make_n(glyph_key* key, GLYPH_FONT font, float scale, float x_scale, const char* str, uint32_t len);
+/* NULL on a miss */
+glyph_run* glyph_run_find(const glyph_key* key);
+/* Empty run to lay the string out into, NULL if it is too long to keep */
+glyph_run* glyph_run_create(const glyph_key* key);
+void glyph_run_add(glyph_run* run, const glyph_quad* quad);
+/* Vertices glyph_run_emit writes for run */
+int glyph_run_verts(const glyph_run* run);
+/* Writes the run out as strips starting at x, y, returns the vertices written */
+int glyph_run_emit(const glyph_run* run, float x, float y, float z, uint32_t color, pvr_vertex_t* out);
+/* NULL on a miss */
+glyph_layout* glyph_layout_find(const glyph_key* key, int wrap_width);
+/* Empty layout for the caller to fill, NULL only when out of memory */
+glyph_layout* glyph_layout_create(const glyph_key* key, int wrap_width);
+
+/* Drops every run and layout of font, its texture or metrics changed */
+void glyph_cache_clear(GLYPH_FONT font);
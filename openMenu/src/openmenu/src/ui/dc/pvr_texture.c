@@ -85,7 +85,8 @@ pvr_get_texture_size(const void* input, uint32_t* w, uint32_t* h, uint32_t* txrF
         default: texFormat = PVR_TXRFMT_NONE; break;
     }
 
-    const int txr_size = texW * texH * bpp;
+    /* 4bpp packs two texels per byte */
+    const int txr_size = (texColor == PVR_TXRFMT_PAL4BPP) ? (texW * texH / 2) : (texW * texH * bpp);
     *w = texW;
     *h = texH;
     *txrFormat = texFormat | texColor;
@@ -130,7 +131,7 @@ load_pvr_from_buffer(const void* input, uint32_t* w, uint32_t* h, uint32_t* txrF
 void*
 pvr_get_internal_buffer(void) {
     if (!_internal_buf) {
-        _internal_buf = malloc(512 * 512 * 2 + PVR_HDR_SIZE);
+        _internal_buf = malloc(PVR_INTERNAL_BUF_SIZE);
         if (!_internal_buf) {
             /* printf("%s no free memory\n", __func__); */
             return NULL;
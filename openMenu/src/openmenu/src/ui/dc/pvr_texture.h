@@ -20,6 +20,8 @@ typedef struct image {
     pvr_ptr_t texture;
 } image;
 
+/* Scratch for file reads before upload, fits a 512x512 16bit PVR */
+#define PVR_INTERNAL_BUF_SIZE (512 * 512 * 2 + 0x20)
 void* pvr_get_internal_buffer(void);
 /* Convenience functions */
 extern pvr_ptr_t load_pvr(const char* filename, uint32_t* w, uint32_t* h, uint32_t* txrFormat);
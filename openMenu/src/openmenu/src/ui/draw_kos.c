@@ -11,21 +11,383 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 
+#define LOG_MODULE UI
 #include <backend/dat_format.h>
+#include <dbgprint.h>
+#include <profiler.h>
 #include "ui/draw_prototypes.h"
 #include "ui/font_prototypes.h"
 
 #include "ui/draw_kos.h"
+#include "texture/pal_bank.h"
 
 image img_empty_boxart;
 image img_dir_boxart;
 
 static int current_list;
 
+static draw_text_vert text_verts[DRAW_TEXT_VERTS] __attribute__((aligned(32)));
+static int num_text_verts = 0;
+static draw_text_hdr text_hdr __attribute__((aligned(32)));
+static int text_hdr_set = 0;
+static int text_hdr_sent = 0; /* nothing else has gone to the TA since it */
+
+static void draw_text_flush(void);
+
+/* Quads are held here and go to the TA on draw_flush, one header and one
+ * vertex burst for every run of quads sharing a header. Compiled headers are
+ * cached across frames by texture, format, filter and list. The opaque list
+ * is depth tested so its quads are grouped by header. The translucent list is
+ * autosorted by the PVR, so it keeps the order things were drawn in and only
+ * merges neighbours: every draw takes a new z from z_inc, so depth order is
+ * draw order, and quads on the same z are blended in the order sent */
+#ifndef KOS_SPRITE
+#define DRAW_MAX_QUADS     (128)
+#define DRAW_HDR_CACHE     (32)
+#define DRAW_VERT_PER_QUAD (4)
+
+typedef struct draw_hdr_entry {
+    pvr_poly_hdr_t hdr __attribute__((aligned(32)));
+    pvr_ptr_t texture; /* NULL when untextured */
+    uint32_t format;
+    uint32_t width;
+    uint32_t height;
+    int filter;
+    int list;
+    int pending; /* queued quads using it, not evicted while set */
+} draw_hdr_entry;
+
+static draw_hdr_entry hdr_cache[DRAW_HDR_CACHE] __attribute__((aligned(32)));
+static int hdr_cache_used = 0;
+static int hdr_cache_clock = 0;
+static int hdr_cache_last = -1;
+
+static pvr_vertex_t quad_verts[DRAW_MAX_QUADS * DRAW_VERT_PER_QUAD] __attribute__((aligned(32)));
+static pvr_vertex_t quad_sorted[DRAW_MAX_QUADS * DRAW_VERT_PER_QUAD] __attribute__((aligned(32)));
+static uint8_t quad_hdr[DRAW_MAX_QUADS];
+static uint8_t quad_sorted_hdr[DRAW_MAX_QUADS];
+static int num_quads = 0;
+
+static draw_list* recording = NULL;
+
+static int
+draw_quads_pending(void) {
+    return num_quads;
+}
+
+/* Into the display list being recorded, otherwise the TA. A recording that
+ * runs out of room sends what it has and stops, the draws still happen, and
+ * the list is not recorded again until it is invalidated */
+static void
+draw_emit(const void* data, size_t size, int headers, int verts) {
+    if (headers) {
+        text_hdr_sent = 0;
+    }
+    if (recording) {
+        if (recording->size + size <= DRAW_LIST_BYTES) {
+            memcpy(recording->buf + recording->size, data, size);
+            recording->size += size;
+            recording->headers += headers;
+            recording->verts += verts;
+            return;
+        }
+        LOG_WARN("%s display list full\n", __func__);
+        recording->full = 1;
+        pvr_prim(recording->buf, recording->size);
+        PROF_COUNT_N(DRAW_HDR, recording->headers);
+        PROF_COUNT_N(DRAW_VERT, recording->verts);
+        recording->size = 0;
+        recording = NULL;
+    }
+    pvr_prim((void*)data, size);
+    PROF_COUNT_N(DRAW_HDR, headers);
+    PROF_COUNT_N(DRAW_VERT, verts);
+}
+
+void
+draw_flush(void) {
+    draw_text_flush();
+    if (!num_quads) {
+        return;
+    }
+
+    const pvr_vertex_t* verts = quad_verts;
+    const uint8_t* hdrs = quad_hdr;
+    if (current_list == PVR_LIST_OP_POLY) {
+        /* Stable counting sort on the header slot */
+        int start[DRAW_HDR_CACHE + 1] = {0};
+        for (int i = 0; i < num_quads; i++) {
+            start[quad_hdr[i] + 1]++;
+        }
+        for (int i = 0; i < DRAW_HDR_CACHE; i++) {
+            start[i + 1] += start[i];
+        }
+        for (int i = 0; i < num_quads; i++) {
+            const int to = start[quad_hdr[i]]++;
+            memcpy(&quad_sorted[to * DRAW_VERT_PER_QUAD], &quad_verts[i * DRAW_VERT_PER_QUAD],
+                   DRAW_VERT_PER_QUAD * sizeof(pvr_vertex_t));
+            quad_sorted_hdr[to] = quad_hdr[i];
+        }
+        verts = quad_sorted;
+        hdrs = quad_sorted_hdr;
+    }
+
+    int run = 0;
+    for (int i = 1; i <= num_quads; i++) {
+        if (i < num_quads && hdrs[i] == hdrs[run]) {
+            continue;
+        }
+        const int count = (i - run) * DRAW_VERT_PER_QUAD;
+        draw_emit(&hdr_cache[hdrs[run]].hdr, sizeof(pvr_poly_hdr_t), 1, 0);
+        draw_emit(&verts[run * DRAW_VERT_PER_QUAD], count * sizeof(pvr_vertex_t), 0, count);
+        run = i;
+    }
+
+    for (int i = 0; i < hdr_cache_used; i++) {
+        hdr_cache[i].pending = 0;
+    }
+    num_quads = 0;
+}
+
+/* Slot of the compiled header for this state, -1 if it cant be drawn */
+static int
+draw_hdr_get(pvr_ptr_t texture, uint32_t format, uint32_t width, uint32_t height, int filter) {
+    const int list = current_list;
+    if (hdr_cache_last >= 0) {
+        const draw_hdr_entry* entry = &hdr_cache[hdr_cache_last];
+        if (entry->texture == texture && entry->format == format && entry->width == width
+            && entry->height == height && entry->filter == filter && entry->list == list) {
+            return hdr_cache_last;
+        }
+    }
+    for (int i = 0; i < hdr_cache_used; i++) {
+        const draw_hdr_entry* entry = &hdr_cache[i];
+        if (entry->texture == texture && entry->format == format && entry->width == width
+            && entry->height == height && entry->filter == filter && entry->list == list) {
+            hdr_cache_last = i;
+            return i;
+        }
+    }
+
+    pvr_poly_cxt_t context;
+    if (texture) {
+        pvr_poly_cxt_txr(&context, list, format, width, height, texture, filter);
+        switch (context.txr.width) {
+            case 8:
+            case 16:
+            case 32:
+            case 64:
+            case 128:
+            case 256:
+            case 512:
+            case 1024: break;
+            default:
+                LOG_DEBUG("%s error tex size %d(%ld) %d(%ld)\n", __func__, context.txr.width, (long)width,
+                          context.txr.height, (long)height);
+                return -1;
+                break;
+        }
+    } else {
+        pvr_poly_cxt_col(&context, list);
+    }
+
+    /* Take a free slot, otherwise the next one round that nothing queued uses */
+    int slot = hdr_cache_used;
+    if (slot < DRAW_HDR_CACHE) {
+        hdr_cache_used++;
+    } else {
+        for (int tries = 0; tries < DRAW_HDR_CACHE && hdr_cache[hdr_cache_clock].pending; tries++) {
+            hdr_cache_clock = (hdr_cache_clock + 1) % DRAW_HDR_CACHE;
+        }
+        if (hdr_cache[hdr_cache_clock].pending) {
+            draw_flush();
+        }
+        slot = hdr_cache_clock;
+        hdr_cache_clock = (hdr_cache_clock + 1) % DRAW_HDR_CACHE;
+    }
+
+    draw_hdr_entry* entry = &hdr_cache[slot];
+    pvr_poly_compile(&entry->hdr, &context);
+    entry->texture = texture;
+    entry->format = format;
+    entry->width = width;
+    entry->height = height;
+    entry->filter = filter;
+    entry->list = list;
+    entry->pending = 0;
+    hdr_cache_last = slot;
+    PROF_COUNT(HDR_COMPILE);
+    return slot;
+}
+
+/* Four vertices to fill in as one strip, flushing first when full */
+static pvr_vertex_t*
+draw_quad_push(int hdr) {
+    if (num_quads == DRAW_MAX_QUADS) {
+        draw_flush();
+    }
+    hdr_cache[hdr].pending++;
+    quad_hdr[num_quads] = (uint8_t)hdr;
+    return &quad_verts[num_quads++ * DRAW_VERT_PER_QUAD];
+}
+
+static void
+draw_quad_verts(pvr_vertex_t* vert, float x1, float y1, float x2, float y2, float z, float u1, float v1, float u2,
+                float v2, uint32_t color) {
+    const float xs[DRAW_VERT_PER_QUAD] = {x1, x1, x2, x2};
+    const float ys[DRAW_VERT_PER_QUAD] = {y2, y1, y2, y1};
+    const float us[DRAW_VERT_PER_QUAD] = {u1, u1, u2, u2};
+    const float vs[DRAW_VERT_PER_QUAD] = {v2, v1, v2, v1};
+    for (int i = 0; i < DRAW_VERT_PER_QUAD; i++) {
+        vert[i].flags = (i == DRAW_VERT_PER_QUAD - 1) ? PVR_CMD_VERTEX_EOL : PVR_CMD_VERTEX;
+        vert[i].x = xs[i];
+        vert[i].y = ys[i];
+        vert[i].z = z;
+        vert[i].u = us[i];
+        vert[i].v = vs[i];
+        vert[i].argb = color;
+        vert[i].oargb = 0;
+    }
+}
+void
+draw_list_begin(draw_list* dl) {
+    draw_flush();
+    dl->size = 0;
+    dl->headers = 0;
+    dl->verts = 0;
+    dl->z_start = z_get();
+    dl->list = current_list;
+    dl->valid = 0;
+    if (!dl->full) {
+        recording = dl;
+    }
+}
+
+void
+draw_list_end(draw_list* dl) {
+    draw_flush();
+    if (recording != dl) {
+        /* Overflowed, already drawn and not kept */
+        return;
+    }
+    recording = NULL;
+    dl->z_end = z_get();
+    dl->valid = 1;
+    text_hdr_sent = 0;
+    pvr_prim(dl->buf, dl->size);
+    PROF_COUNT_N(DRAW_HDR, dl->headers);
+    PROF_COUNT_N(DRAW_VERT, dl->verts);
+}
+
+int
+draw_list_replay(draw_list* dl) {
+    if (!dl->valid || dl->list != current_list || dl->z_start != z_get()) {
+        return 1;
+    }
+    draw_flush();
+    text_hdr_sent = 0;
+    pvr_prim(dl->buf, dl->size);
+    PROF_COUNT_N(DRAW_HDR, dl->headers);
+    PROF_COUNT_N(DRAW_VERT, dl->verts);
+    z_set(dl->z_end);
+    return 0;
+}
+
+void
+draw_list_invalidate(draw_list* dl) {
+    dl->valid = 0;
+    dl->full = 0;
+}
+#else
+/* Sprites go straight to the TA, only text waits */
+static int
+draw_quads_pending(void) {
+    return 0;
+}
+
+static void
+draw_emit(const void* data, size_t size, int headers, int verts) {
+    if (headers) {
+        text_hdr_sent = 0;
+    }
+    pvr_prim((void*)data, size);
+    PROF_COUNT_N(DRAW_HDR, headers);
+    PROF_COUNT_N(DRAW_VERT, verts);
+}
+
+void
+draw_flush(void) {
+    draw_text_flush();
+}
+
+void
+draw_list_begin(draw_list* dl) {
+    (void)dl;
+}
+
+void
+draw_list_end(draw_list* dl) {
+    (void)dl;
+}
+
+int
+draw_list_replay(draw_list* dl) {
+    (void)dl;
+    return 1;
+}
+
+void
+draw_list_invalidate(draw_list* dl) {
+    (void)dl;
+}
+#endif
+
+static void
+draw_text_flush(void) {
+    if (!num_text_verts) {
+        return;
+    }
+    if (!text_hdr_sent) {
+        draw_emit(&text_hdr, sizeof(text_hdr), 1, 0);
+        text_hdr_sent = 1;
+    }
+    draw_emit(text_verts, num_text_verts * sizeof(draw_text_vert), 0, num_text_verts);
+    num_text_verts = 0;
+}
+
+void
+draw_text_header(const draw_text_hdr* hdr) {
+    /* Queued quads were drawn before the text that follows, they go first */
+    if (text_hdr_set && !draw_quads_pending() && !memcmp(&text_hdr, hdr, sizeof(text_hdr))) {
+        PROF_COUNT(TEXT_HDR_SHARED);
+        return;
+    }
+    draw_flush();
+    text_hdr = *hdr;
+    text_hdr_set = 1;
+    text_hdr_sent = 0;
+}
+
+draw_text_vert*
+draw_text_reserve(int verts) {
+    if (num_text_verts + verts > DRAW_TEXT_VERTS) {
+        draw_text_flush();
+    }
+    draw_text_vert* out = &text_verts[num_text_verts];
+    num_text_verts += verts;
+    return out;
+}
+
 void
 draw_set_list(int list) {
+    if (list != current_list) {
+        draw_flush();
+    }
     current_list = list;
+    /* Set before every pvr_list_begin, a new list has no header to share yet */
+    text_hdr_sent = 0;
 }
 
 int
@@ -80,6 +442,16 @@ draw_init(void) {
     pvr_scratch_buf = pvr_mem_malloc(TEXMAN_BUFFER_SIZE);
     texman_reset(pvr_scratch_buf, TEXMAN_BUFFER_SIZE);
 
+#ifndef KOS_SPRITE
+    num_quads = 0;
+    hdr_cache_used = 0;
+    hdr_cache_clock = 0;
+    hdr_cache_last = -1;
+#endif
+    num_text_verts = 0;
+    text_hdr_set = 0;
+    text_hdr_sent = 0;
+
     z_reset();
 }
 
@@ -138,11 +510,18 @@ draw_load_texture_buffer(const char* filename, void* user, void* buffer) {
 
 void*
 draw_load_texture_from_DAT_to_buffer(const struct dat_file* bin, const char* ID, void* user, void* buffer) {
+    return draw_load_texture_from_DAT_to_slot(bin, ID, user, buffer, -1);
+}
+
+void*
+draw_load_texture_from_DAT_to_slot(const struct dat_file* bin, const char* ID, void* user, void* buffer,
+                                   int pal_slot) {
     image* img = (image*)user;
     pvr_ptr_t txr;
+    uint32_t pal_select;
     int ret = DAT_read_file_by_ID(bin, ID, pvr_get_internal_buffer());
-    /* printf("DAT: read ID='%s' ret=%d\n", ID, ret); */
-    if (!ret) {
+    LOG_DEBUG("DAT: read ID='%s' ret=%d\n", ID, ret);
+    if (!ret || pal_bank_bind(pal_slot, pvr_get_internal_buffer(), &pal_select)) {
         img->texture = img_empty_boxart.texture;
         img->width = img_empty_boxart.width;
         img->height = img_empty_boxart.height;
@@ -152,7 +531,9 @@ draw_load_texture_from_DAT_to_buffer(const struct dat_file* bin, const char* ID,
 
     txr = load_pvr_from_buffer_to_buffer(pvr_get_internal_buffer(), &img->width, &img->height, &img->format, buffer);
     img->texture = txr;
-    /* printf("DAT: img w=%lu h=%lu fmt=%lu\n", img->width, img->height, img->format); */
+    img->format |= pal_select;
+    LOG_DEBUG("DAT: img w=%lu h=%lu fmt=%lu\n", (unsigned long)img->width, (unsigned long)img->height,
+              (unsigned long)img->format);
 
     return user;
 }
@@ -195,7 +576,8 @@ draw_draw_sub_image(int x, int y, float width, float height, uint32_t color, voi
                        PVR_FILTER_BILINEAR);
     pvr_sprite_compile(&header, &context);
 
-    pvr_prim(&header, sizeof(header));
+    draw_flush();
+    draw_emit(&header, sizeof(header), 1, 0);
 
     pvr_sprite_txr_t vert = {
         .flags = PVR_CMD_VERTEX_EOL, /* Always? */
@@ -218,62 +600,14 @@ draw_draw_sub_image(int x, int y, float width, float height, uint32_t color, voi
         .buv = PVR_PACK_16BIT_UV(u2, v1), /* UVS */
         .cuv = PVR_PACK_16BIT_UV(u2, v2), /* UVS */
     };
-    pvr_prim(&vert, sizeof(vert));
+    draw_emit(&vert, sizeof(vert), 0, 1);
 
 #else
-    pvr_poly_cxt_t context;
-    pvr_poly_hdr_t header;
-
-    pvr_poly_cxt_txr(&context, draw_get_list(), img->format, img->width, img->height, img->texture,
-                     PVR_FILTER_BILINEAR);
-    if (context.txr.enable != PVR_TEXTURE_DISABLE) {
-        switch (context.txr.width) {
-            case 8:
-            case 16:
-            case 32:
-            case 64:
-            case 128:
-            case 256:
-            case 512:
-            case 1024: break;
-            default:
-                /* printf("%s error tex size %d(%ld) %d(%ld)\n", __func__, context.txr.width, img->width,
-                       context.txr.height, img->height); */
-                return;
-                break;
-        }
+    const int hdr = draw_hdr_get(img->texture, img->format, img->width, img->height, PVR_FILTER_BILINEAR);
+    if (hdr < 0) {
+        return;
     }
-    pvr_poly_compile(&header, &context);
-
-    pvr_prim(&header, sizeof(header));
-
-    pvr_vertex_t vert = {.argb = color, .oargb = 0, .flags = PVR_CMD_VERTEX, .z = 1};
-
-    vert.x = x1;
-    vert.y = y2;
-    vert.z = z;
-    vert.u = u1;
-    vert.v = v2;
-    pvr_prim(&vert, sizeof(vert));
-
-    vert.x = x1;
-    vert.y = y1;
-    vert.u = u1;
-    vert.v = v1;
-    pvr_prim(&vert, sizeof(vert));
-
-    vert.x = x2;
-    vert.y = y2;
-    vert.u = u2;
-    vert.v = v2;
-    pvr_prim(&vert, sizeof(vert));
-
-    vert.flags = PVR_CMD_VERTEX_EOL;
-    vert.x = x2;
-    vert.y = y1;
-    vert.u = u2;
-    vert.v = v1;
-    pvr_prim(&vert, sizeof(vert));
+    draw_quad_verts(draw_quad_push(hdr), x1, y1, x2, y2, z, u1, v1, u2, v2, color);
 #endif
 }
 
@@ -299,7 +633,8 @@ draw_draw_quad(int x, int y, float width, float height, uint32_t color) {
 
     header.argb = color;
 
-    pvr_prim(&header, sizeof(header));
+    draw_flush();
+    draw_emit(&header, sizeof(header), 1, 0);
 
     pvr_sprite_col_t vert = {.flags = PVR_CMD_VERTEX_EOL, /* Always? */
                              /*  upper left */
@@ -318,52 +653,14 @@ draw_draw_quad(int x, int y, float width, float height, uint32_t color) {
                              .dx = x1,
                              .dy = y2};
 
-    pvr_prim(&vert, sizeof(vert));
+    draw_emit(&vert, sizeof(vert), 0, 1);
 
 #else
-    pvr_poly_cxt_t context;
-    pvr_poly_hdr_t header;
-
-    pvr_poly_cxt_col(&context, draw_get_list());
-    if (context.txr.enable != PVR_TEXTURE_DISABLE) {
-        switch (context.txr.width) {
-            case 8:
-            case 16:
-            case 32:
-            case 64:
-            case 128:
-            case 256:
-            case 512:
-            case 1024: break;
-            default:
-                /* printf("%s error tex size %d(%f) %d(%f)\n", __func__, context.txr.width, width, context.txr.height,
-                       height); */
-                return;
-                break;
-        }
+    const int hdr = draw_hdr_get(NULL, 0, 0, 0, PVR_FILTER_NONE);
+    if (hdr < 0) {
+        return;
     }
-    pvr_poly_compile(&header, &context);
-
-    pvr_prim(&header, sizeof(header));
-
-    pvr_vertex_t vert = {.argb = color, .oargb = 0, .flags = PVR_CMD_VERTEX, .z = z, .u = 0, .v = 0};
-
-    vert.x = x1;
-    vert.y = y2;
-    pvr_prim(&vert, sizeof(vert));
-
-    vert.x = x1;
-    vert.y = y1;
-    pvr_prim(&vert, sizeof(vert));
-
-    vert.x = x2;
-    vert.y = y2;
-    pvr_prim(&vert, sizeof(vert));
-
-    vert.flags = PVR_CMD_VERTEX_EOL;
-    vert.x = x2;
-    vert.y = y1;
-    pvr_prim(&vert, sizeof(vert));
+    draw_quad_verts(draw_quad_push(hdr), x1, y1, x2, y2, z, 0, 0, 0, 0, color);
 #endif
 }
 
@@ -24,6 +24,32 @@
     ((((uint8_t)((a))) << 24) | (((uint8_t)((r))) << 16) | (((uint8_t)((g))) << 8) | (((uint8_t)((b))) << 0))
 #endif
 
+/* Recorded TA stream of headers and vertices, see draw_list_begin. Sized for
+ * a few full screen layers */
+#define DRAW_LIST_BYTES (1024)
+
+typedef struct draw_list {
+    uint8_t buf[DRAW_LIST_BYTES] __attribute__((aligned(32)));
+    uint32_t size;
+    uint16_t headers;
+    uint16_t verts;
+    float z_start; /* replayed only from the same depth it was recorded at */
+    float z_end;
+    int list;
+    int valid;
+    int full; /* overflowed, drawn directly until draw_list_invalidate */
+} draw_list;
+
+/* Text vertices waiting for the TA, see draw_text_reserve */
+#define DRAW_TEXT_VERTS (512)
+#ifdef KOS_SPRITE
+typedef pvr_sprite_txr_t draw_text_vert;
+typedef pvr_sprite_hdr_t draw_text_hdr;
+#else
+typedef pvr_vertex_t draw_text_vert;
+typedef pvr_poly_hdr_t draw_text_hdr;
+#endif
+
 #define COLOR_WHITE    (0xFFFFFFFF) /*(PVR_PACK_ARGB(0xFF,0xFF,0xFF,0xFF))*/
 #define COLOR_BLACK    (0xFF000000) /*(PVR_PACK_ARGB(0xFF,0x00,0x00,0x00))*/
 #define COLOR_ORANGE_J (0xFFFAAA8F) /*(PVR_PACK_ARGB(0xFF,250,170,143))*/
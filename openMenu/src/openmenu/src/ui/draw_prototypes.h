@@ -34,6 +34,32 @@ void draw_init(void);
 /* called at the start of each frame */
 void draw_setup(void);
 
+/* Sends queued quads and text to the TA, needed before anything else submits directly
+ * and before the list is finished */
+void draw_flush(void);
+
+/* Text goes out in large bursts instead of one pvr_prim per string. A font
+ * sets its header, then reserves room for the vertices of each letter or run
+ * and writes them in place. They reach the TA when the buffer fills or on the
+ * next draw_flush, with the header sent again if something else was drawn
+ * in between. hdr is copied. Setting the header already in use is free, so
+ * every string on a screen with the same font and list shares one burst
+ * whatever its scale or vertex color, unless quads were queued since */
+void draw_text_header(const draw_text_hdr* hdr);
+/* verts is at most DRAW_TEXT_VERTS, the result is valid until the next call */
+draw_text_vert* draw_text_reserve(int verts);
+
+/* Display lists for layers that only change with the theme, aspect or UI.
+ * Draws between begin and end are recorded as well as drawn, replay sends the
+ * recording to the TA in one copy and returns 0, or nonzero when it has to
+ * be recorded again. A layer too big for DRAW_LIST_BYTES is drawn as it goes
+ * until draw_list_invalidate:
+ *   if (draw_list_replay(&bg)) { draw_list_begin(&bg); ...draws...; draw_list_end(&bg); } */
+void draw_list_begin(draw_list* dl);
+void draw_list_end(draw_list* dl);
+int draw_list_replay(draw_list* dl);
+void draw_list_invalidate(draw_list* dl);
+
 /* Controls which list we are drawing into */
 void draw_set_list(int list);
 int draw_get_list(void);
@@ -45,6 +71,9 @@ void* draw_load_texture(const char* filename, void* user);
 void* draw_load_texture_buffer(const char* filename, void* user, void* buffer);
 /* Loads from new DAT file using struct + ID of file requested */
 void* draw_load_texture_from_DAT_to_buffer(const struct dat_file* bin, const char* ID, void* user, void* buffer);
+/* Same as above, palettized textures get their palette bound to the given small pool slot */
+void* draw_load_texture_from_DAT_to_slot(const struct dat_file* bin, const char* ID, void* user, void* buffer,
+                                         int pal_slot);
 
 /* draws an image at coords of a given size */
 void draw_draw_image(int x, int y, float width, float height, uint32_t color, void* user);
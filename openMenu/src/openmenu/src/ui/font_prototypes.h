@@ -25,6 +25,8 @@ void font_bmf_draw(int x, int y, uint32_t color, const char* str);
 void font_bmf_draw_main(int x, int y, uint32_t color, const char* str);
 void font_bmf_draw_sub(int x, int y, uint32_t color, const char* str);
 void font_bmf_draw_sub_wrap(int x, int y, uint32_t color, const char* str, int width);
+/* Works out the line breaks font_bmf_draw_sub_wrap will use at the current height ahead of drawing */
+void font_bmf_layout_sub_wrap(const char* str, int width);
 void font_bmf_draw_auto_size(int x, int y, uint32_t color, const char* str, int width);
 void font_bmf_draw_centered(int x, int y, uint32_t color, const char* str);
 void font_bmf_draw_centered_auto_size(int x, int y, uint32_t color, const char* str, int width);
@@ -0,0 +1,120 @@
+/*
+ * File: input_control.c
+ * Project: ui
+ * File Created: Tuesday, 20th October 2026 10:42:06 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <dc/maple/keyboard.h>
+
+#include "ui/common.h"
+#include "ui/dc/input.h"
+
+#include "ui/input_control.h"
+
+int
+input_control(void) {
+    /* D-Pad directions */
+    if (INPT_DPADDirection(DPAD_LEFT)) {
+        return LEFT;
+    }
+    if (INPT_DPADDirection(DPAD_RIGHT)) {
+        return RIGHT;
+    }
+    if (INPT_DPADDirection(DPAD_UP)) {
+        return UP;
+    }
+    if (INPT_DPADDirection(DPAD_DOWN)) {
+        return DOWN;
+    }
+
+    /* Analog stick */
+    if (INPT_AnalogI(AXES_X) < 128 - 24) {
+        return LEFT;
+    }
+    if (INPT_AnalogI(AXES_X) > 128 + 24) {
+        return RIGHT;
+    }
+
+    if (INPT_AnalogI(AXES_Y) < 128 - 24) {
+        return UP;
+    }
+    if (INPT_AnalogI(AXES_Y) > 128 + 24) {
+        return DOWN;
+    }
+
+    /* Buttons - use edge detection (BTN_PRESS) for A, B, Y, START to prevent
+     * double-press bugs when transitioning between UI states. X keeps hold
+     * detection for grid mode artwork zoom feature. */
+    if (INPT_ButtonEx(BTN_A, BTN_PRESS)) {
+        return A;
+    }
+    if (INPT_ButtonEx(BTN_B, BTN_PRESS)) {
+        return B;
+    }
+    if (INPT_Button(BTN_X)) {
+        return X;
+    }
+    if (INPT_ButtonEx(BTN_Y, BTN_PRESS)) {
+        return Y;
+    }
+    if (INPT_ButtonEx(BTN_START, BTN_PRESS)) {
+        return START;
+    }
+
+    /* Triggers */
+    if (INPT_TriggerPressed(TRIGGER_L)) {
+        return TRIG_L;
+    }
+    if (INPT_TriggerPressed(TRIGGER_R)) {
+        return TRIG_R;
+    }
+
+    /* Keyboard support - skip if no keys pressed */
+    if (!INPT_KeyboardNone()) {
+        /* Check if Shift is held — if so, skip letter/number button mappings
+         * so the UI quick-jump feature (Shift+Letter/Number) works without
+         * also triggering the action mapped to that key. */
+        uint8_t mods = INPT_KeyboardModifiers();
+        bool shift_held = (mods & KBD_MOD_LSHIFT) || (mods & KBD_MOD_RSHIFT);
+
+        /* Arrow keys → D-Pad (always active, even with Shift) */
+        if (INPT_KeyboardButton(KBD_KEY_LEFT)) {
+            return LEFT;
+        }
+        if (INPT_KeyboardButton(KBD_KEY_RIGHT)) {
+            return RIGHT;
+        }
+        if (INPT_KeyboardButton(KBD_KEY_UP)) {
+            return UP;
+        }
+        if (INPT_KeyboardButton(KBD_KEY_DOWN)) {
+            return DOWN;
+        }
+
+        if (!shift_held) {
+            /* Letter keys → button mappings (disabled when Shift held for quick-jump) */
+            if (INPT_KeyboardButtonPress(KBD_KEY_Z)) { return A; }
+            if (INPT_KeyboardButtonPress(KBD_KEY_X)) { return B; }
+            if (INPT_KeyboardButton(KBD_KEY_A))      { return X; }
+            if (INPT_KeyboardButtonPress(KBD_KEY_S)) { return Y; }
+            if (INPT_KeyboardButton(KBD_KEY_Q))      { return TRIG_L; }
+            if (INPT_KeyboardButton(KBD_KEY_W))      { return TRIG_R; }
+        }
+
+        /* Non-letter keys → button mappings (always active, not quick-jump targets) */
+        if (INPT_KeyboardButtonPress(KBD_KEY_SPACE))  { return A; }
+        if (INPT_KeyboardButtonPress(KBD_KEY_ESCAPE)) { return B; }
+        if (INPT_KeyboardButtonPress(KBD_KEY_ENTER))  { return START; }
+        if (INPT_KeyboardButton(KBD_KEY_PGUP))        { return TRIG_L; }
+        if (INPT_KeyboardButton(KBD_KEY_PGDOWN))      { return TRIG_R; }
+    }
+
+    return NONE;
+}
@@ -0,0 +1,16 @@
+/*
+ * File: input_control.h
+ * Project: ui
+ * File Created: Tuesday, 20th October 2026 10:42:06 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+/* The enum control a UI's handle_input gets for this frame, picked from
+ * whatever was last given to INPT_ReceiveFromHost. Maple polling and a
+ * replayed input_script both end up here, so both drive the menus alike */
+int input_control(void);
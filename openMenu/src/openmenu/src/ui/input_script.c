@@ -0,0 +1,378 @@
+/*
+ * File: input_script.c
+ * Project: ui
+ * File Created: Tuesday, 20th October 2026 11:05:38 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <dc/maple/keyboard.h>
+
+#define LOG_MODULE UI
+#include <dbgprint.h>
+#include "ui/common.h"
+
+#include "ui/input_script.h"
+
+/* Everything that can be held is a slot: the pad controls in enum control
+ * order, the keyboard shift keys, then every scancode */
+#define SLOT_PAD      (0)
+#define SLOT_MOD      (SLOT_PAD + TRIG_R)
+#define SLOT_KEY      (SLOT_MOD + NUM_MODS)
+#define INPUT_SLOTS   (SLOT_KEY + 256)
+#define ANALOG_DEAD   (24) /* same as input_control */
+#define RECORD_UP     (UINT32_MAX)
+#define SCRIPT_LINE   (256)
+#define NUM_MODS      ((int)(sizeof(mod_keys) / sizeof(mod_keys[0])))
+#define NUM_NAMED     ((int)(sizeof(named_keys) / sizeof(named_keys[0])))
+
+typedef struct key_name {
+    const char* name;
+    uint8_t code;
+} key_name;
+
+static const char* pad_names[TRIG_R] = {"LEFT", "RIGHT", "UP", "DOWN", "A", "B", "X", "Y", "START", "TRIG_L", "TRIG_R"};
+
+static const key_name mod_keys[] = {
+    {"LCTRL", KBD_MOD_LCTRL}, {"LSHIFT", KBD_MOD_LSHIFT}, {"LALT", KBD_MOD_LALT},
+    {"RCTRL", KBD_MOD_RCTRL}, {"RSHIFT", KBD_MOD_RSHIFT}, {"RALT", KBD_MOD_RALT},
+};
+
+/* Letters, digits and F keys are worked out, these are the rest */
+static const key_name named_keys[] = {
+    {"ENTER", KBD_KEY_ENTER}, {"ESCAPE", KBD_KEY_ESCAPE}, {"BACKSPACE", KBD_KEY_BACKSPACE},
+    {"TAB", KBD_KEY_TAB},     {"SPACE", KBD_KEY_SPACE},   {"HOME", KBD_KEY_HOME},
+    {"PGUP", KBD_KEY_PGUP},   {"DEL", KBD_KEY_DEL},       {"END", KBD_KEY_END},
+    {"PGDOWN", KBD_KEY_PGDOWN}, {"RIGHT", KBD_KEY_RIGHT}, {"LEFT", KBD_KEY_LEFT},
+    {"DOWN", KBD_KEY_DOWN},   {"UP", KBD_KEY_UP},
+};
+
+static int
+slot_parse(const char* name) {
+    for (int i = 0; i < TRIG_R; i++) {
+        if (!strcmp(name, pad_names[i])) {
+            return SLOT_PAD + i;
+        }
+    }
+    if (strncmp(name, "KEY_", 4)) {
+        return -1;
+    }
+
+    const char* key = name + 4;
+    for (int i = 0; i < NUM_MODS; i++) {
+        if (!strcmp(key, mod_keys[i].name)) {
+            return SLOT_MOD + i;
+        }
+    }
+    for (int i = 0; i < NUM_NAMED; i++) {
+        if (!strcmp(key, named_keys[i].name)) {
+            return SLOT_KEY + named_keys[i].code;
+        }
+    }
+    if (key[0] >= 'A' && key[0] <= 'Z' && !key[1]) {
+        return SLOT_KEY + KBD_KEY_A + (key[0] - 'A');
+    }
+    if (key[0] >= '1' && key[0] <= '9' && !key[1]) {
+        return SLOT_KEY + KBD_KEY_1 + (key[0] - '1');
+    }
+    if (key[0] == '0' && !key[1]) {
+        return SLOT_KEY + KBD_KEY_0;
+    }
+
+    char* end;
+    if (key[0] == 'F') {
+        const unsigned long num = strtoul(key + 1, &end, 10);
+        if (!*end && end != key + 1 && num >= 1 && num <= 12) {
+            return SLOT_KEY + KBD_KEY_F1 + (int)num - 1;
+        }
+        return -1;
+    }
+    /* Anything else by scancode, 0x4c */
+    if (!strncmp(key, "0x", 2)) {
+        const unsigned long num = strtoul(key + 2, &end, 16);
+        if (!*end && end != key + 2 && num && num < 256) {
+            return SLOT_KEY + (int)num;
+        }
+    }
+    return -1;
+}
+
+static void
+slot_name(int slot, char* buf, size_t size) {
+    if (slot < SLOT_MOD) {
+        snprintf(buf, size, "%s", pad_names[slot - SLOT_PAD]);
+        return;
+    }
+    if (slot < SLOT_KEY) {
+        snprintf(buf, size, "KEY_%s", mod_keys[slot - SLOT_MOD].name);
+        return;
+    }
+
+    const int code = slot - SLOT_KEY;
+    for (int i = 0; i < NUM_NAMED; i++) {
+        if (named_keys[i].code == code) {
+            snprintf(buf, size, "KEY_%s", named_keys[i].name);
+            return;
+        }
+    }
+    if (code >= KBD_KEY_A && code <= KBD_KEY_Z) {
+        snprintf(buf, size, "KEY_%c", 'A' + (code - KBD_KEY_A));
+    } else if (code >= KBD_KEY_1 && code <= KBD_KEY_9) {
+        snprintf(buf, size, "KEY_%c", '1' + (code - KBD_KEY_1));
+    } else if (code == KBD_KEY_0) {
+        snprintf(buf, size, "KEY_0");
+    } else if (code >= KBD_KEY_F1 && code <= KBD_KEY_F12) {
+        snprintf(buf, size, "KEY_F%d", 1 + (code - KBD_KEY_F1));
+    } else {
+        snprintf(buf, size, "KEY_0x%02x", code);
+    }
+}
+
+/* Presses slot the way the pad or keyboard would report it */
+static void
+slot_press(int slot, inputs* out) {
+    if (slot >= SLOT_KEY) {
+        const uint8_t code = (uint8_t)(slot - SLOT_KEY);
+        for (int i = 0; i < INPT_MAX_KEYBOARD_KEYS; i++) {
+            if (out->kbd_buttons[i] == code) {
+                return;
+            }
+            if (!out->kbd_buttons[i]) {
+                out->kbd_buttons[i] = code;
+                return;
+            }
+        }
+        /* Seven keys at once is more than the keyboard reports either */
+        return;
+    }
+    if (slot >= SLOT_MOD) {
+        out->kbd_modifiers |= mod_keys[slot - SLOT_MOD].code;
+        return;
+    }
+
+    switch (slot - SLOT_PAD + 1) {
+        case LEFT: out->dpad |= DPAD_LEFT; break;
+        case RIGHT: out->dpad |= DPAD_RIGHT; break;
+        case UP: out->dpad |= DPAD_UP; break;
+        case DOWN: out->dpad |= DPAD_DOWN; break;
+        case A: out->btn_a = 1; break;
+        case B: out->btn_b = 1; break;
+        case X: out->btn_x = 1; break;
+        case Y: out->btn_y = 1; break;
+        case START: out->btn_start = 1; break;
+        case TRIG_L: out->trg_left = 255; break;
+        case TRIG_R: out->trg_right = 255; break;
+        default: break;
+    }
+}
+
+/* The other way round, every slot that in has down. The stick counts as the
+ * d-pad past the dead zone input_control uses */
+static void
+slots_down(const inputs* in, uint8_t* down) {
+    memset(down, 0, INPUT_SLOTS);
+    down[SLOT_PAD + LEFT - 1] = (in->dpad & DPAD_LEFT) || in->axes_1 < 128 - ANALOG_DEAD;
+    down[SLOT_PAD + RIGHT - 1] = (in->dpad & DPAD_RIGHT) || in->axes_1 > 128 + ANALOG_DEAD;
+    down[SLOT_PAD + UP - 1] = (in->dpad & DPAD_UP) || in->axes_2 < 128 - ANALOG_DEAD;
+    down[SLOT_PAD + DOWN - 1] = (in->dpad & DPAD_DOWN) || in->axes_2 > 128 + ANALOG_DEAD;
+    down[SLOT_PAD + A - 1] = !!in->btn_a;
+    down[SLOT_PAD + B - 1] = !!in->btn_b;
+    down[SLOT_PAD + X - 1] = !!in->btn_x;
+    down[SLOT_PAD + Y - 1] = !!in->btn_y;
+    down[SLOT_PAD + START - 1] = !!in->btn_start;
+    down[SLOT_PAD + TRIG_L - 1] = !!in->trg_left;
+    down[SLOT_PAD + TRIG_R - 1] = !!in->trg_right;
+    for (int i = 0; i < NUM_MODS; i++) {
+        down[SLOT_MOD + i] = !!(in->kbd_modifiers & mod_keys[i].code);
+    }
+    for (int i = 0; i < INPT_MAX_KEYBOARD_KEYS; i++) {
+        if (in->kbd_buttons[i]) {
+            down[SLOT_KEY + in->kbd_buttons[i]] = 1;
+        }
+    }
+}
+
+static int
+event_cmp(const void* a, const void* b) {
+    const input_event* ea = (const input_event*)a;
+    const input_event* eb = (const input_event*)b;
+    if (ea->frame != eb->frame) {
+        return (ea->frame < eb->frame) ? -1 : 1;
+    }
+    return (int)ea->slot - (int)eb->slot;
+}
+
+int
+input_script_load(input_script* script, const char* path) {
+    memset(script, 0, sizeof(*script));
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        LOG_ERROR("INPUT:Error opening %s!\n", path);
+        return -1;
+    }
+
+    char line[SCRIPT_LINE];
+    int line_num = 0;
+    int capacity = 0;
+    int has_end = 0;
+    int ret = 0;
+    while (!ret && fgets(line, sizeof(line), file)) {
+        line_num++;
+        char* comment = strchr(line, '#');
+        if (comment) {
+            *comment = '\0';
+        }
+
+        unsigned int frame = 0;
+        unsigned int frames = 1;
+        char name[32];
+        const int fields = sscanf(line, "%u %31s %u", &frame, name, &frames);
+        if (fields == EOF) {
+            continue;
+        }
+        if (fields < 2 || !frames) {
+            LOG_ERROR("INPUT:%s:%d bad event\n", path, line_num);
+            ret = -1;
+            break;
+        }
+        if (!strcmp(name, "END")) {
+            script->length = frame;
+            has_end = 1;
+            continue;
+        }
+
+        const int slot = slot_parse(name);
+        if (slot < 0) {
+            LOG_ERROR("INPUT:%s:%d unknown %s\n", path, line_num, name);
+            ret = -1;
+            break;
+        }
+        if (script->num_events == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            input_event* grown = realloc(script->events, capacity * sizeof(input_event));
+            if (!grown) {
+                LOG_ERROR("%s no free memory\n", __func__);
+                ret = -1;
+                break;
+            }
+            script->events = grown;
+        }
+        script->events[script->num_events++] = (input_event){.frame = frame, .frames = frames, .slot = (uint16_t)slot};
+        if (frames > script->longest) {
+            script->longest = frames;
+        }
+        if (!has_end && frame + frames > script->length) {
+            script->length = frame + frames;
+        }
+    }
+    fclose(file);
+
+    if (ret) {
+        input_script_free(script);
+        return ret;
+    }
+    qsort(script->events, script->num_events, sizeof(input_event), event_cmp);
+    return 0;
+}
+
+void
+input_script_free(input_script* script) {
+    free(script->events);
+    memset(script, 0, sizeof(*script));
+}
+
+void
+input_script_frame(const input_script* script, uint32_t frame, inputs* out) {
+    /* Neutral, as processInput starts every poll */
+    memset(out, 0, sizeof(inputs));
+    out->axes_1 = 128;
+    out->axes_2 = 128;
+
+    /* Nothing that went down before this is still held */
+    const uint32_t from = (frame > script->longest) ? frame - script->longest : 0;
+    int lo = 0;
+    int hi = script->num_events;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (script->events[mid].frame < from) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    for (int i = lo; i < script->num_events && script->events[i].frame <= frame; i++) {
+        const input_event* event = &script->events[i];
+        if (frame - event->frame < event->frames) {
+            slot_press(event->slot, out);
+        }
+    }
+}
+
+static FILE* record_out;
+static uint32_t record_frame;
+static uint32_t record_from[INPUT_SLOTS];
+
+static void
+record_release(int slot) {
+    char name[32];
+    slot_name(slot, name, sizeof(name));
+    fprintf(record_out, "%u %s %u\n", (unsigned int)record_from[slot], name,
+            (unsigned int)(record_frame - record_from[slot]));
+    record_from[slot] = RECORD_UP;
+}
+
+void
+input_record_start(FILE* out) {
+    record_out = out;
+    record_frame = 0;
+    for (int slot = 0; slot < INPUT_SLOTS; slot++) {
+        record_from[slot] = RECORD_UP;
+    }
+    fprintf(record_out, "# input_script, FRAME NAME FRAMES\n");
+}
+
+void
+input_record_stop(void) {
+    if (!record_out) {
+        return;
+    }
+    for (int slot = 0; slot < INPUT_SLOTS; slot++) {
+        if (record_from[slot] != RECORD_UP) {
+            record_release(slot);
+        }
+    }
+    fprintf(record_out, "%u END\n", (unsigned int)record_frame);
+    fflush(record_out);
+    record_out = NULL;
+}
+
+int
+input_record_active(void) {
+    return record_out != NULL;
+}
+
+void
+input_record_frame(const inputs* in) {
+    if (!record_out) {
+        return;
+    }
+
+    uint8_t down[INPUT_SLOTS];
+    slots_down(in, down);
+    /* F3 starts and stops the recording, it is not part of it */
+    down[SLOT_KEY + KBD_KEY_F3] = 0;
+    for (int slot = 0; slot < INPUT_SLOTS; slot++) {
+        if (down[slot] && record_from[slot] == RECORD_UP) {
+            record_from[slot] = record_frame;
+        } else if (!down[slot] && record_from[slot] != RECORD_UP) {
+            record_release(slot);
+        }
+    }
+    record_frame++;
+}
@@ -0,0 +1,56 @@
+/*
+ * File: input_script.h
+ * Project: ui
+ * File Created: Tuesday, 20th October 2026 11:05:38 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "ui/dc/input.h"
+
+/* A session of input played back a frame at a time in place of maple. The
+ * script is text, one event a line:
+ *
+ *   FRAME NAME [FRAMES]
+ *
+ * NAME is held down from FRAME for FRAMES frames, one if left out. It is a
+ * control by its enum control name (UP, A, START, TRIG_L...), a keyboard key
+ * as KEY_ and the key (KEY_Z, KEY_ENTER, KEY_F1, KEY_LSHIFT, KEY_0x4c), or
+ * END for the frame the session stops on. Frames count from 0, events can
+ * overlap and be in any order, # starts a comment.
+ *
+ * Controls press the pad buttons that give them, so edge detection and the
+ * keyboard quick jumps behave as they do with a real pad and keyboard */
+
+typedef struct input_event {
+    uint32_t frame;
+    uint32_t frames;
+    uint16_t slot; /* what is held, see input_script.c */
+} input_event;
+
+typedef struct input_script {
+    input_event* events; /* by frame */
+    int num_events;
+    uint32_t longest; /* hold, bounds the search for what is down */
+    uint32_t length;  /* END, or the frame after the last event lets go */
+} input_script;
+
+/* 0 on success, a bad line fails the whole script */
+int input_script_load(input_script* script, const char* path);
+void input_script_free(input_script* script);
+/* What maple would have been read as on frame, for INPT_ReceiveFromHost */
+void input_script_frame(const input_script* script, uint32_t frame, inputs* out);
+
+/* Writes a script of the frames given to input_record_frame, an event as
+ * each button or key lets go and END on stopping */
+void input_record_start(FILE* out);
+void input_record_stop(void);
+int input_record_active(void);
+void input_record_frame(const inputs* in);
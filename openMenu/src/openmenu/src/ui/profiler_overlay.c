@@ -0,0 +1,140 @@
+/*
+ * File: profiler_overlay.c
+ * Project: ui
+ * File Created: Monday, 19th October 2026 4:11:20 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include "ui/profiler_overlay.h"
+
+#if PROFILER
+
+#include <stdio.h>
+
+#include <dc/maple/keyboard.h>
+
+#include <arena.h>
+#include <openmenu_settings.h>
+#include "ui/dc/input.h"
+#include "ui/draw_kos.h"
+#include "ui/draw_prototypes.h"
+#include "ui/font_prototypes.h"
+#include "ui/input_script.h"
+
+#define OVERLAY_X           (8)
+#define OVERLAY_Y           (8)
+#define OVERLAY_WIDTH       (300)
+#define OVERLAY_LINE_HEIGHT (16)
+#define OVERLAY_BG_COLOR    (0xC0000000)
+#define OVERLAY_TEXT_COLOR  (0xFF00FF00)
+
+static int overlay_visible = 0;
+
+void
+profiler_overlay_input(void) {
+    if (INPT_KeyboardButtonPress(KBD_KEY_F1)) {
+        overlay_visible = !overlay_visible;
+    }
+    if (INPT_KeyboardButtonPress(KBD_KEY_F2)) {
+        prof_dump(stdout);
+    }
+    if (INPT_KeyboardButtonPress(KBD_KEY_F3)) {
+        if (input_record_active()) {
+            input_record_stop();
+        } else {
+            input_record_start(stdout);
+        }
+    }
+}
+
+/* Both fonts are loaded for every UI, but only one of them is the UI's own */
+static void
+overlay_draw_line(int x, int y, const char* str) {
+    if (sf_ui[0] == UI_SCROLL || sf_ui[0] == UI_FOLDERS) {
+        font_bmp_draw_main(x, y, str);
+    } else {
+        font_bmf_draw(x, y, OVERLAY_TEXT_COLOR, str);
+    }
+}
+
+void
+profiler_overlay_draw_tr(void) {
+    if (!overlay_visible) {
+        return;
+    }
+
+    /* last, average and worst over the ring for every timer */
+    uint32_t last[PROF_NUM_TIMERS] = {0};
+    uint32_t sum[PROF_NUM_TIMERS] = {0};
+    uint32_t max[PROF_NUM_TIMERS] = {0};
+    uint32_t counters[PROF_NUM_COUNTERS] = {0};
+    uint32_t last_count[PROF_NUM_COUNTERS] = {0};
+    int frames = 0;
+    const prof_frame* frame;
+    while ((frame = prof_get_frame(frames))) {
+        for (int i = 0; i < PROF_NUM_TIMERS; i++) {
+            if (!frames) {
+                last[i] = frame->timer_us[i];
+            }
+            sum[i] += frame->timer_us[i];
+            if (frame->timer_us[i] > max[i]) {
+                max[i] = frame->timer_us[i];
+            }
+        }
+        for (int i = 0; i < PROF_NUM_COUNTERS; i++) {
+            if (!frames) {
+                last_count[i] = frame->counter[i];
+            }
+            counters[i] += frame->counter[i];
+        }
+        frames++;
+    }
+    if (!frames) {
+        return;
+    }
+
+    const int lines = 1 + PROF_NUM_TIMERS + PROF_NUM_COUNTERS + ARENA_NUM;
+    z_set_cond(500.0f);
+    draw_draw_quad(OVERLAY_X, OVERLAY_Y, OVERLAY_WIDTH, lines * OVERLAY_LINE_HEIGHT + 4, OVERLAY_BG_COLOR);
+
+    if (sf_ui[0] == UI_SCROLL || sf_ui[0] == UI_FOLDERS) {
+        font_bmp_begin_draw();
+        font_bmp_set_color(OVERLAY_TEXT_COLOR);
+    } else {
+        font_bmf_begin_draw();
+        font_bmf_set_height(OVERLAY_LINE_HEIGHT);
+    }
+
+    char line_buf[64];
+    int cur_y = OVERLAY_Y + 2;
+    snprintf(line_buf, sizeof(line_buf), "%-9s %6s %6s %6s us", "", "last", "avg", "max");
+    overlay_draw_line(OVERLAY_X + 4, cur_y, line_buf);
+    for (int i = 0; i < PROF_NUM_TIMERS; i++) {
+        cur_y += OVERLAY_LINE_HEIGHT;
+        snprintf(line_buf, sizeof(line_buf), "%-9s %6lu %6lu %6lu", prof_timer_name((PROF_TIMER_ID)i),
+                 (unsigned long)last[i], (unsigned long)(sum[i] / frames), (unsigned long)max[i]);
+        overlay_draw_line(OVERLAY_X + 4, cur_y, line_buf);
+    }
+
+    /* Counters, last frame and the total over the same frames */
+    for (int i = 0; i < PROF_NUM_COUNTERS; i++) {
+        cur_y += OVERLAY_LINE_HEIGHT;
+        snprintf(line_buf, sizeof(line_buf), "%-11s %6lu %6lu", prof_counter_name((PROF_COUNTER_ID)i),
+                 (unsigned long)last_count[i], (unsigned long)counters[i]);
+        overlay_draw_line(OVERLAY_X + 4, cur_y, line_buf);
+    }
+
+    /* Boot arenas, what they hold now and the most they ever held */
+    for (int i = 0; i < ARENA_NUM; i++) {
+        const arena_stats* stats = arena_get_stats((ARENA_ID)i);
+        cur_y += OVERLAY_LINE_HEIGHT;
+        snprintf(line_buf, sizeof(line_buf), "%-9s %6lu %6lu KB", arena_name((ARENA_ID)i),
+                 (unsigned long)(stats->used / 1024), (unsigned long)(stats->high_water / 1024));
+        overlay_draw_line(OVERLAY_X + 4, cur_y, line_buf);
+    }
+}
+
+#endif /* PROFILER */
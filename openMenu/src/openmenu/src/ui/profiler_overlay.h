@@ -0,0 +1,24 @@
+/*
+ * File: profiler_overlay.h
+ * Project: ui
+ * File Created: Monday, 19th October 2026 4:11:20 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <profiler.h>
+
+/* On screen view of the frame profiler, only built with PROFILER. Keyboard
+ * F1 toggles the overlay, F2 dumps the ring and marks to serial, F3 starts
+ * and stops recording the pad and keyboard there as an input_script */
+#if PROFILER
+void profiler_overlay_input(void);
+void profiler_overlay_draw_tr(void);
+#else
+#define profiler_overlay_input()   ((void)0)
+#define profiler_overlay_draw_tr() ((void)0)
+#endif
@@ -0,0 +1,86 @@
+/*
+ * File: fs_soft.c
+ * Project: soft
+ * File Created: Monday, 19th October 2026 2:31:18 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdio.h>
+
+#include <kos/fs.h>
+#include <om_reader.h>
+
+/* KOS handles are small ints, these index the open om_files */
+#define FS_SOFT_FILES (32)
+
+static om_file files[FS_SOFT_FILES];
+
+static om_file
+fs_soft_get(file_t hnd) {
+    return (hnd >= 0 && hnd < FS_SOFT_FILES) ? files[hnd] : OM_FILE_INVALID;
+}
+
+file_t
+fs_open(const char* fn, int mode) {
+    if ((mode & O_ACCMODE) != O_RDONLY) {
+        return FILEHND_INVALID;
+    }
+    for (int i = 0; i < FS_SOFT_FILES; i++) {
+        if (files[i] == OM_FILE_INVALID) {
+            files[i] = om_file_open(fn);
+            return (files[i] == OM_FILE_INVALID) ? FILEHND_INVALID : i;
+        }
+    }
+    return FILEHND_INVALID;
+}
+
+int
+fs_close(file_t hnd) {
+    om_file file = fs_soft_get(hnd);
+    if (file == OM_FILE_INVALID) {
+        return -1;
+    }
+    om_file_close(file);
+    files[hnd] = OM_FILE_INVALID;
+    return 0;
+}
+
+ssize_t
+fs_read(file_t hnd, void* buffer, size_t cnt) {
+    om_file file = fs_soft_get(hnd);
+    if (file == OM_FILE_INVALID) {
+        return -1;
+    }
+    return (ssize_t)fread(buffer, 1, cnt, file);
+}
+
+off_t
+fs_seek(file_t hnd, off_t offset, int whence) {
+    om_file file = fs_soft_get(hnd);
+    if (file == OM_FILE_INVALID || fseek(file, (long)offset, whence)) {
+        return -1;
+    }
+    return (off_t)ftell(file);
+}
+
+off_t
+fs_tell(file_t hnd) {
+    om_file file = fs_soft_get(hnd);
+    return (file == OM_FILE_INVALID) ? -1 : (off_t)ftell(file);
+}
+
+size_t
+fs_total(file_t hnd) {
+    om_file file = fs_soft_get(hnd);
+    return (file == OM_FILE_INVALID) ? 0 : om_file_size(file);
+}
+
+int
+fs_stat(const char* path, struct stat* buf, int flag) {
+    (void)flag;
+    char host_path[FILENAME_MAX];
+    return stat(om_file_host_path(path, host_path, sizeof(host_path)), buf);
+}
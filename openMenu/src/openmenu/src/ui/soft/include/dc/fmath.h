@@ -0,0 +1,18 @@
+/*
+ * File: fmath.h
+ * Project: soft
+ * File Created: Monday, 19th October 2026 2:12:03 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <math.h>
+
+/* Host stand in for the KOS <dc/fmath.h>, the SH4 fast paths are libm here */
+#define fsin(x)  sinf(x)
+#define fcos(x)  cosf(x)
+#define fsqrt(x) sqrtf(x)
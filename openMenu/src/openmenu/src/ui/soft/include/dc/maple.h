@@ -0,0 +1,44 @@
+/*
+ * File: maple.h
+ * Project: soft
+ * File Created: Tuesday, 20th October 2026 10:14:02 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <arch/types.h>
+
+/* Host stand in for the KOS <dc/maple.h>. Nothing is ever plugged in on the
+ * host, input comes from an input_script instead, so only what the menus
+ * reference when walking devices is here */
+
+#define MAPLE_FUNC_CONTROLLER (0x01000000)
+#define MAPLE_FUNC_MEMCARD    (0x02000000)
+#define MAPLE_FUNC_LCD        (0x04000000)
+#define MAPLE_FUNC_CLOCK      (0x08000000)
+#define MAPLE_FUNC_KEYBOARD   (0x40000000)
+
+typedef struct maple_devinfo {
+    uint32 functions;
+    uint32 function_data[3];
+    uint8 area_code;
+    uint8 connector_direction;
+    char product_name[30];
+    char product_license[60];
+    uint16 standby_power;
+    uint16 max_power;
+} maple_devinfo_t;
+
+typedef struct maple_device {
+    int valid;
+    int port;
+    int unit;
+    maple_devinfo_t info;
+} maple_device_t;
+
+maple_device_t* maple_enum_dev(int port, int unit);
+maple_device_t* maple_enum_type(int n, uint32 func);
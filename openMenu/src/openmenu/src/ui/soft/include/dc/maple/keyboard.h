@@ -0,0 +1,88 @@
+/*
+ * File: keyboard.h
+ * Project: soft
+ * File Created: Tuesday, 20th October 2026 10:31:52 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+/* Host stand in for the KOS <dc/maple/keyboard.h>, the scancodes and shift
+ * bits the menus and input_script use. Values are the KOS ones so scripts
+ * recorded on a Dreamcast replay the same keys */
+
+#define KBD_MOD_LCTRL  (1 << 0)
+#define KBD_MOD_LSHIFT (1 << 1)
+#define KBD_MOD_LALT   (1 << 2)
+#define KBD_MOD_S1     (1 << 3)
+#define KBD_MOD_RCTRL  (1 << 4)
+#define KBD_MOD_RSHIFT (1 << 5)
+#define KBD_MOD_RALT   (1 << 6)
+#define KBD_MOD_S2     (1 << 7)
+
+#define KBD_KEY_NONE      (0x00)
+#define KBD_KEY_A         (0x04)
+#define KBD_KEY_B         (0x05)
+#define KBD_KEY_C         (0x06)
+#define KBD_KEY_D         (0x07)
+#define KBD_KEY_E         (0x08)
+#define KBD_KEY_F         (0x09)
+#define KBD_KEY_G         (0x0a)
+#define KBD_KEY_H         (0x0b)
+#define KBD_KEY_I         (0x0c)
+#define KBD_KEY_J         (0x0d)
+#define KBD_KEY_K         (0x0e)
+#define KBD_KEY_L         (0x0f)
+#define KBD_KEY_M         (0x10)
+#define KBD_KEY_N         (0x11)
+#define KBD_KEY_O         (0x12)
+#define KBD_KEY_P         (0x13)
+#define KBD_KEY_Q         (0x14)
+#define KBD_KEY_R         (0x15)
+#define KBD_KEY_S         (0x16)
+#define KBD_KEY_T         (0x17)
+#define KBD_KEY_U         (0x18)
+#define KBD_KEY_V         (0x19)
+#define KBD_KEY_W         (0x1a)
+#define KBD_KEY_X         (0x1b)
+#define KBD_KEY_Y         (0x1c)
+#define KBD_KEY_Z         (0x1d)
+#define KBD_KEY_1         (0x1e)
+#define KBD_KEY_2         (0x1f)
+#define KBD_KEY_3         (0x20)
+#define KBD_KEY_4         (0x21)
+#define KBD_KEY_5         (0x22)
+#define KBD_KEY_6         (0x23)
+#define KBD_KEY_7         (0x24)
+#define KBD_KEY_8         (0x25)
+#define KBD_KEY_9         (0x26)
+#define KBD_KEY_0         (0x27)
+#define KBD_KEY_ENTER     (0x28)
+#define KBD_KEY_ESCAPE    (0x29)
+#define KBD_KEY_BACKSPACE (0x2a)
+#define KBD_KEY_TAB       (0x2b)
+#define KBD_KEY_SPACE     (0x2c)
+#define KBD_KEY_F1        (0x3a)
+#define KBD_KEY_F2        (0x3b)
+#define KBD_KEY_F3        (0x3c)
+#define KBD_KEY_F4        (0x3d)
+#define KBD_KEY_F5        (0x3e)
+#define KBD_KEY_F6        (0x3f)
+#define KBD_KEY_F7        (0x40)
+#define KBD_KEY_F8        (0x41)
+#define KBD_KEY_F9        (0x42)
+#define KBD_KEY_F10       (0x43)
+#define KBD_KEY_F11       (0x44)
+#define KBD_KEY_F12       (0x45)
+#define KBD_KEY_HOME      (0x4a)
+#define KBD_KEY_PGUP      (0x4b)
+#define KBD_KEY_DEL       (0x4c)
+#define KBD_KEY_END       (0x4d)
+#define KBD_KEY_PGDOWN    (0x4e)
+#define KBD_KEY_RIGHT     (0x4f)
+#define KBD_KEY_LEFT      (0x50)
+#define KBD_KEY_DOWN      (0x51)
+#define KBD_KEY_UP        (0x52)
@@ -0,0 +1,238 @@
+/*
+ * File: pvr.h
+ * Project: soft
+ * File Created: Monday, 19th October 2026 2:10:44 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Host stand in for the KOS <dc/pvr.h>, only what the draw layer, fonts and
+ * texture code use. Names, values and the compiled header bits are the KOS
+ * ones so the same code runs unchanged, pvr_soft.c is the PowerVR behind it.
+ * No sprites, the host build is always the polygon path */
+
+typedef void* pvr_ptr_t;
+
+/* Lists */
+#define PVR_LIST_OP_POLY (0)
+#define PVR_LIST_OP_MOD  (1)
+#define PVR_LIST_TR_POLY (2)
+#define PVR_LIST_TR_MOD  (3)
+#define PVR_LIST_PT_POLY (4)
+
+/* TA commands, the top bits of the first word of every 32 byte unit */
+#define PVR_CMD_POLYHDR    (0x80840000)
+#define PVR_CMD_VERTEX     (0xe0000000)
+#define PVR_CMD_VERTEX_EOL (0xf0000000)
+#define PVR_CMD_USERCLIP   (0x20000000)
+#define PVR_CMD_MODIFIER   (0x80000000)
+#define PVR_CMD_SPRITE     (0xA0000000)
+
+/* Polygon context values */
+#define PVR_SHADE_FLAT    (0)
+#define PVR_SHADE_GOURAUD (1)
+
+#define PVR_DEPTHCMP_NEVER    (0)
+#define PVR_DEPTHCMP_LESS     (1)
+#define PVR_DEPTHCMP_EQUAL    (2)
+#define PVR_DEPTHCMP_LEQUAL   (3)
+#define PVR_DEPTHCMP_GREATER  (4)
+#define PVR_DEPTHCMP_NOTEQUAL (5)
+#define PVR_DEPTHCMP_GEQUAL   (6)
+#define PVR_DEPTHCMP_ALWAYS   (7)
+
+#define PVR_CULLING_NONE  (0)
+#define PVR_CULLING_SMALL (1)
+#define PVR_CULLING_CCW   (2)
+#define PVR_CULLING_CW    (3)
+
+#define PVR_DEPTHWRITE_ENABLE  (0)
+#define PVR_DEPTHWRITE_DISABLE (1)
+
+#define PVR_TEXTURE_DISABLE (0)
+#define PVR_TEXTURE_ENABLE  (1)
+
+#define PVR_BLEND_ZERO         (0)
+#define PVR_BLEND_ONE          (1)
+#define PVR_BLEND_DESTCOLOR    (2)
+#define PVR_BLEND_INVDESTCOLOR (3)
+#define PVR_BLEND_SRCALPHA     (4)
+#define PVR_BLEND_INVSRCALPHA  (5)
+#define PVR_BLEND_DESTALPHA    (6)
+#define PVR_BLEND_INVDESTALPHA (7)
+
+#define PVR_BLEND_DISABLE (0)
+#define PVR_BLEND_ENABLE  (1)
+
+#define PVR_FOG_TABLE   (0)
+#define PVR_FOG_VERTEX  (1)
+#define PVR_FOG_DISABLE (2)
+
+#define PVR_USERCLIP_DISABLE (0)
+#define PVR_USERCLIP_INSIDE  (2)
+#define PVR_USERCLIP_OUTSIDE (3)
+
+#define PVR_CLRCLAMP_DISABLE (0)
+#define PVR_CLRCLAMP_ENABLE  (1)
+
+#define PVR_ALPHA_DISABLE (0)
+#define PVR_ALPHA_ENABLE  (1)
+
+#define PVR_TXRALPHA_ENABLE  (0)
+#define PVR_TXRALPHA_DISABLE (1)
+
+#define PVR_UVFLIP_NONE (0)
+#define PVR_UVFLIP_V    (1)
+#define PVR_UVFLIP_U    (2)
+#define PVR_UVFLIP_UV   (3)
+
+#define PVR_UVCLAMP_NONE (0)
+#define PVR_UVCLAMP_V    (1)
+#define PVR_UVCLAMP_U    (2)
+#define PVR_UVCLAMP_UV   (3)
+
+#define PVR_FILTER_NONE       (0)
+#define PVR_FILTER_NEAREST    (0)
+#define PVR_FILTER_BILINEAR   (2)
+#define PVR_FILTER_TRILINEAR1 (4)
+#define PVR_FILTER_TRILINEAR2 (6)
+
+#define PVR_MIPBIAS_NORMAL (4)
+
+#define PVR_TXRENV_REPLACE       (0)
+#define PVR_TXRENV_MODULATE      (1)
+#define PVR_TXRENV_DECAL         (2)
+#define PVR_TXRENV_MODULATEALPHA (3)
+
+#define PVR_MIPMAP_DISABLE (0)
+#define PVR_MIPMAP_ENABLE  (1)
+
+#define PVR_CLRFMT_ARGBPACKED (0)
+#define PVR_UVFMT_32BIT       (0)
+#define PVR_UVFMT_16BIT       (1)
+
+/* Texture formats */
+#define PVR_TXRFMT_NONE         (0)
+#define PVR_TXRFMT_VQ_DISABLE   (0 << 30)
+#define PVR_TXRFMT_VQ_ENABLE    (1 << 30)
+#define PVR_TXRFMT_ARGB1555     (0 << 27)
+#define PVR_TXRFMT_RGB565       (1 << 27)
+#define PVR_TXRFMT_ARGB4444     (2 << 27)
+#define PVR_TXRFMT_YUV422       (3 << 27)
+#define PVR_TXRFMT_BUMP         (4 << 27)
+#define PVR_TXRFMT_PAL4BPP      (5 << 27)
+#define PVR_TXRFMT_PAL8BPP      (6 << 27)
+#define PVR_TXRFMT_TWIDDLED     (0 << 26)
+#define PVR_TXRFMT_NONTWIDDLED  (1 << 26)
+#define PVR_TXRFMT_NOSTRIDE     (0 << 21)
+#define PVR_TXRFMT_STRIDE       (1 << 21)
+#define PVR_TXRFMT_8BPP_PAL(x)  ((x) << 25)
+#define PVR_TXRFMT_4BPP_PAL(x)  ((x) << 21)
+
+/* Palette RAM formats */
+#define PVR_PAL_ARGB1555 (0)
+#define PVR_PAL_RGB565   (1)
+#define PVR_PAL_ARGB4444 (2)
+#define PVR_PAL_ARGB8888 (3)
+
+#define PVR_PACK_COLOR(a, r, g, b)                                                                                     \
+    (((uint32_t)((a) * 255) << 24) | ((uint32_t)((r) * 255) << 16) | ((uint32_t)((g) * 255) << 8)                     \
+     | ((uint32_t)((b) * 255) << 0))
+
+typedef struct pvr_poly_hdr {
+    uint32_t cmd;
+    uint32_t mode1, mode2, mode3;
+    uint32_t d1, d2, d3, d4;
+} pvr_poly_hdr_t;
+
+typedef struct pvr_vertex {
+    uint32_t flags;
+    float x, y, z;
+    float u, v;
+    uint32_t argb, oargb;
+} pvr_vertex_t;
+
+typedef struct pvr_poly_cxt {
+    int list_type;
+    struct {
+        int alpha;
+        int shading;
+        int fog_type;
+        int culling;
+        int color_clamp;
+        int clip_mode;
+        int modifier_mode;
+        int specular;
+    } gen;
+    struct {
+        int src, dst;
+        int src_enable, dst_enable;
+    } blend;
+    struct {
+        int color;
+        int uv;
+        int modifier;
+    } fmt;
+    struct {
+        int comparison;
+        int write;
+    } depth;
+    struct {
+        int enable;
+        int filter;
+        int mipmap;
+        int mipmap_bias;
+        int uv_flip;
+        int uv_clamp;
+        int alpha;
+        int env;
+        int width;
+        int height;
+        int format;
+        pvr_ptr_t base;
+    } txr;
+} pvr_poly_cxt_t;
+
+typedef struct pvr_init_params {
+    int opb_sizes[5];
+    int vertex_buf_size;
+    int dma_enabled;
+    int fsaa_enabled;
+    int autosort_disabled;
+    int opb_overflow_count;
+} pvr_init_params_t;
+
+#define PVR_BINSIZE_0  (0)
+#define PVR_BINSIZE_8  (8)
+#define PVR_BINSIZE_16 (16)
+#define PVR_BINSIZE_32 (32)
+
+int pvr_init(pvr_init_params_t* params);
+void pvr_set_bg_color(float r, float g, float b);
+
+int pvr_wait_ready(void);
+int pvr_scene_begin(void);
+int pvr_scene_finish(void);
+int pvr_list_begin(int list);
+int pvr_list_finish(void);
+int pvr_prim(void* data, int size);
+
+void pvr_poly_cxt_col(pvr_poly_cxt_t* dst, int list);
+void pvr_poly_cxt_txr(pvr_poly_cxt_t* dst, int list, int textureformat, int tw, int th, pvr_ptr_t textureaddr,
+                      int filtering);
+void pvr_poly_compile(pvr_poly_hdr_t* dst, pvr_poly_cxt_t* src);
+
+pvr_ptr_t pvr_mem_malloc(size_t size);
+void pvr_mem_free(pvr_ptr_t chunk);
+uint32_t pvr_mem_available(void);
+void pvr_txr_load(void* src, pvr_ptr_t dst, uint32_t count);
+
+void pvr_set_pal_format(int fmt);
+void pvr_set_pal_entry(uint32_t idx, uint32_t value);
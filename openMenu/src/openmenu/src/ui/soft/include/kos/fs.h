@@ -0,0 +1,33 @@
+/*
+ * File: fs.h
+ * Project: soft
+ * File Created: Monday, 19th October 2026 2:12:40 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+/* Host stand in for the KOS <kos/fs.h>, read only and on top of om_file so
+ * /cd/ paths land in the directory given to om_file_set_cd_root */
+
+typedef int file_t;
+#define FILEHND_INVALID (-1)
+
+#define STAT_TYPE_NONE (0)
+
+file_t fs_open(const char* fn, int mode);
+int fs_close(file_t hnd);
+ssize_t fs_read(file_t hnd, void* buffer, size_t cnt);
+off_t fs_seek(file_t hnd, off_t offset, int whence);
+off_t fs_tell(file_t hnd);
+size_t fs_total(file_t hnd);
+int fs_stat(const char* path, struct stat* buf, int flag);
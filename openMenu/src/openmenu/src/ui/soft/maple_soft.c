@@ -0,0 +1,50 @@
+/*
+ * File: maple_soft.c
+ * Project: soft
+ * File Created: Tuesday, 20th October 2026 10:20:17 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stddef.h>
+
+#include <dc/maple.h>
+#include "vm2/vm2_api.h"
+
+/* An empty bus, the menus see no controllers, VMUs or VM2 style devices */
+
+maple_device_t*
+maple_enum_dev(int port, int unit) {
+    (void)port;
+    (void)unit;
+    return NULL;
+}
+
+maple_device_t*
+maple_enum_type(int n, uint32 func) {
+    (void)n;
+    (void)func;
+    return NULL;
+}
+
+int
+check_vm2_present(maple_device_t* dev) {
+    (void)dev;
+    return 0;
+}
+
+int
+vm2_set_id(maple_device_t* dev, const char* ID, const char* name) {
+    (void)dev;
+    (void)ID;
+    (void)name;
+    return -1;
+}
+
+const char*
+get_vmu_type_name(maple_device_t* dev) {
+    (void)dev;
+    return "VMU";
+}
@@ -0,0 +1,1175 @@
+/*
+ * File: pvr_soft.c
+ * Project: soft
+ * File Created: Monday, 19th October 2026 3:04:26 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pvr_soft.h"
+#include "soft_image.h"
+
+/* What is emulated is what the menu draws with: packed colour vertices with
+ * 32 bit UVs, every texture format, depth compare, blending, filtering, the
+ * three polygon lists and translucent autosort, per strip rather than per
+ * triangle. Sprites and modifier volumes are counted but not drawn, culling,
+ * fog, mipmaps and the accumulation buffer are ignored */
+
+#define SOFT_VRAM_SIZE    (8 * 1024 * 1024)
+#define SOFT_VRAM_BLOCKS  (1024)
+#define SOFT_VRAM_ALIGN   (32)
+#define SOFT_PAL_ENTRIES  (1024)
+#define SOFT_TEX_CACHE    (64)
+#define SOFT_TEX_MAX      (1024)
+#define SOFT_VQ_CODEBOOK  (2048)
+#define SOFT_PT_ALPHA_REF (0x80)
+
+#define SOFT_PX_PAL4BPP (5)
+#define SOFT_PX_PAL8BPP (6)
+
+/* VRAM, allocated first fit from blocks kept in address order */
+typedef struct soft_block {
+    uint32_t offset;
+    uint32_t size;
+    int used;
+} soft_block;
+
+static uint8_t vram[SOFT_VRAM_SIZE] __attribute__((aligned(32)));
+static soft_block blocks[SOFT_VRAM_BLOCKS];
+static int num_blocks = 0;
+
+static uint32_t pal_ram[SOFT_PAL_ENTRIES];
+static int pal_format = PVR_PAL_ARGB1555;
+static uint32_t pal_gen = 1; /* bumped on every change, paletted decodes depend on it */
+
+/* Decoded textures, keyed by their header bits */
+typedef struct soft_texture {
+    uint32_t mode3;
+    uint32_t width;
+    uint32_t height;
+    uint32_t offset; /* VRAM it was decoded from */
+    uint32_t size;
+    uint32_t pal_gen; /* 0 when not paletted */
+    uint32_t used;
+    uint32_t capacity;
+    uint32_t* argb;
+    int valid;
+} soft_texture;
+
+static soft_texture tex_cache[SOFT_TEX_CACHE];
+static uint32_t tex_clock = 0;
+
+/* TA, vertices are only kept for scenes that get rendered */
+typedef struct soft_strip {
+    pvr_poly_hdr_t hdr;
+    uint32_t first;
+    uint32_t count;
+} soft_strip;
+
+typedef struct soft_list {
+    soft_strip* strips;
+    uint32_t num_strips;
+    uint32_t max_strips;
+    pvr_vertex_t* verts;
+    uint32_t num_verts;
+    uint32_t max_verts;
+    pvr_poly_hdr_t hdr;
+    uint32_t strip_start;
+    uint32_t strip_len;
+} soft_list;
+
+static soft_list lists[PVR_SOFT_LISTS];
+static int ta_list = -1; /* of the last header, -1 outside a list */
+static int ta_sprite = 0;
+static int render = 0;
+static int autosort = 1; /* TR list drawn back to front, as pvr_init leaves it by default */
+static int scene_render = 0;
+static pvr_soft_stats stats;
+static pvr_soft_stats last_stats;
+
+static uint32_t bg_color = 0xFF000000;
+static uint32_t frame[PVR_SOFT_WIDTH * PVR_SOFT_HEIGHT];
+static float depth[PVR_SOFT_WIDTH * PVR_SOFT_HEIGHT];
+/* Pixels at the start of each row holding this scene, the rest still has
+ * the last scene. Rows are cleared lazily, mostly never, the background
+ * images cover them left to right */
+static uint16_t row_fill[PVR_SOFT_HEIGHT];
+
+/* Header state a strip is drawn with */
+typedef struct soft_shade {
+    const uint32_t* texels; /* NULL when untextured */
+    int tex_w;
+    int tex_h;
+    int bilinear;
+    int clamp_u, clamp_v;
+    int flip_u, flip_v;
+    int env;
+    int vert_alpha;
+    int txr_alpha;
+    int src, dst;
+    int depth_cmp;
+    int depth_write;
+    int gouraud;
+    int punch;
+} soft_shade;
+
+static void
+soft_vram_reset(void) {
+    blocks[0].offset = 0;
+    blocks[0].size = SOFT_VRAM_SIZE;
+    blocks[0].used = 0;
+    num_blocks = 1;
+}
+
+static void
+soft_tex_invalidate(uint32_t offset, uint32_t size) {
+    for (int i = 0; i < SOFT_TEX_CACHE; i++) {
+        soft_texture* tex = &tex_cache[i];
+        if (tex->valid && offset < tex->offset + tex->size && tex->offset < offset + size) {
+            tex->valid = 0;
+        }
+    }
+}
+
+int
+pvr_init(pvr_init_params_t* params) {
+    autosort = !params || !params->autosort_disabled;
+    soft_vram_reset();
+    memset(pal_ram, 0, sizeof(pal_ram));
+    pal_format = PVR_PAL_ARGB1555;
+    pal_gen++;
+    soft_tex_invalidate(0, SOFT_VRAM_SIZE);
+    bg_color = 0xFF000000;
+    return 0;
+}
+
+void
+pvr_set_bg_color(float r, float g, float b) {
+    bg_color = PVR_PACK_COLOR(1.0f, r, g, b);
+}
+
+pvr_ptr_t
+pvr_mem_malloc(size_t size) {
+    const uint32_t want = (uint32_t)((size + SOFT_VRAM_ALIGN - 1) & ~(size_t)(SOFT_VRAM_ALIGN - 1));
+    if (!num_blocks) {
+        soft_vram_reset();
+    }
+    for (int i = 0; i < num_blocks; i++) {
+        soft_block* block = &blocks[i];
+        if (block->used || block->size < want) {
+            continue;
+        }
+        if (block->size > want && num_blocks < SOFT_VRAM_BLOCKS) {
+            memmove(&blocks[i + 2], &blocks[i + 1], (num_blocks - i - 1) * sizeof(soft_block));
+            blocks[i + 1].offset = block->offset + want;
+            blocks[i + 1].size = block->size - want;
+            blocks[i + 1].used = 0;
+            block->size = want;
+            num_blocks++;
+        }
+        block->used = 1;
+        return vram + block->offset;
+    }
+    return NULL;
+}
+
+void
+pvr_mem_free(pvr_ptr_t chunk) {
+    const uint32_t offset = (uint32_t)((uint8_t*)chunk - vram);
+    int i = 0;
+    while (i < num_blocks && blocks[i].offset != offset) {
+        i++;
+    }
+    if (i == num_blocks || !blocks[i].used) {
+        return;
+    }
+    blocks[i].used = 0;
+    soft_tex_invalidate(blocks[i].offset, blocks[i].size);
+
+    /* Merge with free neighbours */
+    if (i + 1 < num_blocks && !blocks[i + 1].used) {
+        blocks[i].size += blocks[i + 1].size;
+        memmove(&blocks[i + 1], &blocks[i + 2], (num_blocks - i - 2) * sizeof(soft_block));
+        num_blocks--;
+    }
+    if (i > 0 && !blocks[i - 1].used) {
+        blocks[i - 1].size += blocks[i].size;
+        memmove(&blocks[i], &blocks[i + 1], (num_blocks - i - 1) * sizeof(soft_block));
+        num_blocks--;
+    }
+}
+
+uint32_t
+pvr_mem_available(void) {
+    uint32_t avail = 0;
+    if (!num_blocks) {
+        return SOFT_VRAM_SIZE;
+    }
+    for (int i = 0; i < num_blocks; i++) {
+        if (!blocks[i].used) {
+            avail += blocks[i].size;
+        }
+    }
+    return avail;
+}
+
+void
+pvr_txr_load(void* src, pvr_ptr_t dst, uint32_t count) {
+    const uint8_t* to = (const uint8_t*)dst;
+    if (to < vram || to + count > vram + SOFT_VRAM_SIZE) {
+        return;
+    }
+    memcpy(dst, src, count);
+    soft_tex_invalidate((uint32_t)(to - vram), count);
+    stats.txr_loads++;
+    stats.txr_bytes += count;
+}
+
+void
+pvr_set_pal_format(int fmt) {
+    pal_format = fmt;
+    pal_gen++;
+}
+
+void
+pvr_set_pal_entry(uint32_t idx, uint32_t value) {
+    pal_ram[idx % SOFT_PAL_ENTRIES] = value;
+    pal_gen++;
+}
+
+/* Contexts and headers, same defaults and bits as KOS */
+static void
+soft_cxt_defaults(pvr_poly_cxt_t* dst, int list) {
+    const int alpha = list > PVR_LIST_OP_MOD;
+
+    memset(dst, 0, sizeof(*dst));
+    dst->list_type = list;
+    dst->gen.alpha = alpha ? PVR_ALPHA_ENABLE : PVR_ALPHA_DISABLE;
+    dst->gen.shading = PVR_SHADE_GOURAUD;
+    dst->gen.fog_type = PVR_FOG_DISABLE;
+    dst->gen.culling = PVR_CULLING_CCW;
+    dst->gen.color_clamp = PVR_CLRCLAMP_DISABLE;
+    dst->gen.clip_mode = PVR_USERCLIP_DISABLE;
+    dst->blend.src = alpha ? PVR_BLEND_SRCALPHA : PVR_BLEND_ONE;
+    dst->blend.dst = alpha ? PVR_BLEND_INVSRCALPHA : PVR_BLEND_ZERO;
+    dst->blend.src_enable = PVR_BLEND_DISABLE;
+    dst->blend.dst_enable = PVR_BLEND_DISABLE;
+    dst->fmt.color = PVR_CLRFMT_ARGBPACKED;
+    dst->fmt.uv = PVR_UVFMT_32BIT;
+    dst->depth.comparison = PVR_DEPTHCMP_GREATER;
+    dst->depth.write = PVR_DEPTHWRITE_ENABLE;
+    dst->txr.enable = PVR_TEXTURE_DISABLE;
+}
+
+void
+pvr_poly_cxt_col(pvr_poly_cxt_t* dst, int list) {
+    soft_cxt_defaults(dst, list);
+}
+
+void
+pvr_poly_cxt_txr(pvr_poly_cxt_t* dst, int list, int textureformat, int tw, int th, pvr_ptr_t textureaddr,
+                 int filtering) {
+    soft_cxt_defaults(dst, list);
+    dst->txr.enable = PVR_TEXTURE_ENABLE;
+    dst->txr.filter = filtering;
+    dst->txr.mipmap = PVR_MIPMAP_DISABLE;
+    dst->txr.mipmap_bias = PVR_MIPBIAS_NORMAL;
+    dst->txr.uv_flip = PVR_UVFLIP_NONE;
+    dst->txr.uv_clamp = PVR_UVCLAMP_NONE;
+    dst->txr.alpha = (list > PVR_LIST_OP_MOD) ? PVR_TXRALPHA_ENABLE : PVR_TXRALPHA_DISABLE;
+    dst->txr.env = PVR_TXRENV_MODULATEALPHA;
+    dst->txr.width = tw;
+    dst->txr.height = th;
+    dst->txr.format = textureformat;
+    dst->txr.base = textureaddr;
+}
+
+/* 8 is 0 up to 1024 as 7 */
+static uint32_t
+soft_size_bits(int size) {
+    uint32_t bits = 0;
+    while ((8 << bits) < size && bits < 7) {
+        bits++;
+    }
+    return bits;
+}
+
+void
+pvr_poly_compile(pvr_poly_hdr_t* dst, pvr_poly_cxt_t* src) {
+    const int textured = src->txr.enable == PVR_TEXTURE_ENABLE;
+
+    dst->cmd = PVR_CMD_POLYHDR | ((uint32_t)src->list_type << 24) | ((uint32_t)src->gen.clip_mode << 16)
+               | ((uint32_t)src->fmt.modifier << 7) | ((uint32_t)src->fmt.color << 4) | ((uint32_t)textured << 3)
+               | ((uint32_t)src->gen.specular << 2) | ((uint32_t)src->gen.shading << 1) | (uint32_t)src->fmt.uv;
+    dst->mode1 = ((uint32_t)src->depth.comparison << 29) | ((uint32_t)src->gen.culling << 27)
+                 | ((uint32_t)src->depth.write << 26) | ((uint32_t)textured << 25);
+    dst->mode2 = ((uint32_t)src->blend.src << 29) | ((uint32_t)src->blend.dst << 26)
+                 | ((uint32_t)src->blend.src_enable << 25) | ((uint32_t)src->blend.dst_enable << 24)
+                 | ((uint32_t)src->gen.fog_type << 22) | ((uint32_t)src->gen.color_clamp << 21)
+                 | ((uint32_t)src->gen.alpha << 20);
+    dst->mode3 = 0;
+    if (textured) {
+        dst->mode2 |= ((uint32_t)src->txr.alpha << 19) | ((uint32_t)src->txr.uv_flip << 17)
+                      | ((uint32_t)src->txr.uv_clamp << 15) | ((uint32_t)src->txr.filter << 12)
+                      | ((uint32_t)src->txr.mipmap_bias << 8) | ((uint32_t)src->txr.env << 6)
+                      | (soft_size_bits(src->txr.width) << 3) | soft_size_bits(src->txr.height);
+        dst->mode3 = ((uint32_t)src->txr.mipmap << 31) | (uint32_t)src->txr.format
+                     | ((uint32_t)(((uint8_t*)src->txr.base - vram) & 0xFFFFF8) >> 3);
+    }
+    dst->d1 = dst->d2 = dst->d3 = dst->d4 = 0xFFFFFFFF;
+}
+
+/* Scenes and the TA */
+void
+pvr_soft_set_render(int on) {
+    render = on;
+}
+
+const pvr_soft_stats*
+pvr_soft_get_stats(void) {
+    return &last_stats;
+}
+
+const uint32_t*
+pvr_soft_get_frame(void) {
+    return frame;
+}
+
+int
+pvr_soft_write_frame(const char* path) {
+    return soft_image_write(path, frame, PVR_SOFT_WIDTH, PVR_SOFT_HEIGHT);
+}
+
+int
+pvr_wait_ready(void) {
+    return 0;
+}
+
+int
+pvr_scene_begin(void) {
+    for (int i = 0; i < PVR_SOFT_LISTS; i++) {
+        lists[i].num_strips = 0;
+        lists[i].num_verts = 0;
+        lists[i].strip_start = 0;
+        lists[i].strip_len = 0;
+    }
+    ta_list = -1;
+    ta_sprite = 0;
+    scene_render = render;
+    return 0;
+}
+
+int
+pvr_list_begin(int list) {
+    (void)list;
+    ta_list = -1;
+    return 0;
+}
+
+int
+pvr_list_finish(void) {
+    ta_list = -1;
+    return 0;
+}
+
+static int
+soft_grow(void** buf, uint32_t* max, uint32_t need, size_t elem) {
+    if (need <= *max) {
+        return 0;
+    }
+    uint32_t size = *max ? *max : 256;
+    while (size < need) {
+        size *= 2;
+    }
+    void* grown = realloc(*buf, size * elem);
+    if (!grown) {
+        return -1;
+    }
+    *buf = grown;
+    *max = size;
+    return 0;
+}
+
+static int
+soft_list_drawn(int list) {
+    return list == PVR_LIST_OP_POLY || list == PVR_LIST_TR_POLY || list == PVR_LIST_PT_POLY;
+}
+
+static void
+soft_ta_header(const uint8_t* unit, uint32_t cmd) {
+    const int list = (cmd >> 24) & 7;
+    ta_sprite = (cmd >> 29) == (PVR_CMD_SPRITE >> 29);
+    if (list >= PVR_SOFT_LISTS) {
+        ta_list = -1;
+        return;
+    }
+    ta_list = list;
+    stats.lists[list].headers++;
+    memcpy(&lists[list].hdr, unit, sizeof(pvr_poly_hdr_t));
+    lists[list].strip_start = lists[list].num_verts;
+    lists[list].strip_len = 0;
+}
+
+static void
+soft_ta_vertex(const uint8_t* unit, uint32_t cmd) {
+    if (ta_list < 0) {
+        return;
+    }
+    soft_list* list = &lists[ta_list];
+    pvr_soft_list_stats* count = &stats.lists[ta_list];
+    const int keep = scene_render && !ta_sprite && soft_list_drawn(ta_list);
+
+    count->verts++;
+    list->strip_len++;
+    if (keep && !soft_grow((void**)&list->verts, &list->max_verts, list->num_verts + 1, sizeof(pvr_vertex_t))) {
+        memcpy(&list->verts[list->num_verts++], unit, sizeof(pvr_vertex_t));
+    }
+    if ((cmd & PVR_CMD_VERTEX_EOL) != PVR_CMD_VERTEX_EOL) {
+        return;
+    }
+
+    /* End of strip, a sprite is one quad */
+    count->strips++;
+    if (ta_sprite) {
+        count->tris += 2;
+    } else if (list->strip_len >= 3) {
+        count->tris += list->strip_len - 2;
+    }
+    if (keep && list->num_verts - list->strip_start >= 3
+        && !soft_grow((void**)&list->strips, &list->max_strips, list->num_strips + 1, sizeof(soft_strip))) {
+        soft_strip* strip = &list->strips[list->num_strips++];
+        strip->hdr = list->hdr;
+        strip->first = list->strip_start;
+        strip->count = list->num_verts - list->strip_start;
+    }
+    list->strip_start = list->num_verts;
+    list->strip_len = 0;
+}
+
+int
+pvr_prim(void* data, int size) {
+    const uint8_t* unit = (const uint8_t*)data;
+    stats.prims++;
+    stats.ta_bytes += size;
+    for (int off = 0; off + 32 <= size; off += 32) {
+        uint32_t cmd;
+        memcpy(&cmd, unit + off, sizeof(cmd));
+        switch (cmd >> 29) {
+            case PVR_CMD_POLYHDR >> 29:
+            case PVR_CMD_SPRITE >> 29: soft_ta_header(unit + off, cmd); break;
+            case PVR_CMD_VERTEX >> 29:
+                soft_ta_vertex(unit + off, cmd);
+                /* Sprite vertices take two units */
+                if (ta_sprite) {
+                    off += 32;
+                }
+                break;
+            default: break; /* user clip and end of list */
+        }
+    }
+    return 0;
+}
+
+/* Texture decoding */
+static uint32_t
+soft_tex_bytes(uint32_t mode3, uint32_t width, uint32_t height) {
+    const uint32_t pixel = (mode3 >> 27) & 7;
+    if (mode3 & PVR_TXRFMT_VQ_ENABLE) {
+        return SOFT_VQ_CODEBOOK + width * height / 4;
+    }
+    if (pixel == SOFT_PX_PAL4BPP) {
+        return width * height / 2;
+    }
+    if (pixel == SOFT_PX_PAL8BPP) {
+        return width * height;
+    }
+    return width * height * 2;
+}
+
+static inline uint32_t
+soft_expand(uint32_t value, int bits) {
+    value <<= 8 - bits;
+    return value | (value >> bits);
+}
+
+static uint32_t
+soft_argb1555(uint16_t px) {
+    return ((px & 0x8000) ? 0xFF000000 : 0) | (soft_expand((px >> 10) & 0x1F, 5) << 16)
+           | (soft_expand((px >> 5) & 0x1F, 5) << 8) | soft_expand(px & 0x1F, 5);
+}
+
+static uint32_t
+soft_rgb565(uint16_t px) {
+    return 0xFF000000 | (soft_expand(px >> 11, 5) << 16) | (soft_expand((px >> 5) & 0x3F, 6) << 8)
+           | soft_expand(px & 0x1F, 5);
+}
+
+static uint32_t
+soft_argb4444(uint16_t px) {
+    return ((uint32_t)((px >> 12) * 0x11) << 24) | ((uint32_t)(((px >> 8) & 0xF) * 0x11) << 16)
+           | ((uint32_t)(((px >> 4) & 0xF) * 0x11) << 8) | (uint32_t)((px & 0xF) * 0x11);
+}
+
+static uint32_t
+soft_yuv(int y, int u, int v) {
+    const float fu = (float)(u - 128);
+    const float fv = (float)(v - 128);
+    int rgb[3] = {(int)(y + 1.402f * fv), (int)(y - 0.344f * fu - 0.714f * fv), (int)(y + 1.772f * fu)};
+    for (int i = 0; i < 3; i++) {
+        rgb[i] = rgb[i] < 0 ? 0 : (rgb[i] > 255 ? 255 : rgb[i]);
+    }
+    return 0xFF000000 | ((uint32_t)rgb[0] << 16) | ((uint32_t)rgb[1] << 8) | (uint32_t)rgb[2];
+}
+
+static uint32_t
+soft_texel16(uint32_t pixel, uint16_t px) {
+    switch (pixel) {
+        case 0: return soft_argb1555(px);
+        case 1: return soft_rgb565(px);
+        case 2: return soft_argb4444(px);
+        case 4: return 0xFF000000 | ((uint32_t)(px >> 8) * 0x010101); /* bump, shown as its height */
+        default: return soft_rgb565(px);
+    }
+}
+
+static uint32_t
+soft_palette(uint32_t idx) {
+    const uint32_t entry = pal_ram[idx % SOFT_PAL_ENTRIES];
+    switch (pal_format) {
+        case PVR_PAL_ARGB1555: return soft_argb1555((uint16_t)entry);
+        case PVR_PAL_RGB565: return soft_rgb565((uint16_t)entry);
+        case PVR_PAL_ARGB4444: return soft_argb4444((uint16_t)entry);
+        default: return entry;
+    }
+}
+
+/* Morton order with y in the low bit. A rectangle is a run of squares the
+ * size of its short side, one after the other along the long side */
+static void
+soft_twiddle_table(uint32_t* table, uint32_t count, int shift) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t bits = 0;
+        for (int bit = 0; (1u << bit) <= i; bit++) {
+            bits |= ((i >> bit) & 1) << (2 * bit + shift);
+        }
+        table[i] = bits;
+    }
+}
+
+static void
+soft_tex_decode(soft_texture* tex) {
+    static uint32_t tw_x[SOFT_TEX_MAX];
+    static uint32_t tw_y[SOFT_TEX_MAX];
+    const uint32_t mode3 = tex->mode3;
+    const uint32_t pixel = (mode3 >> 27) & 7;
+    const int vq = (mode3 & PVR_TXRFMT_VQ_ENABLE) != 0;
+    const int paletted = pixel == SOFT_PX_PAL4BPP || pixel == SOFT_PX_PAL8BPP;
+    const int twiddled = vq || paletted || !(mode3 & PVR_TXRFMT_NONTWIDDLED);
+    const uint8_t* base = vram + tex->offset;
+    const uint16_t* base16 = (const uint16_t*)base;
+
+    /* VQ indices are twiddled over 2x2 blocks, the block size is what is twiddled */
+    const uint32_t tw_w = vq ? tex->width / 2 : tex->width;
+    const uint32_t tw_h = vq ? tex->height / 2 : tex->height;
+    const uint32_t side = (tw_w < tw_h) ? tw_w : tw_h;
+    if (twiddled) {
+        soft_twiddle_table(tw_x, side, 1);
+        soft_twiddle_table(tw_y, side, 0);
+    }
+
+    uint32_t* out = tex->argb;
+    for (uint32_t y = 0; y < tex->height; y++) {
+        for (uint32_t x = 0; x < tex->width; x++) {
+            const uint32_t tx = vq ? x / 2 : x;
+            const uint32_t ty = vq ? y / 2 : y;
+            uint32_t idx;
+            if (twiddled) {
+                const uint32_t square = (tw_w < tw_h) ? ty / side : tx / side;
+                idx = square * side * side + (tw_x[tx % side] | tw_y[ty % side]);
+            } else {
+                idx = ty * tw_w + tx;
+            }
+
+            if (vq) {
+                const uint32_t code = base[SOFT_VQ_CODEBOOK + idx];
+                *out++ = soft_texel16(pixel, base16[code * 4 + ((x & 1) << 1) + (y & 1)]);
+            } else if (pixel == SOFT_PX_PAL4BPP) {
+                const uint32_t nibble = (base[idx / 2] >> ((idx & 1) * 4)) & 0xF;
+                *out++ = soft_palette(((mode3 >> 21) & 0x3F) * 16 + nibble);
+            } else if (pixel == SOFT_PX_PAL8BPP) {
+                *out++ = soft_palette(((mode3 >> 25) & 0x3) * 256 + base[idx]);
+            } else if (pixel == 3) {
+                /* YUV422, the two texels next to each other in memory share U and V */
+                const uint16_t first = base16[idx & ~1u];
+                const uint16_t second = base16[idx | 1];
+                *out++ = soft_yuv(base16[idx] >> 8, first & 0xFF, second & 0xFF);
+            } else {
+                *out++ = soft_texel16(pixel, base16[idx]);
+            }
+        }
+    }
+}
+
+static const soft_texture*
+soft_tex_get(uint32_t mode3, uint32_t width, uint32_t height) {
+    const uint32_t pixel = (mode3 >> 27) & 7;
+    const uint32_t gen = (pixel == SOFT_PX_PAL4BPP || pixel == SOFT_PX_PAL8BPP) ? pal_gen : 0;
+    const uint32_t offset = (mode3 & 0x1FFFFF) << 3;
+    const uint32_t size = soft_tex_bytes(mode3, width, height);
+    if (offset + size > SOFT_VRAM_SIZE) {
+        return NULL;
+    }
+
+    soft_texture* victim = &tex_cache[0];
+    for (int i = 0; i < SOFT_TEX_CACHE; i++) {
+        soft_texture* tex = &tex_cache[i];
+        if (tex->valid && tex->mode3 == mode3 && tex->width == width && tex->height == height
+            && tex->pal_gen == gen) {
+            tex->used = ++tex_clock;
+            return tex;
+        }
+        if (victim->valid && (!tex->valid || tex->used < victim->used)) {
+            victim = tex;
+        }
+    }
+
+    if (width * height > victim->capacity) {
+        uint32_t* argb = realloc(victim->argb, width * height * sizeof(uint32_t));
+        if (!argb) {
+            return NULL;
+        }
+        victim->argb = argb;
+        victim->capacity = width * height;
+    }
+    victim->mode3 = mode3;
+    victim->width = width;
+    victim->height = height;
+    victim->offset = offset;
+    victim->size = size;
+    victim->pal_gen = gen;
+    victim->used = ++tex_clock;
+    victim->valid = 1;
+    soft_tex_decode(victim);
+    return victim;
+}
+
+/* Rasterizing */
+static int
+soft_shade_setup(soft_shade* shade, const pvr_poly_hdr_t* hdr, int list) {
+    /* Only packed colour with 32 bit UVs, what pvr_vertex_t holds */
+    if (((hdr->cmd >> 4) & 3) != PVR_CLRFMT_ARGBPACKED || (hdr->cmd & 1)) {
+        return -1;
+    }
+    memset(shade, 0, sizeof(*shade));
+    if (hdr->cmd & (1 << 3)) {
+        const uint32_t width = 8u << ((hdr->mode2 >> 3) & 7);
+        const uint32_t height = 8u << (hdr->mode2 & 7);
+        const soft_texture* tex = soft_tex_get(hdr->mode3, width, height);
+        if (!tex) {
+            return -1;
+        }
+        shade->texels = tex->argb;
+        shade->tex_w = (int)width;
+        shade->tex_h = (int)height;
+        shade->txr_alpha = !((hdr->mode2 >> 19) & 1);
+        shade->flip_u = (hdr->mode2 >> 18) & 1;
+        shade->flip_v = (hdr->mode2 >> 17) & 1;
+        shade->clamp_u = (hdr->mode2 >> 16) & 1;
+        shade->clamp_v = (hdr->mode2 >> 15) & 1;
+        shade->bilinear = ((hdr->mode2 >> 12) & 7) != PVR_FILTER_NEAREST;
+        shade->env = (hdr->mode2 >> 6) & 3;
+    }
+    shade->depth_cmp = hdr->mode1 >> 29;
+    shade->depth_write = !((hdr->mode1 >> 26) & 1);
+    shade->src = hdr->mode2 >> 29;
+    shade->dst = (hdr->mode2 >> 26) & 7;
+    shade->vert_alpha = (hdr->mode2 >> 20) & 1;
+    shade->gouraud = (hdr->cmd >> 1) & 1;
+    shade->punch = list == PVR_LIST_PT_POLY;
+    return 0;
+}
+
+static inline uint32_t
+soft_mul8(uint32_t a, uint32_t b) {
+    const uint32_t t = a * b + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+static inline int
+soft_wrap(int i, int size, int clamp, int flip) {
+    if (clamp) {
+        return i < 0 ? 0 : (i >= size ? size - 1 : i);
+    }
+    if (flip && (i & size)) {
+        return (size - 1) - (i & (size - 1));
+    }
+    return i & (size - 1);
+}
+
+static inline int
+soft_floor(float f) {
+    const int i = (int)f;
+    return i - (f < (float)i);
+}
+
+/* The texels a coordinate falls between and the weight of the second, 0 to
+ * 256. Point sampling is the first one with no weight */
+static inline void
+soft_texel_pair(const soft_shade* s, float f, int size, int clamp, int flip, int* i0, int* i1, uint32_t* w) {
+    if (!s->bilinear) {
+        *i0 = *i1 = soft_wrap(soft_floor(f * size), size, clamp, flip);
+        *w = 0;
+        return;
+    }
+    const float ff = f * size - 0.5f;
+    const int i = soft_floor(ff);
+    *i0 = soft_wrap(i, size, clamp, flip);
+    *i1 = soft_wrap(i + 1, size, clamp, flip);
+    *w = (uint32_t)((ff - (float)i) * 256.0f);
+}
+
+/* y0 and y1 are row offsets into texels */
+static inline uint32_t
+soft_filter(const soft_shade* s, int y0, int y1, int x0, int x1, uint32_t wx, uint32_t wy) {
+    const uint32_t t00 = s->texels[y0 + x0];
+    /* Texel centres, which is every pixel of a 1:1 image */
+    if (!wx && !wy) {
+        return t00;
+    }
+    const uint32_t t01 = s->texels[y0 + x1];
+    const uint32_t t10 = s->texels[y1 + x0];
+    const uint32_t t11 = s->texels[y1 + x1];
+    if (t00 == t01 && t00 == t10 && t00 == t11) {
+        return t00;
+    }
+
+    uint32_t out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        const uint32_t top = ((t00 >> shift) & 0xFF) * (256 - wx) + ((t01 >> shift) & 0xFF) * wx;
+        const uint32_t bottom = ((t10 >> shift) & 0xFF) * (256 - wx) + ((t11 >> shift) & 0xFF) * wx;
+        out |= (((top * (256 - wy) + bottom * wy) >> 16) & 0xFF) << shift;
+    }
+    return out;
+}
+
+static inline uint32_t
+soft_sample(const soft_shade* s, float u, float v) {
+    int x0, x1, y0, y1;
+    uint32_t wx, wy;
+    soft_texel_pair(s, u, s->tex_w, s->clamp_u, s->flip_u, &x0, &x1, &wx);
+    soft_texel_pair(s, v, s->tex_h, s->clamp_v, s->flip_v, &y0, &y1, &wy);
+    return soft_filter(s, y0 * s->tex_w, y1 * s->tex_w, x0, x1, wx, wy);
+}
+
+static inline uint32_t
+soft_combine(const soft_shade* s, uint32_t col, uint32_t tex) {
+    if (!s->vert_alpha) {
+        col |= 0xFF000000;
+    }
+    if (!s->texels) {
+        return col;
+    }
+    if (!s->txr_alpha) {
+        tex |= 0xFF000000;
+    }
+    /* Images are mostly drawn in white */
+    if (col == 0xFFFFFFFF && (s->env == PVR_TXRENV_MODULATE || s->env == PVR_TXRENV_MODULATEALPHA)) {
+        return tex;
+    }
+
+    uint32_t out = 0;
+    const uint32_t ta = tex >> 24;
+    for (int shift = 0; shift < 24; shift += 8) {
+        const uint32_t t = (tex >> shift) & 0xFF;
+        const uint32_t c = (col >> shift) & 0xFF;
+        uint32_t channel;
+        switch (s->env) {
+            case PVR_TXRENV_REPLACE: channel = t; break;
+            case PVR_TXRENV_DECAL: channel = soft_mul8(t, ta) + soft_mul8(c, 255 - ta); break;
+            default: channel = soft_mul8(t, c); break;
+        }
+        out |= channel << shift;
+    }
+    switch (s->env) {
+        case PVR_TXRENV_DECAL: return out | (col & 0xFF000000);
+        case PVR_TXRENV_MODULATEALPHA: return out | (soft_mul8(ta, col >> 24) << 24);
+        default: return out | (tex & 0xFF000000);
+    }
+}
+
+/* The second and third factors are the other colour, dst for src and src for dst */
+static inline uint32_t
+soft_factor(int mode, uint32_t other, uint32_t sa, uint32_t da) {
+    switch (mode) {
+        case PVR_BLEND_ZERO: return 0;
+        case PVR_BLEND_ONE: return 255;
+        case PVR_BLEND_DESTCOLOR: return other;
+        case PVR_BLEND_INVDESTCOLOR: return 255 - other;
+        case PVR_BLEND_SRCALPHA: return sa;
+        case PVR_BLEND_INVSRCALPHA: return 255 - sa;
+        case PVR_BLEND_DESTALPHA: return da;
+        default: return 255 - da;
+    }
+}
+
+static inline uint32_t
+soft_blend(const soft_shade* s, uint32_t src, uint32_t dst) {
+    if (s->src == PVR_BLEND_ONE && s->dst == PVR_BLEND_ZERO) {
+        return src;
+    }
+    const uint32_t sa = src >> 24;
+    const uint32_t da = dst >> 24;
+    if (s->src == PVR_BLEND_SRCALPHA && s->dst == PVR_BLEND_INVSRCALPHA && (sa == 0 || sa == 255)) {
+        return sa ? src : dst;
+    }
+    uint32_t out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        const uint32_t sc = (src >> shift) & 0xFF;
+        const uint32_t dc = (dst >> shift) & 0xFF;
+        const uint32_t channel = soft_mul8(sc, soft_factor(s->src, dc, sa, da))
+                                 + soft_mul8(dc, soft_factor(s->dst, sc, sa, da));
+        out |= (channel > 255 ? 255 : channel) << shift;
+    }
+    return out;
+}
+
+static inline int
+soft_depth_pass(int cmp, float z, float current) {
+    switch (cmp) {
+        case PVR_DEPTHCMP_NEVER: return 0;
+        case PVR_DEPTHCMP_LESS: return z < current;
+        case PVR_DEPTHCMP_EQUAL: return z == current;
+        case PVR_DEPTHCMP_LEQUAL: return z <= current;
+        case PVR_DEPTHCMP_GREATER: return z > current;
+        case PVR_DEPTHCMP_NOTEQUAL: return z != current;
+        case PVR_DEPTHCMP_GEQUAL: return z >= current;
+        default: return 1;
+    }
+}
+
+static inline void
+soft_plot(const soft_shade* s, int index, float z, uint32_t color) {
+    if (!soft_depth_pass(s->depth_cmp, z, depth[index])) {
+        return;
+    }
+    if (s->punch && (color >> 24) < SOFT_PT_ALPHA_REF) {
+        return;
+    }
+    frame[index] = soft_blend(s, color, frame[index]);
+    if (s->depth_write) {
+        depth[index] = z;
+    }
+    stats.pixels++;
+}
+
+/* A pixel nothing has touched this scene, the background colour at depth 0.
+ * pass is the depth test against that */
+static inline void
+soft_plot_fresh(const soft_shade* s, int index, float z, uint32_t color, int pass) {
+    if (!pass || (s->punch && (color >> 24) < SOFT_PT_ALPHA_REF)) {
+        frame[index] = bg_color;
+        depth[index] = 0.0f;
+        return;
+    }
+    frame[index] = soft_blend(s, color, bg_color);
+    depth[index] = s->depth_write ? z : 0.0f;
+    stats.pixels++;
+}
+
+static void
+soft_row_clear(int y, int upto) {
+    const int index = y * PVR_SOFT_WIDTH;
+    for (int x = row_fill[y]; x < upto; x++) {
+        frame[index + x] = bg_color;
+        depth[index + x] = 0.0f;
+    }
+    if (upto > row_fill[y]) {
+        row_fill[y] = (uint16_t)upto;
+    }
+}
+
+/* Pixels whose centres are in [lo, hi) */
+static void
+soft_span(float lo, float hi, int limit, int* first, int* last) {
+    *first = (int)ceilf(lo - 0.5f);
+    *last = (int)ceilf(hi - 0.5f);
+    if (*first < 0) {
+        *first = 0;
+    }
+    if (*last > limit) {
+        *last = limit;
+    }
+}
+
+/* What draw_kos sends for every quad, a flat four vertex strip with the
+ * edges on the axes, drawn without the triangle setup */
+static int
+soft_is_rect(const pvr_vertex_t* v) {
+    return v[0].x == v[1].x && v[2].x == v[3].x && v[0].y == v[2].y && v[1].y == v[3].y && v[0].u == v[1].u
+           && v[2].u == v[3].u && v[0].v == v[2].v && v[1].v == v[3].v && v[0].z == v[1].z && v[0].z == v[2].z
+           && v[0].z == v[3].z && v[0].argb == v[1].argb && v[0].argb == v[2].argb && v[0].argb == v[3].argb;
+}
+
+static void
+soft_draw_rect(const soft_shade* s, const pvr_vertex_t* v) {
+    static int col0[PVR_SOFT_WIDTH], col1[PVR_SOFT_WIDTH];
+    static uint32_t col_w[PVR_SOFT_WIDTH];
+
+    const float xa = v[0].x;
+    const float ya = v[0].y;
+    if (xa == v[2].x || ya == v[1].y) {
+        return;
+    }
+    const float du = (v[2].u - v[0].u) / (v[2].x - xa);
+    const float dv = (v[1].v - v[0].v) / (v[1].y - ya);
+    int x0, x1, y0, y1;
+    soft_span(fminf(xa, v[2].x), fmaxf(xa, v[2].x), PVR_SOFT_WIDTH, &x0, &x1);
+    soft_span(fminf(ya, v[1].y), fmaxf(ya, v[1].y), PVR_SOFT_HEIGHT, &y0, &y1);
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    const float z = v[0].z;
+    const uint32_t color = v[0].argb;
+    const uint32_t flat = soft_combine(s, color, 0);
+    const int fresh_pass = soft_depth_pass(s->depth_cmp, z, 0.0f);
+
+    /* u only changes along x and v along y, the texels and weights of each
+     * column are worked out once and each row's once, no float work is left
+     * per pixel. Images drawn 1:1 or point sampled need no weights at all */
+    int point = 1;
+    for (int x = x0; s->texels && x < x1; x++) {
+        const float fu = v[0].u + ((float)x + 0.5f - xa) * du;
+        soft_texel_pair(s, fu, s->tex_w, s->clamp_u, s->flip_u, &col0[x], &col1[x], &col_w[x]);
+        point &= !col_w[x];
+    }
+
+    for (int y = y0; y < y1; y++) {
+        const int row = y * PVR_SOFT_WIDTH;
+        if (row_fill[y] < x0) {
+            soft_row_clear(y, x0);
+        }
+        /* [x0, split) holds this scene already, [split, x1) is untouched */
+        const int split = (row_fill[y] < x1) ? row_fill[y] : x1;
+        const float fv = v[0].v + ((float)y + 0.5f - ya) * dv;
+
+        if (!s->texels) {
+            /* Untextured, one colour for the whole span */
+            for (int x = x0; x < split; x++) {
+                soft_plot(s, row + x, z, flat);
+            }
+            if (split < x1) {
+                const int drawn = fresh_pass && !(s->punch && (flat >> 24) < SOFT_PT_ALPHA_REF);
+                const uint32_t out = drawn ? soft_blend(s, flat, bg_color) : bg_color;
+                const float out_z = (drawn && s->depth_write) ? z : 0.0f;
+                for (int x = split; x < x1; x++) {
+                    frame[row + x] = out;
+                    depth[row + x] = out_z;
+                }
+                stats.pixels += drawn ? (uint32_t)(x1 - split) : 0;
+            }
+        } else {
+            int row0, row1;
+            uint32_t wy;
+            soft_texel_pair(s, fv, s->tex_h, s->clamp_v, s->flip_v, &row0, &row1, &wy);
+            row0 *= s->tex_w;
+            row1 *= s->tex_w;
+            if (point && !wy) {
+                const uint32_t* texels = &s->texels[row0];
+                for (int x = x0; x < split; x++) {
+                    soft_plot(s, row + x, z, soft_combine(s, color, texels[col0[x]]));
+                }
+                for (int x = split; x < x1; x++) {
+                    soft_plot_fresh(s, row + x, z, soft_combine(s, color, texels[col0[x]]), fresh_pass);
+                }
+            } else {
+                for (int x = x0; x < split; x++) {
+                    const uint32_t texel = soft_filter(s, row0, row1, col0[x], col1[x], col_w[x], wy);
+                    soft_plot(s, row + x, z, soft_combine(s, color, texel));
+                }
+                for (int x = split; x < x1; x++) {
+                    const uint32_t texel = soft_filter(s, row0, row1, col0[x], col1[x], col_w[x], wy);
+                    soft_plot_fresh(s, row + x, z, soft_combine(s, color, texel), fresh_pass);
+                }
+            }
+        }
+        if (row_fill[y] < x1) {
+            row_fill[y] = (uint16_t)x1;
+        }
+    }
+}
+
+static inline float
+soft_edge(const pvr_vertex_t* a, const pvr_vertex_t* b, float x, float y) {
+    return (b->x - a->x) * (y - a->y) - (b->y - a->y) * (x - a->x);
+}
+
+/* Shared edges go to exactly one of the two triangles, the one they run
+ * down or right in */
+static inline int
+soft_edge_owned(const pvr_vertex_t* a, const pvr_vertex_t* b) {
+    return (b->y > a->y) || (b->y == a->y && b->x > a->x);
+}
+
+static inline uint32_t
+soft_lerp_color(uint32_t c0, uint32_t c1, uint32_t c2, float w0, float w1, float w2) {
+    uint32_t out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        const float channel = ((c0 >> shift) & 0xFF) * w0 + ((c1 >> shift) & 0xFF) * w1 + ((c2 >> shift) & 0xFF) * w2;
+        const int value = (int)(channel + 0.5f);
+        out |= (uint32_t)(value < 0 ? 0 : (value > 255 ? 255 : value)) << shift;
+    }
+    return out;
+}
+
+static void
+soft_draw_tri(const soft_shade* s, const pvr_vertex_t* a, const pvr_vertex_t* b, const pvr_vertex_t* c) {
+    float area = soft_edge(a, b, c->x, c->y);
+    if (area == 0.0f) {
+        return;
+    }
+    /* Flat shading takes the colour of the last vertex, keep it before any swap */
+    const uint32_t flat = c->argb;
+    if (area < 0.0f) {
+        const pvr_vertex_t* t = b;
+        b = c;
+        c = t;
+        area = -area;
+    }
+    const int own_a = soft_edge_owned(b, c);
+    const int own_b = soft_edge_owned(c, a);
+    const int own_c = soft_edge_owned(a, b);
+    /* z is 1/w, UVs are interpolated over w like the hardware does */
+    const int perspective = a->z > 0.0f && b->z > 0.0f && c->z > 0.0f;
+
+    int x0, x1, y0, y1;
+    soft_span(fminf(a->x, fminf(b->x, c->x)), fmaxf(a->x, fmaxf(b->x, c->x)), PVR_SOFT_WIDTH, &x0, &x1);
+    soft_span(fminf(a->y, fminf(b->y, c->y)), fmaxf(a->y, fmaxf(b->y, c->y)), PVR_SOFT_HEIGHT, &y0, &y1);
+    for (int y = y0; y < y1; y++) {
+        const float py = (float)y + 0.5f;
+        soft_row_clear(y, x1);
+        for (int x = x0; x < x1; x++) {
+            const float px = (float)x + 0.5f;
+            const float e0 = soft_edge(b, c, px, py);
+            const float e1 = soft_edge(c, a, px, py);
+            const float e2 = soft_edge(a, b, px, py);
+            if (e0 < 0.0f || e1 < 0.0f || e2 < 0.0f || (e0 == 0.0f && !own_a) || (e1 == 0.0f && !own_b)
+                || (e2 == 0.0f && !own_c)) {
+                continue;
+            }
+            const float w0 = e0 / area;
+            const float w1 = e1 / area;
+            const float w2 = e2 / area;
+            const float z = a->z * w0 + b->z * w1 + c->z * w2;
+            const uint32_t color = s->gouraud ? soft_lerp_color(a->argb, b->argb, c->argb, w0, w1, w2) : flat;
+            uint32_t texel = 0;
+            if (s->texels) {
+                float u, v;
+                if (perspective) {
+                    u = (a->u * a->z * w0 + b->u * b->z * w1 + c->u * c->z * w2) / z;
+                    v = (a->v * a->z * w0 + b->v * b->z * w1 + c->v * c->z * w2) / z;
+                } else {
+                    u = a->u * w0 + b->u * w1 + c->u * w2;
+                    v = a->v * w0 + b->v * w1 + c->v * w2;
+                }
+                texel = soft_sample(s, u, v);
+            }
+            soft_plot(s, y * PVR_SOFT_WIDTH + x, z, soft_combine(s, color, texel));
+        }
+    }
+}
+
+/* Autosort order, nearest vertex of each strip with the submission order
+ * breaking ties so equal depths keep the order they were sent in */
+typedef struct soft_sort_key {
+    float z;
+    uint32_t strip;
+} soft_sort_key;
+
+static int
+soft_sort_cmp(const void* a, const void* b) {
+    const soft_sort_key* ka = (const soft_sort_key*)a;
+    const soft_sort_key* kb = (const soft_sort_key*)b;
+    if (ka->z != kb->z) {
+        return (ka->z < kb->z) ? -1 : 1;
+    }
+    return (ka->strip < kb->strip) ? -1 : (ka->strip > kb->strip);
+}
+
+/* Strip indexes of list back to front, z is 1/w so smaller is further */
+static const soft_sort_key*
+soft_sort_strips(const soft_list* list) {
+    static soft_sort_key* keys = NULL;
+    static uint32_t max_keys = 0;
+
+    if (soft_grow((void**)&keys, &max_keys, list->num_strips, sizeof(soft_sort_key))) {
+        return NULL;
+    }
+    for (uint32_t i = 0; i < list->num_strips; i++) {
+        const soft_strip* strip = &list->strips[i];
+        float z = list->verts[strip->first].z;
+        for (uint32_t v = 1; v < strip->count; v++) {
+            z = fmaxf(z, list->verts[strip->first + v].z);
+        }
+        keys[i].z = z;
+        keys[i].strip = i;
+    }
+    qsort(keys, list->num_strips, sizeof(soft_sort_key), soft_sort_cmp);
+    return keys;
+}
+
+static void
+soft_render_scene(void) {
+    static const int order[] = {PVR_LIST_OP_POLY, PVR_LIST_PT_POLY, PVR_LIST_TR_POLY};
+
+    memset(row_fill, 0, sizeof(row_fill));
+    for (size_t l = 0; l < sizeof(order) / sizeof(order[0]); l++) {
+        const soft_list* list = &lists[order[l]];
+        const int sorted = autosort && order[l] == PVR_LIST_TR_POLY;
+        const soft_sort_key* keys = sorted ? soft_sort_strips(list) : NULL;
+        for (uint32_t i = 0; i < list->num_strips; i++) {
+            const soft_strip* strip = &list->strips[keys ? keys[i].strip : i];
+            const pvr_vertex_t* v = &list->verts[strip->first];
+            soft_shade shade;
+            if (soft_shade_setup(&shade, &strip->hdr, order[l])) {
+                continue;
+            }
+            if (sorted) {
+                /* Sorted polygons are blended in that order, the depth test is skipped */
+                shade.depth_cmp = PVR_DEPTHCMP_ALWAYS;
+                shade.depth_write = 0;
+            }
+            if (strip->count == 4 && soft_is_rect(v)) {
+                soft_draw_rect(&shade, v);
+                continue;
+            }
+            for (uint32_t t = 0; t + 2 < strip->count; t++) {
+                soft_draw_tri(&shade, &v[t], &v[t + 1], &v[t + 2]);
+            }
+        }
+    }
+    /* Whatever nothing was drawn over */
+    for (int y = 0; y < PVR_SOFT_HEIGHT; y++) {
+        soft_row_clear(y, PVR_SOFT_WIDTH);
+    }
+}
+
+int
+pvr_scene_finish(void) {
+    ta_list = -1;
+    if (scene_render) {
+        soft_render_scene();
+    }
+    /* Uploads between scenes, from input handling or a UI loading, go to
+     * the scene after them */
+    last_stats = stats;
+    memset(&stats, 0, sizeof(stats));
+    return 0;
+}
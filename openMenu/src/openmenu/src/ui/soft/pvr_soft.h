@@ -0,0 +1,48 @@
+/*
+ * File: pvr_soft.h
+ * Project: soft
+ * File Created: Monday, 19th October 2026 3:02:51 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <dc/pvr.h>
+
+/* Host PowerVR behind the <dc/pvr.h> stand in. Everything sent with pvr_prim
+ * is parsed the way the TA would and counted per list, with rendering on the
+ * scene is also rasterized into an ARGB8888 frame when it finishes */
+
+#define PVR_SOFT_WIDTH  (640)
+#define PVR_SOFT_HEIGHT (480)
+#define PVR_SOFT_LISTS  (5)
+
+typedef struct pvr_soft_list_stats {
+    uint32_t headers;
+    uint32_t verts;
+    uint32_t strips;
+    uint32_t tris;
+} pvr_soft_list_stats;
+
+typedef struct pvr_soft_stats {
+    uint32_t prims;     /* pvr_prim calls */
+    uint32_t ta_bytes;  /* everything that went through the TA */
+    uint32_t txr_loads; /* pvr_txr_load calls since the scene before */
+    uint32_t txr_bytes;
+    uint32_t pixels; /* written, rendered scenes only */
+    pvr_soft_list_stats lists[PVR_SOFT_LISTS];
+} pvr_soft_stats;
+
+/* Off by default, scenes are then only counted which costs next to nothing */
+void pvr_soft_set_render(int render);
+/* Of the last finished scene */
+const pvr_soft_stats* pvr_soft_get_stats(void);
+/* PVR_SOFT_WIDTH x PVR_SOFT_HEIGHT ARGB8888, the last rendered scene */
+const uint32_t* pvr_soft_get_frame(void);
+/* PNG or PPM going by the extension, 0 on success */
+int pvr_soft_write_frame(const char* path);
@@ -0,0 +1,153 @@
+/*
+ * File: soft_image.c
+ * Project: soft
+ * File Created: Monday, 19th October 2026 3:41:52 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "soft_image.h"
+
+/* Stored deflate blocks hold at most this much */
+#define PNG_BLOCK_MAX (65535)
+
+static uint32_t crc_table[256];
+
+static void
+png_crc_init(void) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        crc_table[n] = c;
+    }
+}
+
+static uint32_t
+png_crc(uint32_t crc, const uint8_t* buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        crc = crc_table[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static void
+png_put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static int
+png_chunk(FILE* out, const char* type, const uint8_t* data, uint32_t size) {
+    uint8_t head[8];
+    uint8_t tail[4];
+    png_put32(head, size);
+    memcpy(head + 4, type, 4);
+    png_put32(tail, png_crc(png_crc(0xFFFFFFFFu, head + 4, 4), data, size) ^ 0xFFFFFFFFu);
+    return fwrite(head, sizeof(head), 1, out) != 1 || (size && fwrite(data, size, 1, out) != 1)
+           || fwrite(tail, sizeof(tail), 1, out) != 1;
+}
+
+static int
+png_write(FILE* out, const uint32_t* argb, int width, int height) {
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    const size_t stride = 1 + (size_t)width * 3;
+    const size_t raw_size = stride * height;
+    const size_t blocks = (raw_size + PNG_BLOCK_MAX - 1) / PNG_BLOCK_MAX;
+    const size_t zlib_size = 2 + raw_size + blocks * 5 + 4;
+    uint8_t* raw = malloc(raw_size);
+    uint8_t* zlib = malloc(zlib_size);
+    int ret = -1;
+    if (!raw || !zlib) {
+        goto out;
+    }
+
+    /* Scanlines with filter type 0 */
+    uint8_t* row = raw;
+    for (int y = 0; y < height; y++) {
+        *row++ = 0;
+        for (int x = 0; x < width; x++) {
+            const uint32_t px = argb[y * width + x];
+            *row++ = (uint8_t)(px >> 16);
+            *row++ = (uint8_t)(px >> 8);
+            *row++ = (uint8_t)px;
+        }
+    }
+
+    /* zlib stream of stored blocks, then the adler32 */
+    uint8_t* z = zlib;
+    uint32_t s1 = 1, s2 = 0;
+    *z++ = 0x78;
+    *z++ = 0x01;
+    for (size_t off = 0; off < raw_size; off += PNG_BLOCK_MAX) {
+        const size_t len = (raw_size - off < PNG_BLOCK_MAX) ? raw_size - off : PNG_BLOCK_MAX;
+        *z++ = (off + len == raw_size) ? 1 : 0;
+        *z++ = (uint8_t)len;
+        *z++ = (uint8_t)(len >> 8);
+        *z++ = (uint8_t)~len;
+        *z++ = (uint8_t)(~len >> 8);
+        memcpy(z, raw + off, len);
+        z += len;
+        for (size_t i = 0; i < len; i++) {
+            s1 = (s1 + raw[off + i]) % 65521;
+            s2 = (s2 + s1) % 65521;
+        }
+    }
+    png_put32(z, (s2 << 16) | s1);
+
+    uint8_t ihdr[13];
+    png_put32(ihdr, (uint32_t)width);
+    png_put32(ihdr + 4, (uint32_t)height);
+    ihdr[8] = 8; /* bit depth */
+    ihdr[9] = 2; /* RGB */
+    ihdr[10] = ihdr[11] = ihdr[12] = 0;
+
+    png_crc_init();
+    if (fwrite(signature, sizeof(signature), 1, out) != 1 || png_chunk(out, "IHDR", ihdr, sizeof(ihdr))
+        || png_chunk(out, "IDAT", zlib, (uint32_t)zlib_size) || png_chunk(out, "IEND", NULL, 0)) {
+        goto out;
+    }
+    ret = 0;
+
+out:
+    free(raw);
+    free(zlib);
+    return ret;
+}
+
+static int
+ppm_write(FILE* out, const uint32_t* argb, int width, int height) {
+    fprintf(out, "P6\n%d %d\n255\n", width, height);
+    for (int i = 0; i < width * height; i++) {
+        const uint8_t rgb[3] = {(uint8_t)(argb[i] >> 16), (uint8_t)(argb[i] >> 8), (uint8_t)argb[i]};
+        if (fwrite(rgb, sizeof(rgb), 1, out) != 1) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int
+soft_image_write(const char* path, const uint32_t* argb, int width, int height) {
+    const char* ext = strrchr(path, '.');
+    FILE* out = fopen(path, "wb");
+    if (!out) {
+        return -1;
+    }
+    int ret = (ext && !strcasecmp(ext, ".ppm")) ? ppm_write(out, argb, width, height)
+                                                : png_write(out, argb, width, height);
+    if (fclose(out)) {
+        ret = -1;
+    }
+    return ret;
+}
@@ -0,0 +1,17 @@
+/*
+ * File: soft_image.h
+ * Project: soft
+ * File Created: Monday, 19th October 2026 3:40:07 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/* ARGB8888 out as 24 bit RGB, a .ppm path gives a binary PPM and anything
+ * else an uncompressed PNG. 0 on success */
+int soft_image_write(const char* path, const uint32_t* argb, int width, int height);
@@ -14,7 +14,10 @@
 #include <string.h>
 #include <strings.h>
 
+#define LOG_MODULE THEME
+#include <dbgprint.h>
 #include <ini.h>
+#include <om_reader.h>
 #include "ui/draw_prototypes.h"
 
 #include "ui/theme_manager.h"
@@ -85,16 +88,6 @@ select_art_by_aspect(CFG_ASPECT aspect) {
     }
 }
 
-static inline long int
-filelength(file_t f) {
-    long int end;
-    fs_seek(f, 0, SEEK_END);
-    end = fs_tell(f);
-    fs_seek(f, 0, SEEK_SET);
-
-    return end;
-}
-
 static uint32_t
 str2argb(const char* str) {
     char *token, *temp, *tofree, *endptr;
@@ -133,11 +126,11 @@ read_theme_ini(void* user, const char* section, const char* name, const char* va
         } else if (strcasecmp(name, "MENU_BKG_BORDER_COLOR") == 0) {
             new_color->menu_bkg_border_color = str2argb(value);
         } else {
-            /* printf("Unknown theme value: %s\n", name); */
+            LOG_DEBUG("Unknown theme value: %s\n", name);
         }
     } else {
         /* error */
-        /* printf("INI:Error unknown [%s] %s: %s\n", section, name, value); */
+        LOG_DEBUG("INI:Error unknown [%s] %s: %s\n", section, name, value);
     }
     return 1;
 }
@@ -199,11 +192,11 @@ read_scroll_theme_ini(void* user, const char* section, const char* name, const c
         } else if (strcasecmp(name, "POS_GAMETXR_Y") == 0) {
             new_theme->pos_gametxr_y = atoi(value);
         } else {
-            /* printf("Unknown theme value: %s\n", name); */
+            LOG_DEBUG("Unknown theme value: %s\n", name);
         }
     } else {
         /* error */
-        /* printf("INI:Error unknown [%s] %s: %s\n", section, name, value); */
+        LOG_DEBUG("INI:Error unknown [%s] %s: %s\n", section, name, value);
     }
     return 1;
 }
@@ -262,25 +255,12 @@ read_folder_theme_ini(void* user, const char* section, const char* name, const c
 
 int
 theme_read(const char* filename, void* theme, int type) {
-    file_t ini = fs_open(filename, O_RDONLY);
-    if (ini == -1) {
-        /* printf("INI:Error opening %s!\n", filename); */
-        /* fflush(stdout); */
-        return -1;
-    }
-
-    size_t ini_size = filelength(ini);
-    char* ini_buffer = malloc(ini_size + 1);  /* +1 for null terminator */
+    /* Already null-terminated for ini_parse_string */
+    char* ini_buffer = om_read_file(filename, NULL, NULL);
     if (!ini_buffer) {
-        /* printf("%s no free memory\n", __func__); */
-        fs_close(ini);
+        LOG_WARN("INI:Error opening %s!\n", filename);
         return -1;
     }
-    ssize_t bytes_read = fs_read(ini, ini_buffer, ini_size);
-    fs_close(ini);
-
-    /* Null-terminate the buffer for ini_parse_string */
-    ini_buffer[bytes_read > 0 ? (size_t)bytes_read : 0] = '\0';
 
     int (*parser)(void*, const char*, const char*, const char*);
     if (type == 0) {
@@ -293,8 +273,7 @@ theme_read(const char* filename, void* theme, int type) {
 
     int parse_result = ini_parse_string(ini_buffer, parser, theme);
     if (parse_result < 0) {
-        /* printf("INI:Error Parsing %s!\n", filename); */
-        /* fflush(stdout); */
+        LOG_WARN("INI:Error Parsing %s!\n", filename);
         free(ini_buffer);
         return -1;
     }
@@ -323,7 +302,7 @@ load_themes(char* basePath) {
                 strcat(path, dp->d_name);
                 strcat(path, "/");
 
-                /* printf("theme #%d: %s @ %s\n", theme_num, dp->d_name, path); */
+                LOG_DEBUG("theme #%d: %s @ %s\n", theme_num, dp->d_name, path);
 
                 /* Add the theme */
                 strcpy(custom_themes[num_custom_themes].bg_left, path + 4);
@@ -355,7 +334,7 @@ load_themes(char* basePath) {
                 strcat(path, dp->d_name);
                 strcat(path, "/");
 
-                /* printf("scroll theme #%d: %s @ %s\n", theme_num, dp->d_name, path); */
+                LOG_DEBUG("scroll theme #%d: %s @ %s\n", theme_num, dp->d_name, path);
 
                 /* Add the theme */
                 strcpy(scroll_themes[num_scroll_themes].bg_left, path + 4);
@@ -381,7 +360,7 @@ load_themes(char* basePath) {
                 strcat(path, dp->d_name);
                 strcat(path, "/");
 
-                /* printf("folders theme #%d: %s @ %s\n", theme_num, dp->d_name, path); */
+                LOG_DEBUG("folders theme #%d: %s @ %s\n", theme_num, dp->d_name, path);
 
                 /* Add the theme */
                 strcpy(folder_themes[num_folder_themes].bg_left, path + 4);
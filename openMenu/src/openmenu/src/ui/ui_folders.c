@@ -18,8 +18,10 @@
 #include <arch/rtc.h>
 #endif
 
+#define LOG_MODULE UI
 #include <backend/gd_item.h>
 #include <backend/gd_list.h>
+#include <dbgprint.h>
 #include <openmenu_debug.h>
 #include <openmenu_settings.h>
 #include <openmenu_savefile.h>
@@ -46,6 +48,7 @@
 
 /* Static resources */
 static image txr_bg_left, txr_bg_right;
+static draw_list bg_list;
 static image txr_focus;
 extern image img_empty_boxart;
 extern image img_dir_boxart;
@@ -156,6 +159,11 @@ get_marquee_speed_frames(void) {
 
 static void
 draw_bg_layers(void) {
+    /* Only changes with the theme, recorded once and replayed after that */
+    if (!draw_list_replay(&bg_list)) {
+        return;
+    }
+    draw_list_begin(&bg_list);
     {
         const dimen_RECT left = {.x = 0, .y = 0, .w = 512, .h = 480};
         draw_draw_sub_image(0, 0, 512, 480, COLOR_WHITE, &txr_bg_left, &left);
@@ -164,6 +172,7 @@ draw_bg_layers(void) {
         const dimen_RECT right = {.x = 0, .y = 0, .w = 128, .h = 480};
         draw_draw_sub_image(512, 0, 128, 480, COLOR_WHITE, &txr_bg_right, &right);
     }
+    draw_list_end(&bg_list);
 }
 
 static void
@@ -393,9 +402,9 @@ draw_gameart(void) {
 
     /* Load artwork for games */
     {
-        txr_get_large(item->product, &txr_focus);
+        txr_get_large(gd_item_art_id(item), &txr_focus);
         if (txr_focus.texture == img_empty_boxart.texture) {
-            txr_get_small(item->product, &txr_focus);
+            txr_get_small(gd_item_art_id(item), &txr_focus);
         }
     }
 
@@ -662,10 +671,10 @@ menu_increment(int amount) {
 
 static void
 run_cb(void) {
-    /* printf("run_cb: Starting\n"); */
+    LOG_DEBUG("run_cb: Starting\n");
     const gd_item* item = list_current[current_selected_item];
     int disc_set = gd_item_disc_total(item->disc);
-    /* printf("run_cb: disc_set=%d\n", disc_set); */
+    LOG_DEBUG("run_cb: disc_set=%d\n", disc_set);
 
 #ifndef STANDALONE_BINARY
     int hide_multidisc = sf_multidisc[0];
@@ -673,7 +682,7 @@ run_cb(void) {
     int hide_multidisc = 1;
 #endif
 
-    /* printf("run_cb: hide_multidisc=%d\n", hide_multidisc); */
+    LOG_DEBUG("run_cb: hide_multidisc=%d\n", hide_multidisc);
 
     /* Only show multidisc chooser if product code exists */
     if (hide_multidisc && (disc_set > 1) && item->product[0] != '\0') {
@@ -691,18 +700,18 @@ run_cb(void) {
 
         /* Check if multiple discs remain after filtering */
         if (list_multidisc_length() > 1) {
-            /* printf("run_cb: Showing multidisc popup\n"); */
+            LOG_DEBUG("run_cb: Showing multidisc popup\n");
             draw_current = DRAW_MULTIDISC;
             cb_multidisc = 1;
-            /* printf("run_cb: Calling popup_setup\n"); */
+            LOG_DEBUG("run_cb: Calling popup_setup\n");
             popup_setup(&draw_current, &cur_theme->colors, &navigate_timeout, cur_theme->menu_title_color);
-            /* printf("run_cb: Multidisc setup complete\n"); */
+            LOG_DEBUG("run_cb: Multidisc setup complete\n");
             return;
         }
         /* Only 1 disc in this folder, fall through to launch directly */
     }
 
-    /* printf("run_cb: Launching CB\n"); */
+    LOG_DEBUG("run_cb: Launching CB\n");
     dreamcast_launch_cb(item);
 }
 
@@ -794,7 +803,7 @@ menu_accept(void) {
 
         /* Check if multiple discs remain after filtering */
         if (list_multidisc_length() > 1) {
-            /* printf("menu_accept: Showing multidisc popup for disc_set=%d\n", disc_set); */
+            LOG_DEBUG("menu_accept: Showing multidisc popup for disc_set=%d\n", disc_set);
             cb_multidisc = 0;
             draw_current = DRAW_MULTIDISC;
             popup_setup(&draw_current, &cur_theme->colors, &navigate_timeout, cur_theme->menu_title_color);
@@ -1017,6 +1026,7 @@ handle_input_ui(enum control input) {
 /* Main UI functions */
 
 FUNCTION(UI_NAME, init) {
+    draw_list_invalidate(&bg_list);
     texman_clear();
     txr_empty_small_pool();
     txr_empty_large_pool();
@@ -13,9 +13,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#define LOG_MODULE UI
 #include <backend/gd_item.h>
 #include <backend/gd_list.h>
+#include <dbgprint.h>
 
+#include "boot.h"
 #include "dc/input.h"
 #include "texture/txr_manager.h"
 #include "ui/animation.h"
@@ -106,6 +109,7 @@ static image txr_icon_list[/*ROWS * COLUMNS*/ 4 * 3 /* Assume the worst */]; /*
 static image txr_focus;
 static image txr_highlight; /* Highlight square */
 static image txr_bg_left, txr_bg_right;
+static draw_list bg_list;
 
 extern image img_empty_boxart;
 extern image img_dir_boxart;
@@ -152,6 +156,11 @@ recalculate_aspect(CFG_ASPECT aspect) {
 
 static void
 draw_bg_layers(void) {
+    /* Only changes with the theme, recorded once and replayed after that */
+    if (!draw_list_replay(&bg_list)) {
+        return;
+    }
+    draw_list_begin(&bg_list);
     {
         const dimen_RECT left = {.x = 0, .y = 0, .w = 512, .h = 480};
         draw_draw_sub_image(0, 0, 512, 480, COLOR_WHITE, &txr_bg_left, &left);
@@ -160,6 +169,7 @@ draw_bg_layers(void) {
         const dimen_RECT right = {.x = 0, .y = 0, .w = 128, .h = 480};
         draw_draw_sub_image(512, 0, 128, 480, COLOR_WHITE, &txr_bg_right, &right);
     }
+    draw_list_end(&bg_list);
 }
 
 static inline int
@@ -170,7 +180,7 @@ current_selected(void) {
 static void
 draw_large_art(void) {
     if (anim_active(&anim_large_art_scale.time)) {
-        txr_get_large(list_current[current_selected()]->product, &txr_focus);
+        txr_get_large(gd_item_art_id(list_current[current_selected()]), &txr_focus);
         if (txr_focus.texture == img_empty_boxart.texture
             || !strncmp(list_current[current_selected()]->disc, "DIR", 3)) {
             /* Only draw if large is present */
@@ -242,7 +252,7 @@ draw_grid_boxes(void) {
                 txr_icon_list[idx].height = img_dir_boxart.height;
                 txr_icon_list[idx].format = img_dir_boxart.format;
             } else {
-                txr_get_small(list_current[current_starting_index + idx]->product, &txr_icon_list[idx]);
+                txr_get_small(gd_item_art_id(list_current[current_starting_index + idx]), &txr_icon_list[idx]);
             }
             draw_draw_image((int)x_pos, (int)y_pos, TILE_SIZE_X * X_SCALE, TILE_SIZE_Y, COLOR_WHITE,
                             &txr_icon_list[idx]);
@@ -522,6 +532,10 @@ menu_accept(void) {
                 default: list_set_sort_default();
             }
         } else {
+            if (list_current[current_selected_item]->product[0] == 'G') {
+                /* Genres come from META.DAT, which may still be waiting on its boot stage */
+                boot_require(BOOT_META);
+            }
             list_set_sort_filter(list_current[current_selected_item]->product[0],
                                  list_current[current_selected_item]->slot_num);
         }
@@ -701,6 +715,7 @@ handle_keyboard_quickjump(void) {
 /* Base UI Methods */
 
 FUNCTION(UI_NAME, init) {
+    draw_list_invalidate(&bg_list);
     texman_clear();
     txr_empty_small_pool();
     txr_empty_large_pool();
@@ -757,8 +772,8 @@ FUNCTION(UI_NAME, init) {
 
     font_bmf_init("FONT/BASILEA.FNT", "FONT/BASILEA_W.PVR", sf_aspect[0]);
 
-    /* printf("Texture scratch free: %d/%d KB (%d/%d bytes)\n", texman_get_space_available() / 1024,
-           TEXMAN_BUFFER_SIZE / 1024, texman_get_space_available(), TEXMAN_BUFFER_SIZE); */
+    LOG_DEBUG("Texture scratch free: %d/%d KB (%d/%d bytes)\n", texman_get_space_available() / 1024,
+              TEXMAN_BUFFER_SIZE / 1024, texman_get_space_available(), TEXMAN_BUFFER_SIZE);
 }
 
 static void
@@ -14,9 +14,11 @@
 #include <stdlib.h>
 #include <string.h>
 
+#define LOG_MODULE UI
 #include <backend/db_list.h>
 #include <backend/gd_item.h>
 #include <backend/gd_list.h>
+#include <dbgprint.h>
 
 #include "dc/input.h"
 #include "texture/txr_manager.h"
@@ -40,10 +42,12 @@
 #define X_SCALE_4_3          ((float)1.0f)
 #define X_SCALE_16_9         ((float)0.74941452f)
 #define ICON_BASE_SIZE       ((int)68)
+#define SYNOP_WRAP_WIDTH     ((int)(640 - 316 - 10))
 
 /* List managment */
-#define INPUT_TIMEOUT        (10)
-#define FOCUSED_HIRES_FRAMES (60 * 1) /* 1 second load in */
+#define INPUT_TIMEOUT           (10)
+#define FOCUSED_HIRES_FRAMES    (60 * 1) /* 1 second load in */
+#define FOCUSED_PREFETCH_FRAMES (20)     /* settled long enough to read ahead */
 
 /* Tile parameters */
 /* Basic Info */
@@ -71,6 +75,7 @@ static image txr_icon_list[16]; /* Lower list of 9 icons */
 static image txr_focus;         /* current selected item, either lowres or hires */
 static image txr_highlight;     /* Highlight square*/
 static image txr_bg_left, txr_bg_right;
+static draw_list bg_list;
 static image txr_icons_white /*, txr_icons_black*/;
 static image* txr_icons_current;
 
@@ -117,6 +122,11 @@ recalculate_aspect(CFG_ASPECT aspect) {
 
 static void
 draw_bg_layers(void) {
+    /* Only changes with the theme, recorded once and replayed after that */
+    if (!draw_list_replay(&bg_list)) {
+        return;
+    }
+    draw_list_begin(&bg_list);
     {
         const dimen_RECT left = {.x = 0, .y = 0, .w = 512, .h = 480};
         draw_draw_sub_image(0, 0, 512, 480, COLOR_WHITE, &txr_bg_left, &left);
@@ -125,6 +135,7 @@ draw_bg_layers(void) {
         const dimen_RECT right = {.x = 0, .y = 0, .w = 128, .h = 480};
         draw_draw_sub_image(512, 0, 128, 480, COLOR_WHITE, &txr_bg_right, &right);
     }
+    draw_list_end(&bg_list);
 }
 
 static void
@@ -164,7 +175,7 @@ draw_small_boxes(void) {
             txr_icon_list[i].height = img_dir_boxart.height;
             txr_icon_list[i].format = img_dir_boxart.format;
         } else {
-            txr_get_small(list_current[starting_icon_idx + i]->product, &txr_icon_list[i]);
+            txr_get_small(gd_item_art_id(list_current[starting_icon_idx + i]), &txr_icon_list[i]);
         }
         draw_draw_image((x_start + (ICON_SIZE_X + ICON_SPACING) * i) * X_SCALE, y_pos, ICON_SIZE_X * X_SCALE,
                         ICON_SIZE_Y, COLOR_WHITE, &txr_icon_list[i]);
@@ -233,7 +244,7 @@ draw_game_meta(void) {
 
         synopsis = current_meta->description;
         font_bmf_set_height(FONT_SYNOP_SIZE);
-        font_bmf_draw_sub_wrap(316, 136 - 20 - 8, current_theme_colors->text_color, synopsis, 640 - 316 - 10);
+        font_bmf_draw_sub_wrap(316, 136 - 20 - 8, current_theme_colors->text_color, synopsis, SYNOP_WRAP_WIDTH);
 
         font_bmf_set_height(14.0f);
         font_bmf_draw_centered(326 + (20 / 2), 282 + 12, current_theme_colors->text_color,
@@ -295,7 +306,22 @@ draw_game_meta(void) {
 static void
 menu_changed_item(void) {
     frames_focused = 0;
-    db_get_meta(list_current[current_selected_item]->product, &current_meta);
+    db_get_meta(gd_item_meta_id(list_current[current_selected_item]), &current_meta);
+
+    /* Break the description into lines now instead of while drawing */
+    if (current_meta) {
+        font_bmf_set_height(FONT_SYNOP_SIZE);
+        font_bmf_layout_sub_wrap(current_meta->description, SYNOP_WRAP_WIDTH);
+    }
+}
+
+/* Description pages for the items either side, so the next step doesn't wait on the disc */
+static void
+menu_prefetch_meta(void) {
+    const int prev = (current_selected_item > 0) ? current_selected_item - 1 : list_len - 1;
+    const int next = (current_selected_item + 1 < list_len) ? current_selected_item + 1 : 0;
+    db_prefetch_meta(gd_item_meta_id(list_current[next]));
+    db_prefetch_meta(gd_item_meta_id(list_current[prev]));
 }
 
 static bool
@@ -531,14 +557,17 @@ update_data(void) {
         txr_focus.format = img_dir_boxart.format;
     } else {
         if (frames_focused > FOCUSED_HIRES_FRAMES) {
-            txr_get_large(list_current[current_selected_item]->product, &txr_focus);
+            txr_get_large(gd_item_art_id(list_current[current_selected_item]), &txr_focus);
             if (txr_focus.texture == img_empty_boxart.texture) {
-                txr_get_small(list_current[current_selected_item]->product, &txr_focus);
+                txr_get_small(gd_item_art_id(list_current[current_selected_item]), &txr_focus);
             }
         } else {
-            txr_get_small(list_current[current_selected_item]->product, &txr_focus);
+            txr_get_small(gd_item_art_id(list_current[current_selected_item]), &txr_focus);
         }
     }
+    if (frames_focused == FOCUSED_PREFETCH_FRAMES) {
+        menu_prefetch_meta();
+    }
 
     frames_focused++;
 }
@@ -613,6 +642,7 @@ handle_keyboard_quickjump(void) {
 /* Base UI Methods */
 
 FUNCTION(UI_NAME, init) {
+    draw_list_invalidate(&bg_list);
     texman_clear();
     txr_empty_small_pool();
     txr_empty_large_pool();
@@ -681,8 +711,8 @@ FUNCTION(UI_NAME, init) {
 
     font_bmf_init("FONT/BASILEA.FNT", "FONT/BASILEA_W.PVR", sf_aspect[0]);
 
-    /* printf("Texture scratch free: %d/%d KB (%d/%d bytes)\n", texman_get_space_available() / 1024,
-           TEXMAN_BUFFER_SIZE / 1024, texman_get_space_available(), TEXMAN_BUFFER_SIZE); */
+    LOG_DEBUG("Texture scratch free: %d/%d KB (%d/%d bytes)\n", texman_get_space_available() / 1024,
+              TEXMAN_BUFFER_SIZE / 1024, texman_get_space_available(), TEXMAN_BUFFER_SIZE);
 }
 
 static void
@@ -20,6 +20,7 @@
 #include <openmenu_savefile.h>
 #include <openmenu_settings.h>
 
+#include "boot.h"
 #include "ui/draw_kos.h"
 #include "ui/draw_prototypes.h"
 #include "ui/font_prototypes.h"
@@ -547,6 +548,7 @@ menu_accept(void) {
             }
         } else {
             /* If filtering, filter down to only genre then sort */
+            boot_require(BOOT_META);
             list_set_genre_sort((FLAGS_GENRE)choices[CHOICE_FILTER] - 1, choices[CHOICE_SORT]);
         }
 
@@ -2234,6 +2236,7 @@ static void saveload_close_all(int do_reload) {
                 case SORT_DEFAULT: list_set_sort_alphabetical(); break;
             }
         } else {
+            boot_require(BOOT_META);
             list_set_genre_sort((FLAGS_GENRE)sf_filter[0] - 1, sf_sort[0]);
         }
 
@@ -14,9 +14,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#define LOG_MODULE UI
 #include <backend/gd_item.h>
 #include <backend/gd_list.h>
+#include <dbgprint.h>
 #include <openmenu_settings.h>
+#include "boot.h"
 #include "dc/input.h"
 #include "texture/txr_manager.h"
 #include "ui/draw_prototypes.h"
@@ -38,6 +41,7 @@
 #define KBD_MOD_RSHIFT 0x20
 
 static image txr_bg_left, txr_bg_right;
+static draw_list bg_list;
 
 /* Info taken from megavolt85 and RazorX */
 /* GDMENU Default Colors */
@@ -200,6 +204,11 @@ static bool direction_current = false;
 
 static void
 draw_bg_layers(void) {
+    /* Only changes with the theme, recorded once and replayed after that */
+    if (!draw_list_replay(&bg_list)) {
+        return;
+    }
+    draw_list_begin(&bg_list);
     {
         const dimen_RECT left = {.x = 0, .y = 0, .w = 512, .h = 480};
         draw_draw_sub_image(0, 0, 512, 480, COLOR_WHITE, &txr_bg_left, &left);
@@ -208,6 +217,7 @@ draw_bg_layers(void) {
         const dimen_RECT right = {.x = 0, .y = 0, .w = 128, .h = 480};
         draw_draw_sub_image(512, 0, 128, 480, COLOR_WHITE, &txr_bg_right, &right);
     }
+    draw_list_end(&bg_list);
 }
 
 static void
@@ -451,9 +461,9 @@ draw_gameart(void) {
         txr_focus.height = img_dir_boxart.height;
         txr_focus.format = img_dir_boxart.format;
     } else {
-        txr_get_large(list_current[current_selected_item]->product, &txr_focus);
+        txr_get_large(gd_item_art_id(list_current[current_selected_item]), &txr_focus);
         if (txr_focus.texture == img_empty_boxart.texture) {
-            txr_get_small(list_current[current_selected_item]->product, &txr_focus);
+            txr_get_small(gd_item_art_id(list_current[current_selected_item]), &txr_focus);
         }
     }
 
@@ -557,6 +567,10 @@ menu_accept(void) {
                 default: list_set_sort_default();
             }
         } else {
+            if (list_current[current_selected_item]->product[0] == 'G') {
+                /* Genres come from META.DAT, which may still be waiting on its boot stage */
+                boot_require(BOOT_META);
+            }
             list_set_sort_filter(list_current[current_selected_item]->product[0],
                                  list_current[current_selected_item]->slot_num);
         }
@@ -690,6 +704,7 @@ handle_keyboard_quickjump(void) {
 }
 
 FUNCTION(UI_NAME, init) {
+    draw_list_invalidate(&bg_list);
     texman_clear();
     /* @Note: these exist but do we really care? Naturally this will happen
    * without forcing it and old data doesn't matter */
@@ -721,8 +736,8 @@ FUNCTION(UI_NAME, init) {
 
     font_bmp_init(cur_theme->font, 8, 16);
 
-    /* printf("Texture scratch free: %d/%d KB (%d/%d bytes)\n", texman_get_space_available() / 1024,
-           TEXMAN_BUFFER_SIZE / 1024, texman_get_space_available(), TEXMAN_BUFFER_SIZE); */
+    LOG_DEBUG("Texture scratch free: %d/%d KB (%d/%d bytes)\n", texman_get_space_available() / 1024,
+              TEXMAN_BUFFER_SIZE / 1024, texman_get_space_available(), TEXMAN_BUFFER_SIZE);
 }
 
 static void
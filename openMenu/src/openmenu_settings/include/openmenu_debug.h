@@ -20,18 +20,19 @@
  * Color sequence in main.c:
  *   RED (255,0,0)     - Before maple_wait_scan()
  *   GREEN (0,255,0)   - After maple_wait_scan()
- *   BLUE (0,0,255)    - Before vm2_rescan()
- *   YELLOW (255,255,0) - After vm2_rescan()
  *   CYAN (0,255,255)  - Before init_gfx_pvr()
- *   MAGENTA (255,0,255) - Before savefile_init()
+ *   MAGENTA (255,0,255) - Before init(), the boot stages
+ *   BLUE (0,0,255)    - Before vm2_rescan(), boot_vm2
+ *   YELLOW (255,255,0) - After vm2_rescan(), boot_vm2
  *   WHITE (255,255,255) - Init complete
  *
- * Color sequence in openmenu_savefile.c (after MAGENTA):
+ * Color sequence in openmenu_savefile.c (after YELLOW):
  *   Dark Blue (0,0,128) - Before setup_savefile_internal()
  *   Dark Yellow (128,128,0) - After setup_savefile_internal()
  *   Dark Cyan (0,128,128) - Before sd_savefile_init()
  *   Dark Magenta (128,0,128) - After sd_savefile_init()
- *   [If SD loads: return after next 2 flashes]
+ *   [If SD loads: return, the next 2 flashes come from savefile_init_late()
+ *    after the first frame]
  *   Dark Red (128,0,0) - Before has_any_vmu()
  *   Dark Green (0,128,0) - VMU found / Orange (255,128,0) - No VMU
  *   [If SD failed, continue to VMU path:]
@@ -70,4 +71,12 @@
  */
 #define DEBUG_VMU_SYNC 0
 
+/*
+ * The frame profiler is not toggled here, it is a build option so the
+ * shared library and host tools pick it up as well:
+ *   cmake -DOPENMENU_PROFILER=ON
+ * Keyboard F1 shows per frame timings and counters on screen, F2 dumps the
+ * last frames and the boot stage timings to serial as CSV. See profiler.h
+ */
+
 #endif /* OPENMENU_DEBUG_H */
@@ -14,6 +14,8 @@ int8_t update_savefile(void** loaded_variables, crayon_savefile_version_t loaded
 
 int8_t find_first_valid_savefile_device(crayon_savefile_details_t* details);
 void savefile_init();
+/* VMU icon and clock sync, split off savefile_init so it can run after the menu is up */
+void savefile_init_late(void);
 void savefile_close();
 int8_t savefile_save();
 
@@ -10,17 +10,6 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-#ifdef _arch_dreamcast
-
-/* SD card configuration file path */
-#define SD_MOUNT_PATH       "/sd"
-#define SD_OPENMENU_DIR     "/sd/OPENMENU"
-#define SD_CONFIG_FILE      "/sd/OPENMENU/OPENMENU.CFG"
-
-/* File format magic and version */
-#define SD_CONFIG_MAGIC     "OMCF"
-#define SD_CONFIG_MAGIC_LEN 4
-
 /* SD device status codes (mirrors VMU SAVE_STATUS for consistency) */
 typedef enum SD_STATUS {
     SD_STATUS_NOT_PRESENT = 0,  /* SD card not detected or init failed */
@@ -32,6 +21,17 @@ typedef enum SD_STATUS {
     SD_STATUS_NO_SPACE          /* SD card is full */
 } SD_STATUS;
 
+#ifdef _arch_dreamcast
+
+/* SD card configuration file path */
+#define SD_MOUNT_PATH       "/sd"
+#define SD_OPENMENU_DIR     "/sd/OPENMENU"
+#define SD_CONFIG_FILE      "/sd/OPENMENU/OPENMENU.CFG"
+
+/* File format magic and version */
+#define SD_CONFIG_MAGIC     "OMCF"
+#define SD_CONFIG_MAGIC_LEN 4
+
 /* SD card save file header structure */
 typedef struct sd_config_header {
     char magic[4];              /* "OMCF" */
@@ -88,13 +88,6 @@ int8_t sd_savefile_save(void);
  */
 void sd_savefile_refresh_status(void);
 
-#else
-
-/* Non-Dreamcast stubs */
-typedef enum SD_STATUS {
-    SD_STATUS_NOT_PRESENT = 0
-} SD_STATUS;
-
 #endif /* _arch_dreamcast */
 
 #endif /* SD_SAVEFILE_H */
@@ -288,24 +288,9 @@ savefile_init() {
                 loaded_from_sd = true;
                 startup_device_id = -1;  /* Not a VMU */
 
-                /* SD load successful - still check for VMU for LCD icon and time sync */
-                /* DEBUG: Dark Red (128,0,0) = before has_any_vmu (SD path) */
-                DFLASH_SF(128, 0, 0);
-
-                if (has_any_vmu()) {
-                    /* DEBUG: Dark Green (0,128,0) = after has_any_vmu, VMU found (SD path) */
-                    DFLASH_SF(0, 128, 0);
-#if OPENMENU_ICONS
-                    vmu_screens_bitmap = crayon_peripheral_dreamcast_get_screens();
-                    crayon_peripheral_vmu_display_icon(vmu_screens_bitmap, OPENMENU_LCD);
-#endif
-                    if (sf_vmu_time_sync[0] == VMU_TIME_SYNC_ON) {
-                        sync_rtc_from_vmu();
-                    }
-                } else {
-                    /* DEBUG: Orange (255,128,0) = after has_any_vmu, no VMU (SD path) */
-                    DFLASH_SF(255, 128, 0);
-                }
+                /* SD load successful - the VMU LCD icon and time sync are left
+                 * to savefile_init_late so the maple settle delay doesn't hold
+                 * up the menu */
                 return;  /* Done - loaded from SD */
             }
         }
@@ -408,6 +393,36 @@ savefile_init() {
     settings_sanitize();
 }
 
+/* Finishes what savefile_init skipped after loading from SD: the VMU LCD icon
+ * and the RTC sync. Runs on the boot thread, nothing else touches maple VMUs
+ * that early */
+void
+savefile_init_late(void) {
+#ifdef _arch_dreamcast
+    if (!loaded_from_sd) {
+        return;
+    }
+
+    /* DEBUG: Dark Red (128,0,0) = before has_any_vmu (SD path) */
+    DFLASH_SF(128, 0, 0);
+
+    if (has_any_vmu()) {
+        /* DEBUG: Dark Green (0,128,0) = after has_any_vmu, VMU found (SD path) */
+        DFLASH_SF(0, 128, 0);
+#if OPENMENU_ICONS
+        vmu_screens_bitmap = crayon_peripheral_dreamcast_get_screens();
+        crayon_peripheral_vmu_display_icon(vmu_screens_bitmap, OPENMENU_LCD);
+#endif
+        if (sf_vmu_time_sync[0] == VMU_TIME_SYNC_ON) {
+            sync_rtc_from_vmu();
+        }
+    } else {
+        /* DEBUG: Orange (255,128,0) = after has_any_vmu, no VMU (SD path) */
+        DFLASH_SF(255, 128, 0);
+    }
+#endif
+}
+
 void
 savefile_close() {
     crayon_savefile_free_details(&savefile_details);
@@ -0,0 +1,60 @@
+/*
+ * File: arena.h
+ * Project: openmenu_shared
+ * File Created: Monday, 19th October 2026 7:14:52 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Region allocator for data that lives from boot until it is thrown away as
+ * a whole: the list, the folder tree, DAT indexes, metadata and fonts. Each
+ * arena is a chain of blocks handed out front to back, there is no per
+ * allocation free, arena_reset drops everything in one go. Not thread safe,
+ * each arena belongs to the boot stage that fills it */
+
+#define ARENA_ALIGN (8)
+
+typedef enum ARENA_ID {
+#define ARENA(id, name, block_size) ARENA_##id,
+#include "arena.def"
+    ARENA_NUM,
+} ARENA_ID;
+
+typedef struct arena_stats {
+    size_t used;       /* bytes handed out */
+    size_t reserved;   /* bytes held in blocks */
+    size_t high_water; /* most ever used at once */
+    uint32_t blocks;
+    uint32_t allocs; /* since start */
+} arena_stats;
+
+/* Position to come back to with arena_rewind */
+typedef struct arena_mark {
+    void* block;
+    size_t used;
+} arena_mark;
+
+/* NULL when out of memory */
+void* arena_alloc(ARENA_ID id, size_t size);
+void* arena_calloc(ARENA_ID id, size_t count, size_t size);
+/* Grows in place if ptr was the last allocation made, copies otherwise */
+void* arena_realloc(ARENA_ID id, void* ptr, size_t old_size, size_t size);
+
+arena_mark arena_get_mark(ARENA_ID id);
+/* Drops everything allocated since mark */
+void arena_rewind(ARENA_ID id, arena_mark mark);
+/* Frees every block, the high water mark is kept */
+void arena_reset(ARENA_ID id);
+void arena_reset_all(void);
+
+const char* arena_name(ARENA_ID id);
+const arena_stats* arena_get_stats(ARENA_ID id);
+/* One line per arena at LOG_LEVEL_INFO */
+void arena_log_report(void);
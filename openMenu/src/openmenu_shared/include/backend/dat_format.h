@@ -17,6 +17,9 @@
 #include <kos/fs.h>
 #endif
 
+#define DAT_VERSION      (1) /* art and everything else */
+#define DAT_VERSION_META (2) /* META.DAT with compressed descriptions */
+
 typedef struct bin_item {
     char ID[12];
     uint32_t offset;
@@ -39,6 +42,7 @@ typedef struct bin_header {
 } bin_header;
 
 typedef struct dat_file {
+    uint32_t version;    /* 1, or 2 for META.DAT with compressed descriptions */
     uint32_t chunk_size; /* Size of each chunk in the file */
     uint32_t num_chunks; /* How many chunks are present in this bin */
 #ifdef STANDALONE_BINARY
@@ -51,7 +55,8 @@ typedef struct dat_file {
 } dat_file;
 
 int DAT_init(dat_file* bin);
-int DAT_load_parse(dat_file* bin, const char* path);
+/* Versions above max_version are refused, only META.DAT readers know v2 */
+int DAT_load_parse(dat_file* bin, const char* path, uint32_t max_version);
 void DAT_info(const dat_file* bin);
 
 uint32_t DAT_get_offset_by_ID(const dat_file* bin, const char* ID);
@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
 typedef enum FLAGS_GENRE {
     GENRE_NONE = (0 << 0),       // 0
     GENRE_ACTION = (1 << 0),     // 1
@@ -60,3 +63,25 @@ typedef struct db_item {
     char padding2;             /*Currently Unused, for expansion */
     char description[376];
 } db_item;
+
+/* Leading bytes of a db_item, all the filters need. Kept resident for every
+ * META.DAT record while descriptions are paged in on demand */
+typedef struct db_item_hot {
+    unsigned char num_players;
+    unsigned char vmu_blocks;
+    unsigned char accessories;
+    unsigned char network;
+    unsigned short genre;
+    char padding1;
+    char padding2;
+} db_item_hot;
+
+_Static_assert(sizeof(db_item_hot) == 8 && offsetof(db_item, description) == sizeof(db_item_hot),
+               "db_item_hot has to match the start of db_item");
+
+/* META.DAT v2 record, the description lives compressed in the text block
+ * after the records (db_text.h) */
+typedef struct db_item_v2 {
+    db_item_hot hot;
+    uint32_t description; /* offset into the text block data */
+} db_item_v2;
@@ -14,6 +14,8 @@
 
 int db_load_DAT(void);
 int db_get_meta(const char* id, struct db_item** item);
+int db_get_meta_hot(const char* id, const struct db_item_hot** hot);
+void db_prefetch_meta(const char* id);
 
 const char* db_format_nplayers_str(int nplayers);
 const char* db_format_vmu_blocks_str(int num_blocks);
\ No newline at end of file
@@ -0,0 +1,57 @@
+/*
+ * File: db_text.h
+ * Project: backend
+ * File Created: Monday, 19th October 2026 12:26:51 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* META.DAT v2 keeps descriptions out of the records, compressed against one
+ * static dictionary trained by metapacker over the whole catalogue. The text
+ * block sits right after the last record chunk:
+ *
+ *   db_text_header
+ *   uint16_t dict_offsets[num_entries + 1], entry i is strings[offsets[i]..offsets[i + 1])
+ *   char     strings[dict_size]
+ *   uint8_t  data[data_size], descriptions back to back in record order
+ *
+ * Description bytes:
+ *   0x00               end of the description
+ *   0x80-0xFF          dictionary entry 0-127
+ *   0x01-0x07, next    dictionary entry 128 + (first - 1) * 256 + next
+ *   0x08, next         next as a literal byte
+ *   anything else      a literal byte */
+
+#define DB_TEXT_MAGIC        "DSC1"
+#define DB_TEXT_END          (0x00)
+#define DB_TEXT_SHORT_CODES  (128)
+#define DB_TEXT_LONG_FIRST   (0x01)
+#define DB_TEXT_LONG_LAST    (0x07)
+#define DB_TEXT_ESCAPE       (0x08)
+#define DB_TEXT_MAX_ENTRIES  (DB_TEXT_SHORT_CODES + (DB_TEXT_LONG_LAST - DB_TEXT_LONG_FIRST + 1) * 256)
+#define DB_TEXT_MAX_ENTRY    (64) /* longest dictionary string */
+
+typedef struct db_text_header {
+    char magic[4];
+    uint32_t num_entries;
+    uint32_t dict_size;
+    uint32_t data_size;
+} db_text_header;
+
+typedef struct db_text_dict {
+    const uint16_t* offsets;
+    const char* strings;
+    uint32_t num_entries;
+} db_text_dict;
+
+/* Expands the description at src into dst, always NUL terminated and cut short
+ * at dst_size - 1. Returns where the next description starts, never past end */
+const uint8_t* db_text_decode(const db_text_dict* dict, const uint8_t* src, const uint8_t* end, char* dst,
+                              size_t dst_size);
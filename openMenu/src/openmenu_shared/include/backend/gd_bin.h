@@ -0,0 +1,110 @@
+/*
+ * File: gd_bin.h
+ * Project: backend
+ * File Created: Sunday, 18th October 2026 9:20:44 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* OPENMENU.BIN, a precompiled OPENMENU.INI written by menucompile.
+ * Little endian, every section starts 4 byte aligned and is addressed by
+ * a byte offset from the start of the file:
+ *
+ *   gd_bin_header
+ *   items        gd_bin_item[num_items], slot 1 (openMenu itself) first
+ *   nodes        gd_bin_node[num_nodes], folder tree in preorder, root first
+ *   folder_games uint32_t[num_folder_games], item indices grouped per node
+ *   perm_name    uint32_t[num_items - 1], item indices sorted by name
+ *   perm_region  uint32_t[num_items - 1], item indices sorted by region
+ *   facets       uint32_t[GD_FACET_COUNT][facet_words], one bit per item
+ *   pool         NUL terminated strings, each stored once
+ *
+ * The image is only used while ini_hash/ini_size still match OPENMENU.INI. */
+
+#define GD_BIN_MAGIC   "OMBN"
+#define GD_BIN_VERSION (1)
+
+typedef enum GD_BIN_FIELD {
+#define CFG(s, n, default) GD_BIN_FIELD_##n,
+#include "gd_item.def"
+    GD_BIN_NUM_FIELDS,
+} GD_BIN_FIELD;
+
+/* Facets precomputed for the filtered views */
+typedef enum GD_FACET {
+    GD_FACET_REGION_J = 0,
+    GD_FACET_REGION_U,
+    GD_FACET_REGION_E,
+    GD_FACET_REGION_JUE,
+    GD_FACET_LETTER, /* 27 of them, '#' then A-Z like list_set_sort_filter */
+    GD_FACET_MULTIDISC = GD_FACET_LETTER + 27, /* disc 2+ of a set, hidden with multidisc grouping */
+    GD_FACET_COUNT,
+} GD_FACET;
+
+typedef struct gd_bin_header {
+    char magic[4];
+    uint32_t version;
+    uint32_t ini_hash; /* gd_bin_hash of the whole OPENMENU.INI */
+    uint32_t ini_size;
+    uint32_t num_items;
+    uint32_t num_fields; /* GD_BIN_NUM_FIELDS when written */
+    uint32_t num_nodes;
+    uint32_t num_folder_games;
+    uint32_t num_facets;
+    uint32_t facet_words;
+    uint32_t pool_size;
+    uint32_t items_offset;
+    uint32_t nodes_offset;
+    uint32_t folder_games_offset;
+    uint32_t perm_name_offset;
+    uint32_t perm_region_offset;
+    uint32_t facets_offset;
+    uint32_t pool_offset;
+} gd_bin_header;
+
+typedef struct gd_bin_item {
+    uint32_t slot_num;
+    uint32_t str[GD_BIN_NUM_FIELDS]; /* pool offsets in gd_item.def order */
+} gd_bin_item;
+
+typedef struct gd_bin_node {
+    uint32_t name;   /* pool offset */
+    uint32_t parent; /* node index, root points at itself */
+    uint32_t first_seen_slot;
+    uint32_t games_start; /* into folder_games */
+    uint32_t num_games;
+} gd_bin_node;
+
+static inline int
+gd_facet_test(const uint32_t* facets, uint32_t facet_words, int facet, uint32_t idx) {
+    return (facets[facet * facet_words + (idx >> 5)] >> (idx & 31)) & 1;
+}
+
+/* Cheap enough to run over the whole INI at boot, 32 bits per step */
+static inline uint32_t
+gd_bin_hash(const void* data, size_t len) {
+    const unsigned char* p = (const unsigned char*)data;
+    uint32_t h = 0x811C9DC5u ^ (uint32_t)len;
+    while (len >= 4) {
+        uint32_t w;
+        memcpy(&w, p, 4);
+        h = (h ^ w) * 0x01000193u;
+        h ^= h >> 15;
+        p += 4;
+        len -= 4;
+    }
+    while (len--) {
+        h = (h ^ *p++) * 0x01000193u;
+    }
+    h ^= h >> 13;
+    h *= 0x5BD1E995u;
+    return h ^ (h >> 15);
+}
@@ -21,8 +21,20 @@ typedef struct gd_item {
     char vga[1];
     char folder[512];
     char type[8];
+    /* Set by serial_sanitize_item at load, NULL when the product is used as is */
+    const char* art_id;
+    const char* meta_id;
 } gd_item;
 
+/* Serial to look up in BOX/ICON.DAT and META.DAT */
+static inline const char* gd_item_art_id(const gd_item* item) {
+    return item->art_id ? item->art_id : item->product;
+}
+
+static inline const char* gd_item_meta_id(const gd_item* item) {
+    return item->meta_id ? item->meta_id : item->product;
+}
+
 /* Helper functions to parse disc field "N/M" format (supports 1-10) */
 static inline int gd_item_disc_num(const char* disc) {
     /* Parse current disc number before '/' */
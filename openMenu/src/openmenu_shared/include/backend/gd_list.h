@@ -13,6 +13,11 @@
 struct gd_item;
 int list_read(const char* filename);
 int list_read_default(void);
+/* OPENMENU.BIN, used in place of the INI while its hash still matches */
+int list_read_bin(const char* bin_filename, const char* ini_filename);
+#ifdef STANDALONE_BINARY
+int list_write_bin(const char* bin_filename, const char* ini_filename);
+#endif
 void list_destroy(void);
 void list_print_slots(void);
 void list_print_temp(void);
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <stdio.h>
+
 #if DEBUG
 #define DBG_PRINT(...) printf(__VA_ARGS__)
 #define DBG_CHAR_INFO  (0)
@@ -17,3 +19,84 @@
 #else
 #define DBG_PRINT(...)
 #endif
+
+/* Leveled logging. A file picks its module before including this:
+ *   #define LOG_MODULE LIST
+ *   #include <dbgprint.h>
+ * and every message above LOG_LEVEL_<module> is compiled out. Thresholds
+ * default to LOG_LEVEL_DEFAULT and can be raised per module from the build,
+ * -DLOG_LEVEL_LIST=LOG_LEVEL_DEBUG.
+ *
+ * With LOG_BUFFERED, the default on Dreamcast, messages are formatted into
+ * a ring and only go out over serial when log_flush is called once a frame,
+ * errors flush straight away. Host builds print as they go */
+
+#define LOG_LEVEL_NONE  (0)
+#define LOG_LEVEL_ERROR (1)
+#define LOG_LEVEL_WARN  (2)
+#define LOG_LEVEL_INFO  (3)
+#define LOG_LEVEL_DEBUG (4)
+
+#ifndef LOG_LEVEL_DEFAULT
+#if DEBUG
+#define LOG_LEVEL_DEFAULT LOG_LEVEL_DEBUG
+#else
+#define LOG_LEVEL_DEFAULT LOG_LEVEL_INFO
+#endif
+#endif
+
+/* Modules */
+#ifndef LOG_LEVEL_LIST
+#define LOG_LEVEL_LIST LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_LEVEL_DAT
+#define LOG_LEVEL_DAT LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_LEVEL_BOOT
+#define LOG_LEVEL_BOOT LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_LEVEL_THEME
+#define LOG_LEVEL_THEME LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_LEVEL_UI
+#define LOG_LEVEL_UI LOG_LEVEL_DEFAULT
+#endif
+
+#ifndef LOG_MODULE
+#define LOG_MODULE DEFAULT
+#endif
+
+#ifndef LOG_BUFFERED
+#ifdef _arch_dreamcast
+#define LOG_BUFFERED (1)
+#else
+#define LOG_BUFFERED (0)
+#endif
+#endif
+
+#define LOG_RING_ENTRIES (64)  /* power of 2 */
+#define LOG_ENTRY_SIZE   (128) /* longer messages are cut */
+
+#define LOG_CAT_(a, b)   a##b
+#define LOG_CAT(a, b)    LOG_CAT_(a, b)
+#define LOG_ON(level)    ((level) <= LOG_CAT(LOG_LEVEL_, LOG_MODULE))
+
+/* Disabled levels are a constant false branch, the arguments are still type
+ * checked but nothing is emitted */
+#define LOG_AT(level, ...)                                                                                             \
+    do {                                                                                                               \
+        if (LOG_ON(level)) {                                                                                           \
+            log_write(level, __VA_ARGS__);                                                                             \
+        }                                                                                                              \
+    } while (0)
+
+#define LOG_ERROR(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_WARN(...)  LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_INFO(...)  LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+void log_write(int level, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+/* Writes out everything waiting in the ring, safe to call from any thread */
+void log_flush(void);
+/* Messages lost to the ring wrapping before a flush */
+unsigned int log_dropped(void);
@@ -0,0 +1,87 @@
+/*
+ * File: om_reader.h
+ * Project: openmenu_shared
+ * File Created: Monday, 19th October 2026 6:02:11 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Every read against /cd can end up a round trip to the GD emulator, so
+ * loaders go through here instead of calling fs_read per record. om_file_*
+ * are the plain KOS fs or stdio calls, om_reader adds a read-ahead buffer
+ * on top for parsing small records out of a file front to back */
+
+#ifndef STANDALONE_BINARY
+#include <kos/fs.h>
+typedef file_t om_file;
+#define OM_FILE_INVALID (-1)
+#else
+#include <stdio.h>
+typedef FILE* om_file;
+#define OM_FILE_INVALID (NULL)
+#endif
+
+#define OM_READER_BUF_SIZE (16 * 1024)
+#define OM_READER_ALIGN    (32)   /* buffer start, for DMA */
+#define OM_READER_SECTOR   (2048) /* refills end on a sector boundary of the file */
+
+typedef struct om_reader {
+    om_file handle;
+    int owns_handle;
+    uint8_t* buf_alloc;
+    uint8_t* buf;        /* OM_READER_BUF_SIZE, aligned to OM_READER_ALIGN */
+    size_t buf_pos;      /* next unread byte */
+    size_t buf_len;      /* valid bytes */
+    uint32_t buf_offset; /* file offset of buf[0] */
+} om_reader;
+
+/* Backend calls made, for comparing loaders */
+typedef struct om_reader_stats {
+    uint32_t opens;
+    uint32_t reads;
+    uint32_t seeks;
+    uint64_t bytes;
+} om_reader_stats;
+
+om_file om_file_open(const char* path);
+#ifdef STANDALONE_BINARY
+/* Running menu code on the host: /cd/ paths are looked up under root, with
+ * each part matched regardless of case the way the disc does. NULL turns it
+ * off. host_path returns path itself when there is nothing to map */
+void om_file_set_cd_root(const char* root);
+const char* om_file_host_path(const char* path, char* buf, size_t size);
+#endif
+void om_file_close(om_file file);
+size_t om_file_size(om_file file);
+/* Returns bytes read */
+size_t om_file_read_at(om_file file, uint32_t offset, void* dst, size_t size);
+
+/* Whole file in one read, with a 0 after the last byte so text can be parsed
+ * in place. alloc is used for the buffer, malloc if NULL. NULL on failure */
+typedef void* (*om_alloc_fn)(size_t size);
+void* om_read_file(const char* path, size_t* size, om_alloc_fn alloc);
+
+/* Returns 0 on success */
+int om_reader_open(om_reader* reader, const char* path);
+/* Reads from offset of an already open file, which is left open on close */
+int om_reader_attach(om_reader* reader, om_file handle, uint32_t offset);
+void om_reader_close(om_reader* reader);
+
+/* Returns bytes read, short only at the end of the file. Reads larger than
+ * the buffer go straight to dst */
+size_t om_reader_read(om_reader* reader, void* dst, size_t size);
+/* Next size bytes without consuming them, NULL if the file ends first or
+ * size is over OM_READER_BUF_SIZE. Valid until the next call on reader */
+const void* om_reader_peek(om_reader* reader, size_t size);
+/* Skipping past the end shows up as short reads after */
+void om_reader_skip(om_reader* reader, size_t size);
+uint32_t om_reader_tell(const om_reader* reader);
+
+const om_reader_stats* om_reader_get_stats(void);
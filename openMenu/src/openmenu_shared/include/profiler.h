@@ -0,0 +1,87 @@
+/*
+ * File: profiler.h
+ * Project: openmenu_shared
+ * File Created: Monday, 19th October 2026 3:02:48 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+/* Frame profiler, built in with -DOPENMENU_PROFILER=ON (defines PROFILER).
+ * Timers add up the time spent between PROF_BEGIN/PROF_END over a frame,
+ * counters count events over a frame, and prof_frame_end files both into a
+ * ring of the last PROF_FRAMES frames. One off spans such as boot stages and
+ * frames over PROF_HITCH_US are kept as marks. Without PROFILER every macro
+ * is empty */
+
+#ifndef PROFILER
+#define PROFILER (0)
+#endif
+
+#define PROF_FRAMES   (64)
+#define PROF_MARKS    (32)
+#define PROF_HITCH_US (34 * 1000) /* two 60Hz frames */
+
+typedef enum PROF_TIMER_ID {
+#define PROF_TIMER(id, name) PROF_##id,
+#define PROF_COUNTER(id, name)
+#include "profiler.def"
+    PROF_NUM_TIMERS,
+} PROF_TIMER_ID;
+
+typedef enum PROF_COUNTER_ID {
+#define PROF_TIMER(id, name)
+#define PROF_COUNTER(id, name) PROF_##id,
+#include "profiler.def"
+    PROF_NUM_COUNTERS,
+} PROF_COUNTER_ID;
+
+typedef struct prof_frame {
+    uint32_t frame;
+    uint32_t timer_us[PROF_NUM_TIMERS];
+    uint16_t counter[PROF_NUM_COUNTERS];
+} prof_frame;
+
+typedef struct prof_mark {
+    const char* name;
+    uint32_t start_us;
+    uint32_t end_us;
+} prof_mark;
+
+/* Microseconds since the first call, available with or without PROFILER */
+uint32_t prof_now_us(void);
+
+#if PROFILER
+void prof_begin(PROF_TIMER_ID id);
+void prof_end(PROF_TIMER_ID id);
+void prof_count(PROF_COUNTER_ID id, uint32_t n);
+void prof_mark_add(const char* name, uint32_t start_us, uint32_t end_us);
+void prof_frame_end(void);
+
+const char* prof_timer_name(PROF_TIMER_ID id);
+const char* prof_counter_name(PROF_COUNTER_ID id);
+/* Completed frames, 0 is the most recent. NULL past what the ring holds */
+const prof_frame* prof_get_frame(int ago);
+/* Writes marks and the frame ring as CSV */
+void prof_dump(FILE* out);
+
+#define PROF_BEGIN(id)                      prof_begin(PROF_##id)
+#define PROF_END(id)                        prof_end(PROF_##id)
+#define PROF_COUNT(id)                      prof_count(PROF_##id, 1)
+#define PROF_COUNT_N(id, n)                 prof_count(PROF_##id, n)
+#define PROF_MARK(name, start_us, end_us)   prof_mark_add(name, start_us, end_us)
+#define PROF_FRAME_END()                    prof_frame_end()
+#else
+#define PROF_BEGIN(id)                      ((void)0)
+#define PROF_END(id)                        ((void)0)
+#define PROF_COUNT(id)                      ((void)0)
+#define PROF_COUNT_N(id, n)                 ((void)(n))
+#define PROF_MARK(name, start_us, end_us)   ((void)(name), (void)(start_us), (void)(end_us))
+#define PROF_FRAME_END()                    ((void)0)
+#endif
@@ -0,0 +1,120 @@
+/*
+ * File: omf_format.h
+ * Project: texture
+ * File Created: Monday, 19th October 2026 11:02:37 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Fonts as font_bmf draws them. An AngelCode binary .fnt is parsed into
+ * this with omf_font_from_fnt, fontcompile writes the result and the PVR
+ * texture out as one OMF file that loads with a single read:
+ *
+ *   omf_header
+ *   glyphs   omf_glyph[256], indexed by character
+ *   kerns    omf_kern[num_kerns], sorted by first then second glyph
+ *   texture  the PVR file, GBIX+PVRT header then twiddled texels, 32 byte
+ *            aligned so the texels can be copied to VRAM from where they are
+ *
+ * Little endian, sections are addressed by byte offset from the start */
+
+#define OMF_MAGIC   "OMFN"
+#define OMF_VERSION (1)
+#define OMF_GLYPHS  (256)
+
+typedef struct omf_header {
+    char magic[4];
+    uint32_t version;
+    uint32_t font_size;
+    uint32_t line_height;
+    uint32_t tex_width; /* texture the UVs were worked out against */
+    uint32_t tex_height;
+    uint32_t num_kerns;
+    uint32_t glyphs_offset;
+    uint32_t kerns_offset;
+    uint32_t texture_offset;
+    uint32_t texture_size;
+} omf_header;
+
+typedef struct omf_glyph {
+    float u1, v1, u2, v2;
+    /* PVR_PACK_16BIT_UV of the upper left, upper right and lower right
+     * corners, what a sprite vertex takes */
+    uint32_t uv_a, uv_b, uv_c;
+    int16_t xoffset;
+    int16_t yoffset;
+    int16_t xadvance;
+    uint16_t width;
+    uint16_t height;
+    uint16_t kern_start; /* this glyph's pairs are kerns[kern_start..+kern_count] */
+    uint16_t kern_count;
+    uint16_t pad;
+} omf_glyph;
+
+/* The first glyph is implied by the span it is in */
+typedef struct omf_kern {
+    uint8_t second;
+    uint8_t pad;
+    int16_t amount;
+} omf_kern;
+
+_Static_assert(sizeof(omf_glyph) == 44 && sizeof(omf_kern) == 4, "OMF layout changed");
+
+typedef struct omf_font {
+    uint32_t font_size;
+    uint32_t line_height;
+    uint32_t tex_width;
+    uint32_t tex_height;
+    uint32_t num_kerns;
+    omf_glyph glyphs[OMF_GLYPHS];
+    omf_kern* kerns; /* ARENA_FONT */
+} omf_font;
+
+/* Same bits as KOS PVR_PACK_16BIT_UV, the top half of each float */
+static inline uint32_t
+omf_pack_uv(float u, float v) {
+    uint32_t ui, vi;
+    memcpy(&ui, &u, 4);
+    memcpy(&vi, &v, 4);
+    return (ui & 0xFFFF0000u) | (vi >> 16);
+}
+
+/* Binary search of first's span, a glyph has at most a few dozen pairs */
+static inline int
+omf_font_kerning(const omf_font* font, unsigned char first, unsigned char second) {
+    const omf_glyph* glyph = &font->glyphs[first];
+    const omf_kern* kerns = font->kerns + glyph->kern_start;
+    int lo = 0;
+    int hi = glyph->kern_count;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (kerns[mid].second < second) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < glyph->kern_count && kerns[lo].second == second) {
+        return kerns[lo].amount;
+    }
+    return 0;
+}
+
+/* Both return 0 on success. Kerning goes in ARENA_FONT */
+int omf_font_from_fnt(const char* path, omf_font* font);
+/* blob is a whole OMF file. The PVR inside it is handed back to upload, it
+ * stays in blob. With font NULL only the texture is looked up */
+int omf_font_from_blob(const void* blob, size_t size, omf_font* font, const void** pvr, size_t* pvr_size);
+
+#ifdef STANDALONE_BINARY
+/* pvr is the whole PVR file, one without a GBIX header gets one */
+int omf_font_write(const char* path, const omf_font* font, const void* pvr, size_t pvr_size);
+#endif
@@ -0,0 +1,81 @@
+/*
+ * File: pvr_palette.h
+ * Project: texture
+ * File Created: Sunday, 18th October 2026 10:12:04 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/* Palettized PVR chunks as emitted by datpack -p4/-p8:
+ *
+ *   [GBIX+PVRT header, 0x20][twiddled indices][pvr_pal_block + colors][zero pad]
+ *
+ * The palette rides along in the same DAT chunk so one read brings in
+ * everything needed to upload the texture. */
+
+#define PVR_PAL_HDR_SIZE   (0x20)
+#define PVR_PAL_BLOCK_MAGIC "PVPL"
+
+/* PVR header color codes */
+#define PVR_PX_ARGB1555 (0x00)
+#define PVR_PX_RGB565   (0x01)
+#define PVR_PX_ARGB4444 (0x02)
+#define PVR_PX_PAL4BPP  (0x05)
+#define PVR_PX_PAL8BPP  (0x06)
+
+/* PVR header layout codes */
+#define PVR_DF_TWIDDLED      (0x01)
+#define PVR_DF_VQ            (0x03)
+#define PVR_DF_RECT          (0x09)
+#define PVR_DF_STRIDE        (0x0B)
+#define PVR_DF_RECT_TWIDDLED (0x0D)
+#define PVR_DF_SMALL_VQ      (0x10)
+
+/* Palette RAM is 1024 entries, shared between the 16 icon slots.
+ * PAL8 icons are limited to 64 colors so every slot owns its share outright,
+ * PAL4 icons use the first 16 colors of that share. */
+#define PVR_PAL_RAM_ENTRIES (1024)
+#define PVR_PAL_SLOT_COLORS (64)
+#define PVR_PAL4_COLORS     (16)
+
+typedef struct pvr_pal_block {
+    char magic[4];       /* PVPL */
+    uint16_t format;     /* PVR_PX_RGB565 or PVR_PX_ARGB4444 */
+    uint16_t num_colors; /* Entries following */
+    uint16_t colors[];
+} pvr_pal_block;
+
+static inline uint32_t
+pvr_pal_texel_size(uint32_t width, uint32_t height, unsigned int px_format) {
+    return (px_format == PVR_PX_PAL4BPP) ? (width * height / 2) : (width * height);
+}
+
+/* Size of the palette block rounded up to 32 bytes, the PVR DMA granularity */
+static inline uint32_t
+pvr_pal_block_size(unsigned int num_colors) {
+    return (sizeof(pvr_pal_block) + num_colors * sizeof(uint16_t) + 31) & ~31u;
+}
+
+static inline const pvr_pal_block*
+pvr_pal_block_get(const void* pvr_data) {
+    const unsigned char* hdr = (const unsigned char*)pvr_data;
+    const unsigned int px_format = hdr[PVR_PAL_HDR_SIZE - 8];
+    const uint32_t width = hdr[PVR_PAL_HDR_SIZE - 4] | hdr[PVR_PAL_HDR_SIZE - 3] << 8;
+    const uint32_t height = hdr[PVR_PAL_HDR_SIZE - 2] | hdr[PVR_PAL_HDR_SIZE - 1] << 8;
+    const pvr_pal_block* block;
+
+    if (px_format != PVR_PX_PAL4BPP && px_format != PVR_PX_PAL8BPP) {
+        return NULL;
+    }
+    block = (const pvr_pal_block*)(hdr + PVR_PAL_HDR_SIZE + pvr_pal_texel_size(width, height, px_format));
+    if (block->magic[0] != 'P' || block->magic[1] != 'V' || block->magic[2] != 'P' || block->magic[3] != 'L') {
+        return NULL;
+    }
+    return block;
+}
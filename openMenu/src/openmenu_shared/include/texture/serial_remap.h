@@ -0,0 +1,102 @@
+/*
+ * File: serial_remap.h
+ * Project: texture
+ * File Created: Sunday, 18th October 2026 11:12:37 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* REMAP.BIN, serial_remap.def (plus any extra rules) compiled by remapgen into
+ * a minimal-ish perfect hash keyed on the product serial. Little endian, every
+ * section 4 byte aligned and addressed by a byte offset from the start:
+ *
+ *   serial_remap_header
+ *   disp   uint16_t[num_buckets], per bucket displacement
+ *   slots  serial_remap_slot[table_size], every key lands in its own slot
+ *   rules  serial_remap_rule[num_rules], grouped per key, fixups first
+ *   pool   NUL terminated strings, offset 0 is the empty string
+ *
+ * A lookup is one hash of the key, two masked indexes and one compare, the key
+ * either sits in that slot or is not in the table. The same image is built in
+ * (serial_remap_table.h) and can be overridden by a REMAP.BIN on the disc. */
+
+#define SERIAL_REMAP_MAGIC   "OMRM"
+#define SERIAL_REMAP_VERSION (1)
+#define SERIAL_REMAP_KEY_MAX (12) /* sizeof(gd_item.product) */
+
+typedef enum SERIAL_REMAP_COND {
+    SERIAL_REMAP_ALWAYS = 0, /* art/meta remap */
+    SERIAL_REMAP_DATE,       /* fixup, date equals cond */
+    SERIAL_REMAP_NAME,       /* fixup, name contains cond */
+} SERIAL_REMAP_COND;
+
+typedef struct serial_remap_header {
+    char magic[4];
+    uint32_t version;
+    uint32_t num_keys;
+    uint32_t table_size;  /* power of 2 */
+    uint32_t num_buckets; /* power of 2 */
+    uint32_t num_rules;
+    uint32_t pool_size;
+    uint32_t disp_offset;
+    uint32_t slots_offset;
+    uint32_t rules_offset;
+    uint32_t pool_offset;
+} serial_remap_header;
+
+typedef struct serial_remap_slot {
+    uint32_t key; /* pool offset, 0 for an empty slot */
+    uint16_t first_rule;
+    uint16_t num_rules;
+} serial_remap_slot;
+
+typedef struct serial_remap_rule {
+    uint32_t cond_type; /* SERIAL_REMAP_COND */
+    uint32_t cond;      /* pool offsets, 0 when unused */
+    uint32_t fixed_product;
+    uint32_t art;
+    uint32_t meta;
+} serial_remap_rule;
+
+/* FNV-1a, keys are short serials so a byte loop is all it needs */
+static inline uint32_t
+serial_remap_hash(const char* key) {
+    uint32_t h = 0x811C9DC5u;
+    while (*key) {
+        h = (h ^ (unsigned char)*key++) * 0x01000193u;
+    }
+    return h;
+}
+
+static inline uint32_t
+serial_remap_bucket(uint32_t h, uint32_t num_buckets) {
+    return (h >> 16 ^ h) & (num_buckets - 1);
+}
+
+static inline uint32_t
+serial_remap_index(uint32_t h, uint32_t disp, uint32_t table_size) {
+    h = (h ^ disp) * 0x9E3779B1u;
+    return (h ^ h >> 15) & (table_size - 1);
+}
+
+/* Slot holding key, NULL when it isn't in the table */
+static inline const serial_remap_slot*
+serial_remap_find(const serial_remap_header* hdr, const char* key) {
+    const unsigned char* image = (const unsigned char*)hdr;
+    const uint16_t* disp = (const uint16_t*)(image + hdr->disp_offset);
+    const serial_remap_slot* slots = (const serial_remap_slot*)(image + hdr->slots_offset);
+    const char* pool = (const char*)(image + hdr->pool_offset);
+
+    const uint32_t h = serial_remap_hash(key);
+    const serial_remap_slot* slot =
+        &slots[serial_remap_index(h, disp[serial_remap_bucket(h, hdr->num_buckets)], hdr->table_size)];
+    return (slot->key && !strcmp(pool + slot->key, key)) ? slot : NULL;
+}
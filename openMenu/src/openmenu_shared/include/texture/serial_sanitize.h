@@ -10,6 +10,8 @@
 
 #pragma once
 
-const char* serial_santize_art(const char* id);
-const char* serial_santize_meta(const char* id);
+struct gd_item;
+
 int serial_sanitizer_init(void);
+/* Applies serial fixups and resolves art_id/meta_id, done once per item at load */
+void serial_sanitize_item(struct gd_item* item);
@@ -0,0 +1,181 @@
+/*
+ * File: arena.c
+ * Project: openmenu_shared
+ * File Created: Monday, 19th October 2026 7:14:52 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+#include "dbgprint.h"
+
+#define ARENA_ALIGN_UP(x) (((x) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+typedef struct arena_block {
+    struct arena_block* prev;
+    size_t size;
+    size_t used;
+} arena_block;
+
+#define ARENA_BLOCK_HEADER ARENA_ALIGN_UP(sizeof(arena_block))
+#define ARENA_BLOCK_DATA(block) ((uint8_t*)(block) + ARENA_BLOCK_HEADER)
+
+typedef struct arena {
+    const char* name;
+    size_t block_size;
+    arena_block* head; /* the one being handed out from */
+    arena_stats stats;
+} arena;
+
+static arena arenas[ARENA_NUM] = {
+#define ARENA(id, name, block_size) [ARENA_##id] = {name, block_size, NULL, {0}},
+#include "arena.def"
+};
+
+static arena_block*
+arena_block_push(arena* a, size_t size) {
+    const size_t block_size = (size > a->block_size) ? size : a->block_size;
+    arena_block* block = malloc(ARENA_BLOCK_HEADER + block_size);
+    if (!block) {
+        LOG_ERROR("%s no free memory for %s\n", __func__, a->name);
+        return NULL;
+    }
+    block->prev = a->head;
+    block->size = block_size;
+    block->used = 0;
+    a->head = block;
+    a->stats.reserved += block_size;
+    a->stats.blocks++;
+    return block;
+}
+
+static void
+arena_block_pop(arena* a) {
+    arena_block* block = a->head;
+    a->head = block->prev;
+    a->stats.used -= block->used;
+    a->stats.reserved -= block->size;
+    a->stats.blocks--;
+    free(block);
+}
+
+void*
+arena_alloc(ARENA_ID id, size_t size) {
+    arena* a = &arenas[id];
+    size = ARENA_ALIGN_UP(size ? size : 1);
+
+    arena_block* block = a->head;
+    if (!block || block->size - block->used < size) {
+        block = arena_block_push(a, size);
+        if (!block) {
+            return NULL;
+        }
+    }
+    void* ptr = ARENA_BLOCK_DATA(block) + block->used;
+    block->used += size;
+    a->stats.used += size;
+    a->stats.allocs++;
+    if (a->stats.used > a->stats.high_water) {
+        a->stats.high_water = a->stats.used;
+    }
+    return ptr;
+}
+
+void*
+arena_calloc(ARENA_ID id, size_t count, size_t size) {
+    void* ptr = arena_alloc(id, count * size);
+    if (ptr) {
+        memset(ptr, '\0', count * size);
+    }
+    return ptr;
+}
+
+void*
+arena_realloc(ARENA_ID id, void* ptr, size_t old_size, size_t size) {
+    if (!ptr) {
+        return arena_alloc(id, size);
+    }
+    arena* a = &arenas[id];
+    arena_block* block = a->head;
+    old_size = ARENA_ALIGN_UP(old_size ? old_size : 1);
+
+    /* Last thing handed out, just move the end */
+    if (block && (uint8_t*)ptr + old_size == ARENA_BLOCK_DATA(block) + block->used) {
+        const size_t start = block->used - old_size;
+        const size_t new_size = ARENA_ALIGN_UP(size ? size : 1);
+        if (block->size - start >= new_size) {
+            block->used = start + new_size;
+            a->stats.used = a->stats.used - old_size + new_size;
+            if (a->stats.used > a->stats.high_water) {
+                a->stats.high_water = a->stats.used;
+            }
+            return ptr;
+        }
+    }
+
+    if (size <= old_size) {
+        return ptr;
+    }
+    void* grown = arena_alloc(id, size);
+    if (grown) {
+        memcpy(grown, ptr, old_size);
+    }
+    return grown;
+}
+
+arena_mark
+arena_get_mark(ARENA_ID id) {
+    const arena* a = &arenas[id];
+    arena_mark mark = {a->head, a->head ? a->head->used : 0};
+    return mark;
+}
+
+void
+arena_rewind(ARENA_ID id, arena_mark mark) {
+    arena* a = &arenas[id];
+    while (a->head && a->head != mark.block) {
+        arena_block_pop(a);
+    }
+    if (a->head && a->head->used > mark.used) {
+        a->stats.used -= a->head->used - mark.used;
+        a->head->used = mark.used;
+    }
+}
+
+void
+arena_reset(ARENA_ID id) {
+    const arena_mark empty = {NULL, 0};
+    arena_rewind(id, empty);
+}
+
+void
+arena_reset_all(void) {
+    for (int i = 0; i < ARENA_NUM; i++) {
+        arena_reset((ARENA_ID)i);
+    }
+}
+
+const char*
+arena_name(ARENA_ID id) {
+    return arenas[id].name;
+}
+
+const arena_stats*
+arena_get_stats(ARENA_ID id) {
+    return &arenas[id].stats;
+}
+
+void
+arena_log_report(void) {
+    for (int i = 0; i < ARENA_NUM; i++) {
+        const arena_stats* stats = &arenas[i].stats;
+        LOG_INFO("ARENA:%-8s %6lu KB used, %6lu KB peak, %6lu KB in %lu blocks\n", arenas[i].name,
+                 (unsigned long)(stats->used / 1024), (unsigned long)(stats->high_water / 1024),
+                 (unsigned long)(stats->reserved / 1024), (unsigned long)stats->blocks);
+    }
+}
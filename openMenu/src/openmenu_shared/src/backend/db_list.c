@@ -10,52 +10,289 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_MODULE DAT
 
 #include "backend/db_list.h"
 #include "backend/dat_format.h"
-#include "texture/serial_sanitize.h"
 #include "backend/db_item.h"
+#include "backend/db_text.h"
+#include "arena.h"
+#include "dbgprint.h"
+#include "om_reader.h"
+#include "profiler.h"
+
+/* Descriptions are paged in DB_PAGE_RECORDS consecutive records at a time and
+ * the last DB_PAGE_SLOTS pages kept, everything else only has its hot bytes
+ * resident. META.DAT v2 pages are decoded from the compressed text block */
+#define DB_PAGE_RECORDS (4)
+#define DB_PAGE_SLOTS   (8)
+#define DB_LOAD_BYTES   (32 * sizeof(db_item)) /* per read while building the hot table */
+
+typedef struct db_page {
+    int first; /* record index of records[0], -1 when unused */
+    unsigned int last_used;
+    db_item records[DB_PAGE_RECORDS];
+} db_page;
 
 static dat_file dat_meta;
-static db_item* db;
 static int dat_first_index;
+static int db_num_records = 0;
+static db_item_hot* db_hot = NULL;
+
+static db_page db_pages[DB_PAGE_SLOTS];
+static unsigned int db_page_clock = 0;
+static const db_page* db_page_pinned = NULL; /* holds the item db_get_meta last returned */
+
+/* v2 only */
+static db_text_dict db_dict;
+static void* db_dict_buf = NULL;
+static uint32_t* db_page_text = NULL; /* text data offset of each page, plus one for the end */
+static uint32_t db_text_data_offset;
+static uint8_t* db_text_scratch = NULL; /* one page worth of compressed text */
+static uint32_t db_text_scratch_size;
+
+/* 0 when all of size came back, a short read means a truncated or failing disc */
+static int
+db_read_at(uint32_t offset, void* buf, size_t size) {
+    return (om_file_read_at(dat_meta.handle, offset, buf, size) == size) ? 0 : -1;
+}
+
+static void
+db_free(void) {
+    arena_reset(ARENA_META);
+    db_hot = NULL;
+    db_page_text = NULL;
+    db_dict_buf = NULL;
+    db_text_scratch = NULL;
+    db_num_records = 0;
+}
+
+/* Dictionary stays resident, the compressed descriptions are read a page at a time */
+static int
+db_load_text_block(void) {
+    const uint32_t block_offset = (dat_first_index + dat_meta.num_chunks) * dat_meta.chunk_size;
+    db_text_header hdr;
+
+    if (db_read_at(block_offset, &hdr, sizeof(hdr)) || memcmp(hdr.magic, DB_TEXT_MAGIC, 4) || hdr.num_entries > DB_TEXT_MAX_ENTRIES || hdr.dict_size > 0xFFFF) {
+        LOG_ERROR("META:Error bad description block!\n");
+        return -1;
+    }
+    const size_t offsets_size = (hdr.num_entries + 1) * sizeof(uint16_t);
+    db_dict_buf = arena_alloc(ARENA_META, offsets_size + hdr.dict_size);
+    if (!db_dict_buf) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        return -1;
+    }
+    if (db_read_at(block_offset + sizeof(hdr), db_dict_buf, offsets_size + hdr.dict_size)) {
+        LOG_ERROR("META:Error reading description dictionary!\n");
+        return -1;
+    }
+    db_dict.offsets = (const uint16_t*)db_dict_buf;
+    db_dict.strings = (const char*)db_dict_buf + offsets_size;
+    db_dict.num_entries = hdr.num_entries;
+    for (uint32_t i = 0; i < hdr.num_entries; i++) {
+        if (db_dict.offsets[i] > db_dict.offsets[i + 1] || db_dict.offsets[i + 1] > hdr.dict_size) {
+            LOG_ERROR("META:Error bad description dictionary!\n");
+            return -1;
+        }
+    }
+    db_text_data_offset = block_offset + sizeof(hdr) + offsets_size + hdr.dict_size;
+
+    const int num_pages = (db_num_records + DB_PAGE_RECORDS - 1) / DB_PAGE_RECORDS;
+    db_page_text[num_pages] = hdr.data_size;
+    uint32_t max_span = 0;
+    for (int i = 0; i < num_pages; i++) {
+        if (db_page_text[i] > db_page_text[i + 1]) {
+            LOG_ERROR("META:Error bad description offsets!\n");
+            return -1;
+        }
+        if (db_page_text[i + 1] - db_page_text[i] > max_span) {
+            max_span = db_page_text[i + 1] - db_page_text[i];
+        }
+    }
+    db_text_scratch_size = max_span ? max_span : 1;
+    db_text_scratch = arena_alloc(ARENA_META, db_text_scratch_size);
+    if (!db_text_scratch) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        return -1;
+    }
+    return 0;
+}
 
 int
 db_load_DAT(void) {
+    for (int i = 0; i < DB_PAGE_SLOTS; i++) {
+        db_pages[i].first = -1;
+        db_pages[i].last_used = 0; /* unused pages go first */
+    }
+    db_page_pinned = NULL;
+    db_free();
+
     DAT_init(&dat_meta);
-    DAT_load_parse(&dat_meta, "META.DAT");
+    if (DAT_load_parse(&dat_meta, "META.DAT", DAT_VERSION_META) || !dat_meta.num_chunks) {
+        return 0;
+    }
+    const uint32_t record_size = (dat_meta.version == 2) ? sizeof(db_item_v2) : sizeof(db_item);
+    if (dat_meta.chunk_size != record_size) {
+        LOG_ERROR("META:Error record size %u, expected %u!\n", (unsigned int)dat_meta.chunk_size,
+                  (unsigned int)record_size);
+        return 0;
+    }
     dat_first_index = dat_meta.items[0].offset;
 
-    /* Read DAT to db, but use Hash table to quickly search */
-    db = malloc(dat_meta.num_chunks * sizeof(db_item));
-    if (!db) {
-        printf("%s no free memory\n", __func__);
+    /* Only the hot bytes stay, the handle is kept open for the description pages */
+    const int batch = DB_LOAD_BYTES / record_size;
+    db_hot = arena_alloc(ARENA_META, dat_meta.num_chunks * sizeof(db_item_hot));
+    const int num_pages = (dat_meta.num_chunks + DB_PAGE_RECORDS - 1) / DB_PAGE_RECORDS;
+    db_page_text = (dat_meta.version == 2) ? arena_alloc(ARENA_META, (num_pages + 1) * sizeof(uint32_t)) : NULL;
+    unsigned char* load_buf = malloc(batch * record_size);
+    if (!db_hot || !load_buf || (dat_meta.version == 2 && !db_page_text)) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        free(load_buf);
+        db_free();
+        return 0;
+    }
+    for (int first = 0; first < (int)dat_meta.num_chunks; first += batch) {
+        const int count = ((int)dat_meta.num_chunks - first < batch) ? (int)dat_meta.num_chunks - first : batch;
+        if (db_read_at((dat_first_index + first) * record_size, load_buf, count * record_size)) {
+            LOG_ERROR("META:Error reading records!\n");
+            free(load_buf);
+            db_free();
+            return 0;
+        }
+        for (int i = 0; i < count; i++) {
+            memcpy(&db_hot[first + i], load_buf + i * record_size, sizeof(db_item_hot));
+            if (db_page_text && (first + i) % DB_PAGE_RECORDS == 0) {
+                db_page_text[(first + i) / DB_PAGE_RECORDS] = ((const db_item_v2*)load_buf)[i].description;
+            }
+        }
+    }
+    free(load_buf);
+    db_num_records = (int)dat_meta.num_chunks;
+    if (dat_meta.version == 2 && db_load_text_block()) {
+        db_free();
         return 0;
     }
-    fs_read(dat_meta.handle, db, dat_meta.num_chunks * sizeof(db_item));
-    fs_close(dat_meta.handle);
 
     DAT_info(&dat_meta);
+    size_t resident = db_num_records * sizeof(db_item_hot) + sizeof(db_pages);
+    if (db_page_text) {
+        resident += (num_pages + 1) * sizeof(uint32_t) + (db_dict.num_entries + 1) * sizeof(uint16_t)
+                    + db_dict.offsets[db_dict.num_entries] + db_text_scratch_size;
+    }
+    LOG_INFO("META:%d records (v%u), %u KB resident\n", db_num_records, (unsigned int)dat_meta.version,
+             (unsigned int)(resident / 1024));
 
     return 0;
 }
 
+static int
+db_record_index(const char* id) {
+    const uint32_t index = db_num_records ? DAT_get_index_by_ID(&dat_meta, id) : 0xFFFFFFFF;
+    if (index == 0xFFFFFFFF || (int)(index - dat_first_index) < 0 || (int)(index - dat_first_index) >= db_num_records) {
+        return -1;
+    }
+    return (int)(index - dat_first_index);
+}
+
+/* Page holding record, read in over the least recently used one on a miss.
+ * NULL if the read came back short */
+static db_page*
+db_page_get(int record) {
+    const int first = record & ~(DB_PAGE_RECORDS - 1);
+    db_page* victim = NULL;
+
+    db_page_clock++;
+    for (int i = 0; i < DB_PAGE_SLOTS; i++) {
+        db_page* page = &db_pages[i];
+        if (page->first == first) {
+            page->last_used = db_page_clock;
+            return page;
+        }
+        if (page != db_page_pinned && (!victim || page->last_used < victim->last_used)) {
+            victim = page;
+        }
+    }
+
+    PROF_COUNT(META_MISS);
+    PROF_BEGIN(META_PAGE);
+    const int count = (db_num_records - first < DB_PAGE_RECORDS) ? db_num_records - first : DB_PAGE_RECORDS;
+    victim->first = -1; /* until it holds the whole page */
+    if (db_page_text) {
+        /* One read for the page's compressed text, then expand each record */
+        const uint32_t* span = &db_page_text[first / DB_PAGE_RECORDS];
+        const uint8_t* text = db_text_scratch;
+        if (db_read_at(db_text_data_offset + span[0], db_text_scratch, span[1] - span[0])) {
+            PROF_END(META_PAGE);
+            return NULL;
+        }
+        for (int i = 0; i < count; i++) {
+            db_item* item = &victim->records[i];
+            memcpy(item, &db_hot[first + i], sizeof(db_item_hot));
+            text = db_text_decode(&db_dict, text, db_text_scratch + (span[1] - span[0]), item->description,
+                                  sizeof(item->description));
+        }
+    } else {
+        if (db_read_at((dat_first_index + first) * dat_meta.chunk_size, victim->records, count * sizeof(db_item))) {
+            PROF_END(META_PAGE);
+            return NULL;
+        }
+    }
+    victim->first = first;
+    victim->last_used = db_page_clock;
+    PROF_END(META_PAGE);
+    return victim;
+}
+
 /* Returns 0 on success and places a pointer in item, otherwise returns 1 and
- * item = NULL */
+ * item = NULL. id is the resolved serial, see gd_item_meta_id. The item stays
+ * valid until the next db_get_meta call */
 int
 db_get_meta(const char* id, struct db_item** item) {
-    const char* id_santized = serial_santize_meta(id);
-    uint32_t index = DAT_get_index_by_ID(&dat_meta, id_santized);
+    const int record = db_record_index(id);
 
-    if (index == 0xFFFFFFFF) {
+    if (record < 0) {
         *item = NULL;
         return 1;
     }
 
-    *item = &db[index - dat_first_index];
+    db_page* page = db_page_get(record);
+    if (!page) {
+        *item = NULL;
+        return 1;
+    }
+    db_page_pinned = page;
+    *item = &page->records[record - page->first];
     return 0;
 }
 
+/* Filter fields only, never touches the disc */
+int
+db_get_meta_hot(const char* id, const struct db_item_hot** hot) {
+    const int record = db_record_index(id);
+
+    if (record < 0) {
+        *hot = NULL;
+        return 1;
+    }
+
+    *hot = &db_hot[record];
+    return 0;
+}
+
+/* Pulls the page for id in ahead of a db_get_meta, the pinned page is kept */
+void
+db_prefetch_meta(const char* id) {
+    const int record = db_record_index(id);
+
+    if (record >= 0) {
+        db_page_get(record);
+    }
+}
+
 const char*
 db_format_nplayers_str(int nplayers) {
     static char str[10];
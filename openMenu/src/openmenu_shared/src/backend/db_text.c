@@ -0,0 +1,54 @@
+/*
+ * File: db_text.c
+ * Project: backend
+ * File Created: Monday, 19th October 2026 12:41:15 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "backend/db_text.h"
+
+const uint8_t*
+db_text_decode(const db_text_dict* dict, const uint8_t* src, const uint8_t* end, char* dst, size_t dst_size) {
+    char* out = dst;
+    char* const out_end = dst + dst_size - 1;
+
+    /* Past out_end the rest is still walked to find the next description */
+    while (src < end) {
+        const uint8_t c = *src++;
+        uint32_t entry;
+
+        if (c == DB_TEXT_END) {
+            break;
+        } else if (c >= 0x80) {
+            entry = c - 0x80;
+        } else if (c >= DB_TEXT_LONG_FIRST && c <= DB_TEXT_LONG_LAST && src < end) {
+            entry = DB_TEXT_SHORT_CODES + (uint32_t)(c - DB_TEXT_LONG_FIRST) * 256 + *src++;
+        } else {
+            if (c == DB_TEXT_ESCAPE && src < end) {
+                if (out < out_end) {
+                    *out++ = (char)*src;
+                }
+                src++;
+            } else if (out < out_end) {
+                *out++ = (char)c;
+            }
+            continue;
+        }
+
+        if (entry < dict->num_entries) {
+            size_t entry_len = dict->offsets[entry + 1] - dict->offsets[entry];
+            if (entry_len > (size_t)(out_end - out)) {
+                entry_len = (size_t)(out_end - out);
+            }
+            memcpy(out, dict->strings + dict->offsets[entry], entry_len);
+            out += entry_len;
+        }
+    }
+    *out = '\0';
+    return src;
+}
@@ -10,17 +10,25 @@
  */
 
 #include <ctype.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
 
-#include <ini.h>
+#define LOG_MODULE LIST
 
 #include "backend/db_item.h"
 #include "backend/db_list.h"
+#include "backend/gd_bin.h"
 #include "backend/gd_item.h"
 #include "backend/gd_list.h"
+#include "arena.h"
+#include "dbgprint.h"
+#include "om_reader.h"
+#include "profiler.h"
+#include "texture/serial_sanitize.h"
 
 #ifdef _arch_dreamcast
 #include <kos/fs.h>
@@ -31,6 +39,8 @@
 
 #ifndef STANDALONE_BINARY
 #include <openmenu_settings.h>
+#else
+#include <uthash.h>
 #endif
 
 /* Base internal original */
@@ -135,76 +145,229 @@ static int folder_items_count = 0;
 static int num_items_multidisc = -1;
 static gd_item* list_multidisc[MULTIDISC_MAX_GAMES_PER_SET] = {NULL};
 
-#ifndef STANDALONE_BINARY
-static inline long int
-filelength(file_t f) {
-    return fs_total(f);
+/* Precompiled index, only present while the list came from OPENMENU.BIN */
+static unsigned char* list_bin_image = NULL;
+static const uint32_t* list_perm_name = NULL;
+static const uint32_t* list_perm_region = NULL;
+static const uint32_t* list_facets = NULL;
+static uint32_t list_facet_words = 0;
+static int folder_tree_from_bin = 0;
+
+/* OPENMENU.INI fields, generated from gd_item.def */
+typedef struct gd_field {
+    const char* section;
+    const char* name;
+    unsigned char len;
+    unsigned short offset;
+    unsigned short size;
+} gd_field;
+
+static const gd_field gd_fields[] = {
+#define CFG(s, n, default) {#s, #n, sizeof(#n) - 1, offsetof(gd_item, n), sizeof(((gd_item*)0)->n)},
+#include "backend/gd_item.def"
+};
+#define GD_NUM_FIELDS (sizeof(gd_fields) / sizeof(gd_fields[0]))
+_Static_assert(GD_NUM_FIELDS <= 32, "section masks hold one bit per field");
+
+/* Key length and first/last letter pick a field, the lookup is then confirmed with one compare */
+#define GD_FIELD_HASH(len, first, last) ((((len) & 7) << 5) | ((((first) | 0x20) ^ ((last) | 0x20)) & 31))
+static signed char gd_field_lut[256];
+static int gd_field_lut_ready = 0;
+
+static void
+gd_field_lut_build(void) {
+    memset(gd_field_lut, -1, sizeof(gd_field_lut));
+    for (unsigned int i = 0; i < GD_NUM_FIELDS; i++) {
+        const gd_field* field = &gd_fields[i];
+        const int hash = GD_FIELD_HASH(field->len, field->name[0], field->name[field->len - 1]);
+        if (gd_field_lut[hash] != -1) {
+            LOG_ERROR("INI:Error field %s collides with %s!\n", field->name, gd_fields[(int)gd_field_lut[hash]].name);
+        }
+        gd_field_lut[hash] = (signed char)i;
+    }
+    gd_field_lut_ready = 1;
 }
-#else
-static inline long int
-filelength(FILE* f) {
-    long int end;
-    fseek(f, 0, SEEK_END);
-    end = ftell(f);
-    fseek(f, 0, SEEK_SET);
 
-    return end;
+static inline int
+ini_is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
 }
-#endif
 
 static int
-read_openmenu_ini(void* user, const char* section, const char* name, const char* value) {
-    /* unused */
-    (void)user;
-
-    if ((strcmp(section, "OPENMENU") == 0) && (strcmp(name, "num_items") == 0)) {
-        num_items_BASE = atoi(value) /* It can occur that GDMenuCardManager under reports by 1 */;
-        num_items_temp = num_items_BASE - 1;
-        gd_slots_BASE = malloc((num_items_BASE + 1) * sizeof(struct gd_item));
-        if (!gd_slots_BASE) {
-            printf("%s no free memory\n", __func__);
-            return 0;
+list_alloc_slots(int num_items) {
+    num_items_BASE = num_items /* It can occur that GDMenuCardManager under reports by 1 */;
+    num_items_temp = num_items_BASE - 1;
+    gd_slots_BASE = arena_calloc(ARENA_LIST, num_items_BASE + 1, sizeof(struct gd_item));
+    if (!gd_slots_BASE) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        return -1;
+    }
+    list_temp = arena_calloc(ARENA_LIST, num_items_BASE + 1, sizeof(struct gd_item*));
+    if (!list_temp) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        return -1;
+    }
+
+    memset(list_multidisc, '\0', MULTIDISC_MAX_GAMES_PER_SET * sizeof(struct gd_item*));
+    return 0;
+}
+
+/* Fields that may appear under the current section, one bit per gd_fields entry */
+static uint32_t
+gd_field_section_mask(const char* section) {
+    uint32_t mask = 0;
+    for (unsigned int i = 0; i < GD_NUM_FIELDS; i++) {
+        if (!strcasecmp(section, gd_fields[i].section)) {
+            mask |= 1u << i;
         }
-        list_temp = malloc((num_items_BASE + 1) * sizeof(struct gd_item*));
-        if (!list_temp) {
-            printf("%s no free memory\n", __func__);
-            return 0;
+    }
+    return mask;
+}
+
+static void
+gd_field_copy(gd_item* item, const gd_field* field, const char* value, size_t value_len) {
+    /* Single char fields (vga) hold no terminator */
+    char* dst = (char*)item + field->offset;
+    const size_t max = (field->size > 1) ? field->size - 1u : 1u;
+    const size_t copy = (value_len < max) ? value_len : max;
+    memcpy(dst, value, copy);
+    if (copy < field->size) {
+        dst[copy] = '\0';
+    }
+}
+
+static void
+list_set_field(gd_item* item, uint32_t section_mask, const char* name, size_t name_len, const char* value,
+               size_t value_len) {
+    const int idx = gd_field_lut[GD_FIELD_HASH(name_len, name[0], name[name_len - 1])];
+    if (idx < 0 || !(section_mask & (1u << idx))) {
+        return;
+    }
+
+    const gd_field* field = &gd_fields[idx];
+    if (field->len != name_len) {
+        return;
+    }
+    /* gd_item.def names are all lowercase */
+    for (size_t i = 0; i < name_len; i++) {
+        const char c = (name[i] >= 'A' && name[i] <= 'Z') ? (char)(name[i] | 0x20) : name[i];
+        if (c != field->name[i]) {
+            return;
         }
+    }
 
-        memset(gd_slots_BASE, '\0', (num_items_BASE + 1) * sizeof(struct gd_item));
-        memset(list_temp, '\0', (num_items_BASE + 1) * sizeof(struct gd_item*));
-        memset(list_multidisc, '\0', MULTIDISC_MAX_GAMES_PER_SET * sizeof(struct gd_item*));
-    } else {
-        /* Parsing games */
-        char slot_string[4] = {0, 0, 0, 0};
-        uintptr_t seperator = (uintptr_t)strchr(name, '.');
-        if (seperator) {
-            size_t temp_len = (size_t)(seperator - (uintptr_t)name);
-            memcpy(slot_string, name, temp_len);
-            int slot = atoi(slot_string);
-            num_items_read = slot;
-
-            gd_item* item = &gd_slots_BASE[slot - 1];
-            if (!item->slot_num) {
-                item->slot_num = slot;
-            }
+    gd_field_copy(item, field, value, value_len);
+}
+
+/* Single pass over the loaded file, lines are only ever pointed at, never copied or modified.
+ * Grammar is the inih subset GDMenuCardManager writes: [SECTION], ;/# comments and
+ * NN.field=value (or num_items=N under [OPENMENU]). */
+static int
+list_scan_ini(const char* buf, size_t len) {
+    const char* const end = buf + len;
+    const char* line = buf;
+    char section[16] = {0};
+    uint32_t section_mask = 0;
+    int lineno = 0;
+
+    if (!gd_field_lut_ready) {
+        gd_field_lut_build();
+    }
 
-            const char* plain_name = name + temp_len + 1;
+    while (line < end) {
+        /* Leading blanks and empty lines */
+        if (ini_is_space(*line) || *line == '\n') {
+            lineno += (*line == '\n');
+            line++;
+            continue;
+        }
 
-            // printf("[%s] %s: %s\n", section, plain_name, value);
+        lineno++;
+        if (*line == ';' || *line == '#' || *line == '[') {
+            const char* eol = memchr(line, '\n', end - line);
+            const char* next = eol ? eol + 1 : end;
+            eol = eol ? eol : end;
+            if (*line == '[') {
+                const char* close = memchr(line, ']', eol - line);
+                if (!close) {
+                    LOG_ERROR("INI:Error line %d: no ']'\n", lineno);
+                } else {
+                    size_t sec_len = (size_t)(close - line - 1);
+                    sec_len = (sec_len < sizeof(section) - 1) ? sec_len : sizeof(section) - 1;
+                    memcpy(section, line + 1, sec_len);
+                    section[sec_len] = '\0';
+                    section_mask = gd_field_section_mask(section);
+                }
+            }
+            line = next;
+            continue;
+        }
 
-            if (0)
-                ;
-#define CFG(s, n, default)                                                                                             \
-    else if (strcasecmp(section, #s) == 0 && strcasecmp(plain_name, #n) == 0) strcpy(item->n, value);
-#include "backend/gd_item.def"
+        /* Key runs up to the delimiter, the value on to the end of the line */
+        const char* delim = line;
+        while (delim < end && *delim != '=' && *delim != ':' && *delim != '\n') {
+            delim++;
+        }
+        if (delim == end || *delim == '\n') {
+            LOG_ERROR("INI:Error line %d: no '='\n", lineno);
+            line = (delim < end) ? delim + 1 : end;
+            continue;
+        }
+        const char* eol = memchr(delim, '\n', end - delim);
+        const char* next = eol ? eol + 1 : end;
+        eol = eol ? eol : end;
+        while (eol > delim + 1 && ini_is_space(eol[-1])) {
+            eol--;
+        }
+        const char* key_end = delim;
+        while (key_end > line && ini_is_space(key_end[-1])) {
+            key_end--;
+        }
+        const char* value = delim + 1;
+        while (value < eol && ini_is_space(*value)) {
+            value++;
+        }
+        const size_t key_len = (size_t)(key_end - line);
+        const size_t value_len = (size_t)(eol - value);
+
+        if (key_len == 9 && !memcmp(line, "num_items", 9) && !strcmp(section, "OPENMENU")) {
+            if (gd_slots_BASE) {
+                LOG_ERROR("INI:Error line %d: num_items repeated\n", lineno);
+            } else if (list_alloc_slots(atoi(value))) {
+                return -1;
+            }
+            line = next;
+            continue;
+        }
 
-        } else {
-            /* error */
-            printf("INI:Error unknown [%s] %s: %s\n", section, name, value);
+        /* Parsing games */
+        unsigned int slot = 0;
+        const char* name = line;
+        while (name < key_end && *name >= '0' && *name <= '9') {
+            slot = slot * 10 + (unsigned int)(*name++ - '0');
         }
+        if (name == line || name + 1 >= key_end || *name != '.') {
+            LOG_WARN("INI:Error unknown [%s] %.*s: %.*s\n", section, (int)key_len, line, (int)value_len, value);
+            line = next;
+            continue;
+        }
+        if (!gd_slots_BASE || slot < 1 || slot > (unsigned int)num_items_BASE + 1) {
+            LOG_ERROR("INI:Error line %d: slot %u out of range\n", lineno, slot);
+            line = next;
+            continue;
+        }
+        num_items_read = slot;
+
+        gd_item* item = &gd_slots_BASE[slot - 1];
+        if (!item->slot_num) {
+            item->slot_num = slot;
+        }
+        name++;
+        list_set_field(item, section_mask, name, (size_t)(key_end - name), value, value_len);
+
+        line = next;
     }
-    return 1;
+    return 0;
 }
 
 void
@@ -245,22 +408,33 @@ list_print(const gd_item** list) {
     printf("\n");
 }
 
+/* Disc 2+ of a set with a product code, hidden when multidisc grouping is on */
+static inline int
+list_item_is_extra_disc(int base_idx) {
+    if (list_facets) {
+        return gd_facet_test(list_facets, list_facet_words, GD_FACET_MULTIDISC, base_idx);
+    }
+    int disc_num = gd_item_disc_num(gd_slots_BASE[base_idx].disc);
+    int disc_set = gd_item_disc_total(gd_slots_BASE[base_idx].disc);
+    return disc_num > 1 && disc_set > 1 && gd_slots_BASE[base_idx].product[0] != '\0';
+}
+
+/* Fills list_temp in base order, or in the order of a precompiled permutation */
 static void
-list_temp_reset(void) {
-    int base_idx, temp_idx = 0;
+list_temp_fill(const uint32_t* perm) {
+    int temp_idx = 0;
 
-#ifdef _arch_dreamcast
+#ifndef STANDALONE_BINARY
     int hide_multidisc = sf_multidisc[0];
 #else
     int hide_multidisc = 0;
 #endif
 
     /* Skip openMenu itself */
-    for (base_idx = 1; base_idx < num_items_BASE; base_idx++) {
-        int disc_num = gd_item_disc_num(gd_slots_BASE[base_idx].disc);
-        int disc_set = gd_item_disc_total(gd_slots_BASE[base_idx].disc);
+    for (int i = 0; i < num_items_BASE - 1; i++) {
+        const int base_idx = perm ? (int)perm[i] : i + 1;
         /* Only hide multi-disc entries if they have a valid product code */
-        if (hide_multidisc && disc_num > 1 && disc_set > 1 && gd_slots_BASE[base_idx].product[0] != '\0') {
+        if (hide_multidisc && list_item_is_extra_disc(base_idx)) {
             continue;
         }
 
@@ -269,6 +443,11 @@ list_temp_reset(void) {
     num_items_temp = temp_idx;
 }
 
+static void
+list_temp_reset(void) {
+    list_temp_fill(NULL);
+}
+
 static int
 struct_cmp_by_name(const void* a, const void* b) {
     const gd_item* ia = *(const gd_item**)a;
@@ -285,66 +464,98 @@ struct_cmp_by_region(const void* a, const void* b) {
 
 void
 list_set_sort_name(void) {
+    PROF_BEGIN(LIST);
     list_temp_reset();
     list_current = (gd_item**)list_alphabet;
     num_items_current = num_items_alphabet;
+    PROF_END(LIST);
 }
 
 void
 list_set_sort_region(void) {
+    PROF_BEGIN(LIST);
     list_temp_reset();
     list_current = (gd_item**)list_region;
     num_items_current = num_items_region;
+    PROF_END(LIST);
 }
 
 void
 list_set_sort_genre(void) {
+    PROF_BEGIN(LIST);
     list_temp_reset();
     list_current = (gd_item**)list_genre;
     num_items_current = num_items_genre;
+    PROF_END(LIST);
 }
 
 void
 list_set_sort_default(void) {
+    PROF_BEGIN(LIST);
     list_temp_reset();
     list_current = list_temp;
     num_items_current = num_items_temp;
+    PROF_END(LIST);
 }
 
 void
 list_set_sort_alphabetical(void) {
-    list_temp_reset();
-    qsort(list_temp, num_items_temp, sizeof(gd_item*), struct_cmp_by_name);
+    PROF_BEGIN(LIST);
+    if (list_perm_name) {
+        list_temp_fill(list_perm_name);
+    } else {
+        list_temp_reset();
+        qsort(list_temp, num_items_temp, sizeof(gd_item*), struct_cmp_by_name);
+    }
     list_current = list_temp;
     num_items_current = num_items_temp;
+    PROF_END(LIST);
 }
 
 void
 list_set_sort_filter(const char type, int num) {
-#ifdef _arch_dreamcast
-    int base_idx, temp_idx = 1;
+    PROF_BEGIN(LIST);
+    int temp_idx = 1;
+#ifndef STANDALONE_BINARY
     int hide_multidisc = sf_multidisc[0];
+#else
+    int hide_multidisc = 0;
+#endif
 
     FLAGS_GENRE matching_genre = (1 << num);
+    /* OPENMENU.BIN already holds the result sorted by name and the region/letter matches */
+    const uint32_t* perm = list_perm_name;
+    int facet = -1;
+    if (list_facets && type == 'R' && num >= 0 && num < 4) {
+        facet = GD_FACET_REGION_J + num;
+    } else if (list_facets && type != 'G' && type != 'R' && num >= 0 && num < 27) {
+        facet = GD_FACET_LETTER + num;
+    }
 
     list_temp[0] = &back_button;
     back_button.product[0] = type;
 
     /* Skip openMenu itself */
-    for (base_idx = 1; base_idx < num_items_BASE; base_idx++) {
-        int disc_num = gd_item_disc_num(gd_slots_BASE[base_idx].disc);
-        int disc_set = gd_item_disc_total(gd_slots_BASE[base_idx].disc);
+    for (int i = 0; i < num_items_BASE - 1; i++) {
+        const int base_idx = perm ? (int)perm[i] : i + 1;
         /* Only hide multi-disc entries if they have a valid product code */
-        if (hide_multidisc && disc_num > 1 && disc_set > 1 && gd_slots_BASE[base_idx].product[0] != '\0') {
+        if (hide_multidisc && list_item_is_extra_disc(base_idx)) {
             continue;
         }
 
         gd_item* temp_item = &gd_slots_BASE[base_idx];
-        db_item* temp_meta;
+        const db_item_hot* temp_meta;
+
+        if (facet >= 0) {
+            if (gd_facet_test(list_facets, list_facet_words, facet, base_idx)) {
+                list_temp[temp_idx++] = temp_item;
+            }
+            continue;
+        }
 
         switch (type) {
             case 'G':
-                if (!db_get_meta(temp_item->product, &temp_meta)) {
+                if (!db_get_meta_hot(gd_item_meta_id(temp_item), &temp_meta)) {
                     if (num == 16 && !temp_meta->genre) {
                         list_temp[temp_idx++] = temp_item;
                     } else if (temp_meta->genre & matching_genre) {
@@ -377,10 +588,12 @@ list_set_sort_filter(const char type, int num) {
         }
     }
 
-    qsort(&list_temp[1], temp_idx - 1, sizeof(gd_item*), struct_cmp_by_name);
+    if (!perm) {
+        qsort(&list_temp[1], temp_idx - 1, sizeof(gd_item*), struct_cmp_by_name);
+    }
     list_current = list_temp;
     num_items_current = num_items_temp = temp_idx;
-#endif
+    PROF_END(LIST);
 }
 
 const struct gd_item**
@@ -393,25 +606,27 @@ list_get_multidisc(void) {
     return (const gd_item**)list_multidisc;
 }
 
-void
-list_set_genre(int matching_genre) {
-#if !defined(STANDALONE_BINARY)
-    int base_idx, temp_idx = 0;
+static void
+list_set_genre_ordered(int matching_genre, const uint32_t* perm) {
+    int temp_idx = 0;
 
+#ifndef STANDALONE_BINARY
     int hide_multidisc = sf_multidisc[0];
+#else
+    int hide_multidisc = 0;
+#endif
 
     /* Skip openMenu itself */
-    for (base_idx = 1; base_idx < num_items_BASE; base_idx++) {
-        int disc_num = gd_item_disc_num(gd_slots_BASE[base_idx].disc);
-        int disc_set = gd_item_disc_total(gd_slots_BASE[base_idx].disc);
+    for (int i = 0; i < num_items_BASE - 1; i++) {
+        const int base_idx = perm ? (int)perm[i] : i + 1;
         /* Only hide multi-disc entries if they have a valid product code */
-        if (hide_multidisc && disc_num > 1 && disc_set > 1 && gd_slots_BASE[base_idx].product[0] != '\0') {
+        if (hide_multidisc && list_item_is_extra_disc(base_idx)) {
             continue;
         }
 
         gd_item* temp_item = &gd_slots_BASE[base_idx];
-        db_item* temp_meta;
-        if (!db_get_meta(temp_item->product, &temp_meta)) {
+        const db_item_hot* temp_meta;
+        if (!db_get_meta_hot(gd_item_meta_id(temp_item), &temp_meta)) {
             if (temp_meta->genre & matching_genre) {
                 list_temp[temp_idx++] = temp_item;
             }
@@ -419,28 +634,43 @@ list_set_genre(int matching_genre) {
     }
 
     num_items_temp = temp_idx;
-#endif
+}
+
+void
+list_set_genre(int matching_genre) {
+    PROF_BEGIN(LIST);
+    list_set_genre_ordered(matching_genre, NULL);
+    PROF_END(LIST);
 }
 
 void
 list_set_genre_sort(int genre, int sort) {
+    PROF_BEGIN(LIST);
     FLAGS_GENRE matching_genre = (1 << genre);
-    list_set_genre(matching_genre);
+    const uint32_t* perm = (sort == 1) ? list_perm_name : (sort == 2) ? list_perm_region : NULL;
 
-    switch (sort) {
-        case 1: qsort(list_temp, num_items_temp, sizeof(gd_item*), struct_cmp_by_name); break;
-        case 2: qsort(list_temp, num_items_temp, sizeof(gd_item*), struct_cmp_by_region); break;
-        default:
-            /* @Note: no sort, strange codeflow */
-            break;
+    if (perm) {
+        list_set_genre_ordered(matching_genre, perm);
+    } else {
+        list_set_genre(matching_genre);
+
+        switch (sort) {
+            case 1: qsort(list_temp, num_items_temp, sizeof(gd_item*), struct_cmp_by_name); break;
+            case 2: qsort(list_temp, num_items_temp, sizeof(gd_item*), struct_cmp_by_region); break;
+            default:
+                /* @Note: no sort, strange codeflow */
+                break;
+        }
     }
 
     list_current = list_temp;
     num_items_current = num_items_temp;
+    PROF_END(LIST);
 }
 
 void
 list_set_multidisc(const char* product_id) {
+    PROF_BEGIN(LIST);
     int base_idx, temp_idx = 0;
 
     /* Skip openMenu itself */
@@ -452,10 +682,12 @@ list_set_multidisc(const char* product_id) {
         list_multidisc[temp_idx++] = &gd_slots_BASE[base_idx];
     }
     num_items_multidisc = temp_idx;
+    PROF_END(LIST);
 }
 
 void
 list_set_multidisc_filtered(const char* product_id, const char* folder_path) {
+    PROF_BEGIN(LIST);
     int base_idx, temp_idx = 0;
 
     /* Skip openMenu itself */
@@ -473,6 +705,7 @@ list_set_multidisc_filtered(const char* product_id, const char* folder_path) {
         list_multidisc[temp_idx++] = &gd_slots_BASE[base_idx];
     }
     num_items_multidisc = temp_idx;
+    PROF_END(LIST);
 }
 
 int
@@ -507,138 +740,222 @@ list_multidisc_length(void) {
 }
 
 static void
-fix_sega_serials(void) {
-    /* fixing Sega serial issues... */
+list_resolve_serials(void) {
+    /* Serial fixups and art/meta remaps, see serial_remap.def */
 
     /* Skip openMenu itself */
     for (int base_idx = 1; base_idx < num_items_BASE; base_idx++) {
-        gd_item* item = &gd_slots_BASE[base_idx];
+        serial_sanitize_item(&gd_slots_BASE[base_idx]);
+    }
+}
 
-        /* Fix Alone in the Dark (PAL) overlapping Alone in the Dark (USA) */
-        if (!strcmp(item->product, "T15117N") && !strcmp(item->date, "20010423")) {
-            strcpy(item->product, "T15112D05");
-        }
-        /* Fix Crazy Taxi (PAL) overlapping Crazy Taxi (USA) */
-        if (!strcmp(item->product, "MK51035") && !strcmp(item->date, "20000120")) {
-            strcpy(item->product, "MK5103550");
-        }
-        /* Fix Disney's Donald Duck: Goin' Quackers (USA) overlapping Disney's
-     * Donald Duck: Quack Attack (PAL) */
-        if (!strcmp(item->product, "T17714D50") && !strcmp(item->date, "20001116")) {
-            strcpy(item->product, "T17719N");
-        }
-        /* Fix Floigan Bros (PAL) overlapping Floigan Bros (USA) */
-        if (!strcmp(item->product, "MK51114") && !strcmp(item->date, "20010920")) {
-            strcpy(item->product, "MK5111450");
-        }
-        /* Fix Legacy of Kain: Soul Reaver (PAL) overlapping Legacy of Kain: Soul
-     * Reaver (USA) */
-        if (!strcmp(item->product, "T36802N") && !strcmp(item->date, "19991220")) {
-            strcpy(item->product, "T36803D05");
-        }
-        /* Fix NBA2K2 (PAL) overlapping NBA2K2 (USA) */
-        if (!strcmp(item->product, "MK51178") && !strcmp(item->date, "20011129")) {
-            strcpy(item->product, "MK5117850");
-        }
-        /* Fix NBA Showtime (PAL) overlapping 4 Wheel Thunder (PAL) */
-        if (!strcmp(item->product, "T9706D50") && !strcmp(item->date, "19991201")) {
-            strcpy(item->product, "T9705D50");
-        }
-        /* Fix Nightmare Creatures II (USA) overlapping Dancing Blade 2 (JAP) */
-        if (!strcmp(item->product, "T9504M") && !strcmp(item->date, "20000407")) {
-            strcpy(item->product, "T9504N");
-        }
-        /* Fix Plasma Sword (PAL) overlapping Street Fighter Alpha 3 (PAL) */
-        if (!strcmp(item->product, "T7005D") && !strcmp(item->date, "20000711")) {
-            strcpy(item->product, "T7003D");
+/* Whole file in one read, NULL if it can't be opened */
+static char*
+list_load_file(const char* filename, size_t* size) {
+    return om_read_file(filename, size, NULL);
+}
+
+int
+list_read(const char* filename) {
+    /* Always LD/cdrom */
+    size_t ini_size;
+    char* ini_buffer = list_load_file(filename, &ini_size);
+    if (!ini_buffer) {
+        LOG_ERROR("INI:Error opening %s!\n", filename);
+        /*exit or something */
+        return -1;
+    }
+
+    LOG_INFO("INI:Open %s\n", filename);
+
+    const int parse_ret = list_scan_ini(ini_buffer, ini_size);
+    free(ini_buffer);
+    if (parse_ret < 0) {
+        LOG_ERROR("INI:Error Parsing %s!\n", filename);
+        /*exit or something */
+        return -1;
+    }
+
+    LOG_INFO("Info: Loaded %d items from %d\n", num_items_read, num_items_BASE);
+    /* Trim list if over reported */
+    if (num_items_read != num_items_BASE) {
+        num_items_BASE = num_items_read;
+        num_items_temp = num_items_read - 1;
+    }
+
+    list_resolve_serials();
+
+    LOG_INFO("INI:Parse success (%d items)!\n", num_items_BASE);
+    list_temp_reset();
+
+    return 0;
+}
+
+static int
+gd_bin_section_ok(const gd_bin_header* hdr, size_t bin_size, uint32_t offset, uint32_t count, size_t elem_size) {
+    return (offset & 3) == 0 && offset >= sizeof(*hdr) && offset <= bin_size
+           && (uint64_t)count * elem_size <= (uint64_t)(bin_size - offset);
+}
+
+/* Rebuilds the folder tree from the preorder node table, same shape list_folder_init would make */
+static int
+list_restore_folders(const gd_bin_header* hdr, const unsigned char* image) {
+    const gd_bin_node* bin_nodes = (const gd_bin_node*)(image + hdr->nodes_offset);
+    const uint32_t* folder_games = (const uint32_t*)(image + hdr->folder_games_offset);
+    const char* pool = (const char*)(image + hdr->pool_offset);
+
+    folder_node_t** nodes = malloc(hdr->num_nodes * sizeof(folder_node_t*));
+    if (!nodes) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < hdr->num_nodes; i++) {
+        const gd_bin_node* bn = &bin_nodes[i];
+        if ((i && bn->parent >= i) || bn->name >= hdr->pool_size
+            || (uint64_t)bn->games_start + bn->num_games > hdr->num_folder_games) {
+            LOG_ERROR("INI:Error bad folder node %u\n", (unsigned int)i);
+            break;
         }
-        /* Fix Skies of Arcadia (PAL) overlapping Skies of Arcadia (USA) */
-        if (!strcmp(item->product, "MK51052") && !strcmp(item->date, "20010306")) {
-            strcpy(item->product, "MK5105250");
+
+        folder_node_t* node = arena_calloc(ARENA_FOLDERS, 1, sizeof(folder_node_t));
+        if (!node) {
+            LOG_ERROR("%s no free memory\n", __func__);
+            break;
         }
-        /* Fix Spider-Man (PAL) overlapping Spider-Man (USA) */
-        if (!strcmp(item->product, "T13008N") && !strcmp(item->date, "20010402")) {
-            strcpy(item->product, "T13011D50");
+        strncpy(node->name, pool + bn->name, 255);
+        node->name[255] = '\0';
+        node->first_seen_slot = bn->first_seen_slot;
+        node->games_capacity = bn->num_games ? bn->num_games : 1;
+        node->games = arena_alloc(ARENA_FOLDERS, node->games_capacity * sizeof(gd_item*));
+        if (!node->games) {
+            LOG_ERROR("%s no free memory\n", __func__);
+            break;
         }
-        /* Fix TNN Motorsports (USA) overlapping Metal Slug 6 (AW) */
-        if (!strcmp(item->product, "T0000M") && !strcmp(item->date, "19990813")) {
-            strcpy(item->product, "T13701N");
+        for (uint32_t g = 0; g < bn->num_games; g++) {
+            const uint32_t idx = folder_games[bn->games_start + g];
+            if (idx && idx < (uint32_t)num_items_BASE) {
+                node->games[node->num_games++] = &gd_slots_BASE[idx];
+            }
         }
 
-        /* Fix Maximum Speed (AW) overlapping Dolphin Blue (AW) */
-        if (!strcmp(item->product, "T0006M") && !strcmp(item->date, "20030609")) {
-            strcpy(item->product, "T0010M");
+        nodes[i] = node;
+        if (!i) {
+            folder_tree_root = node;
+            continue;
         }
-
-        /* Fix Fist of North Star (AW) overlapping Rumble Fish (AW) */
-        if (!strcmp(item->product, "T0009M") && strstr(item->name, "orth")) {
-            strcpy(item->product, "T0026M");
+        folder_node_t* parent = nodes[bn->parent];
+        if (!parent || parent->num_children >= MAX_FOLDER_CHILDREN) {
+            /* Left in the arena until the tree goes */
+            nodes[i] = NULL;
+            continue;
         }
+        node->parent = parent;
+        parent->children[parent->num_children++] = node;
     }
+
+    free(nodes);
+    folder_state.depth = 0;
+    folder_state.path[0] = '\0';
+    folder_tree_from_bin = (folder_tree_root != NULL);
+    return folder_tree_root ? 0 : -1;
+}
+
+static void*
+list_arena_alloc(size_t size) {
+    return arena_alloc(ARENA_LIST, size);
 }
 
 int
-list_read(const char* filename) {
-    /* Always LD/cdrom */
-#ifndef STANDALONE_BINARY
-    file_t ini = fs_open(filename, O_RDONLY);
-    if (ini == -1)
-#else
-    FILE* ini = fopen(filename, "rb");
-    if (!ini)
-#endif
-    {
-        printf("INI:Error opening %s!\n", filename);
-        fflush(stdout);
-        /*exit or something */
+list_read_bin(const char* bin_filename, const char* ini_filename) {
+    size_t ini_size, bin_size;
+
+    /* The image stays as the index, it goes with the rest of the list */
+    const arena_mark mark = arena_get_mark(ARENA_LIST);
+    unsigned char* image = (unsigned char*)om_read_file(bin_filename, &bin_size, list_arena_alloc);
+    if (!image) {
         return -1;
     }
-
-    printf("INI:Open %s\n", filename);
-
-    size_t ini_size = filelength(ini);
-    char* ini_buffer = malloc(ini_size + 2) /* adjust for adding newline at end always */;
-    if (!ini_buffer) {
-        printf("%s no free memory\n", __func__);
+    const gd_bin_header* hdr = (const gd_bin_header*)image;
+    if (bin_size < sizeof(*hdr) || memcmp(hdr->magic, GD_BIN_MAGIC, 4) || hdr->version != GD_BIN_VERSION
+        || hdr->num_fields != GD_BIN_NUM_FIELDS || hdr->num_facets != GD_FACET_COUNT || hdr->num_items < 1
+        || hdr->facet_words != (hdr->num_items + 31) / 32 || hdr->num_nodes < 1
+        || !gd_bin_section_ok(hdr, bin_size, hdr->items_offset, hdr->num_items, sizeof(gd_bin_item))
+        || !gd_bin_section_ok(hdr, bin_size, hdr->nodes_offset, hdr->num_nodes, sizeof(gd_bin_node))
+        || !gd_bin_section_ok(hdr, bin_size, hdr->folder_games_offset, hdr->num_folder_games, sizeof(uint32_t))
+        || !gd_bin_section_ok(hdr, bin_size, hdr->perm_name_offset, hdr->num_items - 1, sizeof(uint32_t))
+        || !gd_bin_section_ok(hdr, bin_size, hdr->perm_region_offset, hdr->num_items - 1, sizeof(uint32_t))
+        || !gd_bin_section_ok(hdr, bin_size, hdr->facets_offset, GD_FACET_COUNT * hdr->facet_words, sizeof(uint32_t))
+        || !gd_bin_section_ok(hdr, bin_size, hdr->pool_offset, hdr->pool_size, 1) || !hdr->pool_size
+        || image[hdr->pool_offset + hdr->pool_size - 1] != '\0') {
+        LOG_WARN("INI:%s is not a usable list image\n", bin_filename);
+        arena_rewind(ARENA_LIST, mark);
         return -1;
     }
-#ifndef STANDALONE_BINARY
-    fs_read(ini, ini_buffer, ini_size);
-    fs_close(ini);
-#else
-    fread(ini_buffer, ini_size, 1, ini);
-    fclose(ini);
-#endif
-    /* Add newline */
-    ini_buffer[ini_size + 0] = '\n';
-    ini_buffer[ini_size + 1] = '\0';
 
-    if (ini_parse_string(ini_buffer, read_openmenu_ini, NULL) < 0) {
-        printf("INI:Error Parsing %s!\n", filename);
-        fflush(stdout);
-        /*exit or something */
+    /* Only trusted while it still describes the INI next to it */
+    char* ini_buffer = list_load_file(ini_filename, &ini_size);
+    if (!ini_buffer) {
+        arena_rewind(ARENA_LIST, mark);
         return -1;
     }
+    const uint32_t ini_hash = gd_bin_hash(ini_buffer, ini_size);
     free(ini_buffer);
+    if (ini_size != hdr->ini_size || ini_hash != hdr->ini_hash) {
+        LOG_INFO("INI:%s is stale, parsing %s\n", bin_filename, ini_filename);
+        arena_rewind(ARENA_LIST, mark);
+        return -1;
+    }
 
-    printf("Info: Loaded %d items from %d\n", num_items_read, num_items_BASE);
-    /* Trim list if over reported */
-    if (num_items_read != num_items_BASE) {
-        num_items_BASE = num_items_read;
-        num_items_temp = num_items_read - 1;
+    const uint32_t* perm_name = (const uint32_t*)(image + hdr->perm_name_offset);
+    const uint32_t* perm_region = (const uint32_t*)(image + hdr->perm_region_offset);
+    for (uint32_t i = 0; i < hdr->num_items - 1; i++) {
+        if (!perm_name[i] || perm_name[i] >= hdr->num_items || !perm_region[i] || perm_region[i] >= hdr->num_items) {
+            LOG_WARN("INI:%s has a bad sort order\n", bin_filename);
+            arena_rewind(ARENA_LIST, mark);
+            return -1;
+        }
+    }
+
+    if (list_alloc_slots((int)hdr->num_items)) {
+        arena_rewind(ARENA_LIST, mark);
+        return -1;
+    }
+    const gd_bin_item* bin_items = (const gd_bin_item*)(image + hdr->items_offset);
+    const char* pool = (const char*)(image + hdr->pool_offset);
+    for (uint32_t i = 0; i < hdr->num_items; i++) {
+        gd_item* item = &gd_slots_BASE[i];
+        item->slot_num = bin_items[i].slot_num;
+        for (int f = 0; f < GD_BIN_NUM_FIELDS; f++) {
+            const uint32_t str = bin_items[i].str[f];
+            if (str < hdr->pool_size) {
+                gd_field_copy(item, &gd_fields[f], pool + str, strlen(pool + str));
+            }
+        }
     }
+    num_items_read = num_items_BASE;
+    list_resolve_serials();
+
+    list_bin_image = image;
+    list_perm_name = perm_name;
+    list_perm_region = perm_region;
+    list_facets = (const uint32_t*)(image + hdr->facets_offset);
+    list_facet_words = hdr->facet_words;
 
-    fix_sega_serials();
+    list_folder_destroy();
+    list_restore_folders(hdr, image);
 
-    printf("INI:Parse success (%d items)!\n", num_items_BASE);
+    LOG_INFO("INI:Loaded %d items from %s\n", num_items_BASE, bin_filename);
     list_temp_reset();
-    fflush(stdout);
 
     return 0;
 }
 
 int
 list_read_default(void) {
+    if (!list_read_bin(PATH_PREFIX "OPENMENU.BIN", PATH_PREFIX "OPENMENU.INI")) {
+        return 0;
+    }
     return list_read(PATH_PREFIX "OPENMENU.INI");
 }
 
@@ -646,10 +963,16 @@ void
 list_destroy(void) {
     num_items_BASE = -1;
     num_items_temp = -1;
-    free(gd_slots_BASE);
-    free(list_temp);
+    arena_reset(ARENA_LIST);
     gd_slots_BASE = NULL;
     list_temp = NULL;
+
+    list_bin_image = NULL;
+    list_perm_name = NULL;
+    list_perm_region = NULL;
+    list_facets = NULL;
+    list_facet_words = 0;
+    folder_tree_from_bin = 0;
 }
 
 const gd_item*
@@ -708,7 +1031,7 @@ folder_find_or_create_node(folder_node_t* parent, const char* name, int slot_num
         return NULL;
     }
 
-    folder_node_t* node = calloc(1, sizeof(folder_node_t));
+    folder_node_t* node = arena_calloc(ARENA_FOLDERS, 1, sizeof(folder_node_t));
     if (!node) {
         return NULL;
     }
@@ -720,9 +1043,8 @@ folder_find_or_create_node(folder_node_t* parent, const char* name, int slot_num
 
     /* Allocate initial capacity for games (start with 64, will grow as needed) */
     node->games_capacity = 64;
-    node->games = malloc(node->games_capacity * sizeof(gd_item*));
+    node->games = arena_alloc(ARENA_FOLDERS, node->games_capacity * sizeof(gd_item*));
     if (!node->games) {
-        free(node);
         return NULL;
     }
     node->num_games = 0;
@@ -763,24 +1085,6 @@ folder_find_by_path(folder_node_t* root, const char* path) {
     return current;
 }
 
-static void
-folder_tree_destroy_recursive(folder_node_t* node) {
-    if (!node) {
-        return;
-    }
-
-    for (int i = 0; i < node->num_children; i++) {
-        folder_tree_destroy_recursive(node->children[i]);
-    }
-
-    /* Free the dynamic games array */
-    if (node->games) {
-        free(node->games);
-    }
-
-    free(node);
-}
-
 static int
 folder_cmp(const void* a, const void* b) {
     const gd_item** item_a = (const gd_item**)a;
@@ -798,9 +1102,11 @@ folder_cmp(const void* a, const void* b) {
      * - SORT_DEFAULT (0) = Alphabetical (old default behavior)
      * - SORT_NAME (1) = SD Card Order
      * Sort by slot order when Sort = Name, otherwise alphabetically */
+#ifndef STANDALONE_BINARY
     if (sf_sort[0] == SORT_NAME) {
         return (*item_a)->slot_num - (*item_b)->slot_num;
     }
+#endif
 
     return strcasecmp((*item_a)->name, (*item_b)->name);
 }
@@ -873,9 +1179,14 @@ folder_has_visible_content(folder_node_t* node, int hide_multidisc) {
 
 void
 list_folder_init(void) {
-    folder_tree_root = calloc(1, sizeof(folder_node_t));
+    if (folder_tree_root && folder_tree_from_bin) {
+        /* Already restored from OPENMENU.BIN */
+        return;
+    }
+
+    folder_tree_root = arena_calloc(ARENA_FOLDERS, 1, sizeof(folder_node_t));
     if (!folder_tree_root) {
-        printf("Error: Could not allocate folder tree root\n");
+        LOG_ERROR("Error: Could not allocate folder tree root\n");
         return;
     }
 
@@ -883,10 +1194,9 @@ list_folder_init(void) {
 
     /* Allocate initial capacity for root node's games */
     folder_tree_root->games_capacity = 64;
-    folder_tree_root->games = malloc(folder_tree_root->games_capacity * sizeof(gd_item*));
+    folder_tree_root->games = arena_alloc(ARENA_FOLDERS, folder_tree_root->games_capacity * sizeof(gd_item*));
     if (!folder_tree_root->games) {
-        printf("Error: Could not allocate root games array\n");
-        free(folder_tree_root);
+        LOG_ERROR("Error: Could not allocate root games array\n");
         folder_tree_root = NULL;
         return;
     }
@@ -911,12 +1221,14 @@ list_folder_init(void) {
             /* Grow the games array if needed */
             if (current->num_games >= current->games_capacity) {
                 int new_capacity = current->games_capacity * 2;
-                gd_item** new_games = realloc(current->games, new_capacity * sizeof(gd_item*));
+                gd_item** new_games = arena_realloc(ARENA_FOLDERS, current->games,
+                                                    current->games_capacity * sizeof(gd_item*),
+                                                    new_capacity * sizeof(gd_item*));
                 if (new_games) {
                     current->games = new_games;
                     current->games_capacity = new_capacity;
                 } else {
-                    printf("Warning: Could not expand games array for folder '%s'\n", current->name);
+                    LOG_WARN("Warning: Could not expand games array for folder '%s'\n", current->name);
                     continue;
                 }
             }
@@ -927,20 +1239,22 @@ list_folder_init(void) {
     folder_state.depth = 0;
     folder_state.path[0] = '\0';
 
-    printf("Info: Folder tree built successfully\n");
+    LOG_INFO("Info: Folder tree built successfully\n");
 }
 
 void
 list_set_folder_root(void) {
-    printf("list_set_folder_root: Starting\n");
+    PROF_BEGIN(LIST);
+    LOG_DEBUG("list_set_folder_root: Starting\n");
     if (!folder_tree_root) {
-        printf("list_set_folder_root: No folder tree, using default sort\n");
+        LOG_DEBUG("list_set_folder_root: No folder tree, using default sort\n");
         list_set_sort_default();
+        PROF_END(LIST);
         return;
     }
 
-    printf("list_set_folder_root: Building folder view, root has %d children and %d games\n",
-           folder_tree_root->num_children, folder_tree_root->num_games);
+    LOG_DEBUG("list_set_folder_root: Building folder view, root has %d children and %d games\n",
+              folder_tree_root->num_children, folder_tree_root->num_games);
 
 #ifndef STANDALONE_BINARY
     int hide_multidisc = sf_multidisc[0];
@@ -982,7 +1296,7 @@ list_set_folder_root(void) {
         list_temp[temp_idx++] = game;
     }
 
-    printf("list_set_folder_root: Sorting %d items\n", temp_idx);
+    LOG_DEBUG("list_set_folder_root: Sorting %d items\n", temp_idx);
     qsort(list_temp, temp_idx, sizeof(gd_item*), folder_cmp);
 
     list_current = list_temp;
@@ -991,19 +1305,23 @@ list_set_folder_root(void) {
     folder_state.depth = 0;
     folder_state.path[0] = '\0';
 
-    printf("list_set_folder_root: Complete, %d items in list\n", temp_idx);
+    LOG_DEBUG("list_set_folder_root: Complete, %d items in list\n", temp_idx);
+    PROF_END(LIST);
 }
 
 void
 list_set_folder_path(const char* path) {
+    PROF_BEGIN(LIST);
     if (!folder_tree_root) {
         list_set_sort_default();
+        PROF_END(LIST);
         return;
     }
 
     folder_node_t* node = folder_find_by_path(folder_tree_root, path);
     if (!node) {
         list_set_folder_root();
+        PROF_END(LIST);
         return;
     }
 
@@ -1056,6 +1374,7 @@ list_set_folder_path(const char* path) {
 
     list_current = list_temp;
     num_items_current = num_items_temp = temp_idx;
+    PROF_END(LIST);
 }
 
 void
@@ -1182,12 +1501,299 @@ list_folder_is_root(void) {
 
 void
 list_folder_destroy(void) {
-    if (folder_tree_root) {
-        folder_tree_destroy_recursive(folder_tree_root);
-        folder_tree_root = NULL;
-    }
+    /* Nodes and their games arrays all come from the one arena */
+    arena_reset(ARENA_FOLDERS);
+    folder_tree_root = NULL;
 
     folder_state.depth = 0;
     folder_state.path[0] = '\0';
     folder_items_count = 0;
+    folder_tree_from_bin = 0;
 }
+
+#ifdef STANDALONE_BINARY
+/* OPENMENU.BIN writer, host only (menucompile) */
+
+typedef struct gd_bin_str {
+    char* key;
+    uint32_t offset;
+    UT_hash_handle hh;
+} gd_bin_str;
+
+typedef struct gd_bin_writer {
+    char* pool;
+    uint32_t pool_size;
+    uint32_t pool_capacity;
+    gd_bin_str* strings;
+    gd_bin_node* nodes;
+    uint32_t num_nodes;
+    uint32_t* folder_games;
+    uint32_t num_folder_games;
+} gd_bin_writer;
+
+/* Each distinct string lands in the pool once */
+static uint32_t
+gd_bin_intern(gd_bin_writer* w, const char* str, size_t len) {
+    char key[512];
+    gd_bin_str* entry;
+
+    len = (len < sizeof(key) - 1) ? len : sizeof(key) - 1;
+    memcpy(key, str, len);
+    key[len] = '\0';
+
+    HASH_FIND(hh, w->strings, key, len, entry);
+    if (entry) {
+        return entry->offset;
+    }
+
+    if (w->pool_size + len + 1 > w->pool_capacity) {
+        uint32_t capacity = w->pool_capacity ? w->pool_capacity * 2 : 64 * 1024;
+        while (w->pool_size + len + 1 > capacity) {
+            capacity *= 2;
+        }
+        char* pool = realloc(w->pool, capacity);
+        if (!pool) {
+            LOG_ERROR("%s no free memory\n", __func__);
+            return 0;
+        }
+        w->pool = pool;
+        w->pool_capacity = capacity;
+    }
+    entry = malloc(sizeof(gd_bin_str));
+    if (!entry || !(entry->key = strdup(key))) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        free(entry);
+        return 0;
+    }
+    entry->offset = w->pool_size;
+    memcpy(w->pool + w->pool_size, key, len + 1);
+    w->pool_size += (uint32_t)len + 1;
+    /* The pool moves as it grows, the table keeps its own copy of the key */
+    HASH_ADD_KEYPTR(hh, w->strings, entry->key, len, entry);
+    return entry->offset;
+}
+
+static int
+gd_bin_add_node(gd_bin_writer* w, const folder_node_t* node, uint32_t parent) {
+    const uint32_t idx = w->num_nodes++;
+    gd_bin_node* bn = &w->nodes[idx];
+
+    bn->name = gd_bin_intern(w, node->name, strlen(node->name));
+    bn->parent = parent;
+    bn->first_seen_slot = node->first_seen_slot;
+    bn->games_start = w->num_folder_games;
+    bn->num_games = node->num_games;
+
+    uint32_t* games = realloc(w->folder_games, (w->num_folder_games + node->num_games + 1) * sizeof(uint32_t));
+    if (!games) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        return -1;
+    }
+    w->folder_games = games;
+    for (int i = 0; i < node->num_games; i++) {
+        w->folder_games[w->num_folder_games++] = (uint32_t)(node->games[i] - gd_slots_BASE);
+    }
+
+    for (int i = 0; i < node->num_children; i++) {
+        if (gd_bin_add_node(w, node->children[i], idx)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static uint32_t
+gd_bin_count_nodes(const folder_node_t* node) {
+    uint32_t count = 1;
+    for (int i = 0; i < node->num_children; i++) {
+        count += gd_bin_count_nodes(node->children[i]);
+    }
+    return count;
+}
+
+static int
+gd_bin_cmp_name(const void* a, const void* b) {
+    const uint32_t ia = *(const uint32_t*)a;
+    const uint32_t ib = *(const uint32_t*)b;
+    const int ret = strcasecmp(gd_slots_BASE[ia].name, gd_slots_BASE[ib].name);
+    return ret ? ret : (ia > ib) - (ia < ib);
+}
+
+static int
+gd_bin_cmp_region(const void* a, const void* b) {
+    const uint32_t ia = *(const uint32_t*)a;
+    const uint32_t ib = *(const uint32_t*)b;
+    const int ret = strcmp(gd_slots_BASE[ia].region, gd_slots_BASE[ib].region);
+    return ret ? ret : (ia > ib) - (ia < ib);
+}
+
+static void
+gd_bin_set_facets(uint32_t* facets, uint32_t words, uint32_t idx) {
+    const gd_item* item = &gd_slots_BASE[idx];
+    const uint32_t bit = 1u << (idx & 31);
+    uint32_t* column = facets + (idx >> 5);
+
+    /* Same tests as list_set_sort_filter */
+    if (!strcmp(item->region, "J")) {
+        column[GD_FACET_REGION_J * words] |= bit;
+    }
+    if (!strcmp(item->region, "U")) {
+        column[GD_FACET_REGION_U * words] |= bit;
+    }
+    if (!strcmp(item->region, "E")) {
+        column[GD_FACET_REGION_E * words] |= bit;
+    }
+    if (!strncmp(item->region, "JUE", 3)) {
+        column[GD_FACET_REGION_JUE * words] |= bit;
+    }
+    if (!isalpha((int)item->name[0])) {
+        column[GD_FACET_LETTER * words] |= bit;
+    }
+    for (int num = 1; num < 27; num++) {
+        if (toupper(item->name[0]) == (num + '@')) {
+            column[(GD_FACET_LETTER + num) * words] |= bit;
+        }
+    }
+
+    int disc_num = gd_item_disc_num(item->disc);
+    int disc_set = gd_item_disc_total(item->disc);
+    if (disc_num > 1 && disc_set > 1 && item->product[0] != '\0') {
+        column[GD_FACET_MULTIDISC * words] |= bit;
+    }
+}
+
+static void
+gd_bin_write_section(FILE* fd, uint32_t* offset, const void* data, size_t size) {
+    static const char zero[4] = {0};
+    fwrite(data, size, 1, fd);
+    *offset += (uint32_t)size;
+    if (*offset & 3) {
+        fwrite(zero, 4 - (*offset & 3), 1, fd);
+        *offset = (*offset + 3) & ~3u;
+    }
+}
+
+int
+list_write_bin(const char* bin_filename, const char* ini_filename) {
+    gd_bin_writer w;
+    gd_bin_header hdr;
+    size_t ini_size;
+    int ret = -1;
+
+    if (!gd_slots_BASE || num_items_BASE < 1) {
+        LOG_ERROR("INI:Error no list loaded\n");
+        return -1;
+    }
+    if (!folder_tree_root) {
+        list_folder_init();
+    }
+
+    char* ini_buffer = list_load_file(ini_filename, &ini_size);
+    if (!ini_buffer) {
+        LOG_ERROR("INI:Error opening %s!\n", ini_filename);
+        return -1;
+    }
+
+    memset(&w, 0, sizeof(w));
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, GD_BIN_MAGIC, 4);
+    hdr.version = GD_BIN_VERSION;
+    hdr.ini_hash = gd_bin_hash(ini_buffer, ini_size);
+    hdr.ini_size = (uint32_t)ini_size;
+    hdr.num_items = (uint32_t)num_items_BASE;
+    hdr.num_fields = GD_BIN_NUM_FIELDS;
+    hdr.num_facets = GD_FACET_COUNT;
+    hdr.facet_words = (hdr.num_items + 31) / 32;
+    free(ini_buffer);
+
+    const uint32_t num_sorted = hdr.num_items - 1;
+    gd_bin_item* items = calloc(hdr.num_items, sizeof(gd_bin_item));
+    uint32_t* perm_name = malloc((num_sorted + 1) * sizeof(uint32_t));
+    uint32_t* perm_region = malloc((num_sorted + 1) * sizeof(uint32_t));
+    uint32_t* facets = calloc(GD_FACET_COUNT * hdr.facet_words, sizeof(uint32_t));
+    w.nodes = calloc(folder_tree_root ? gd_bin_count_nodes(folder_tree_root) : 1, sizeof(gd_bin_node));
+    if (!items || !perm_name || !perm_region || !facets || !w.nodes) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        goto done;
+    }
+
+    /* Offset 0 is the empty string */
+    gd_bin_intern(&w, "", 0);
+    for (uint32_t i = 0; i < hdr.num_items; i++) {
+        const gd_item* item = &gd_slots_BASE[i];
+        items[i].slot_num = item->slot_num;
+        for (int f = 0; f < GD_BIN_NUM_FIELDS; f++) {
+            const char* value = (const char*)item + gd_fields[f].offset;
+            items[i].str[f] = gd_bin_intern(&w, value, strnlen(value, gd_fields[f].size));
+        }
+        if (i) {
+            perm_name[i - 1] = perm_region[i - 1] = i;
+            gd_bin_set_facets(facets, hdr.facet_words, i);
+        }
+    }
+    qsort(perm_name, num_sorted, sizeof(uint32_t), gd_bin_cmp_name);
+    qsort(perm_region, num_sorted, sizeof(uint32_t), gd_bin_cmp_region);
+
+    if (folder_tree_root) {
+        if (gd_bin_add_node(&w, folder_tree_root, 0)) {
+            goto done;
+        }
+    } else {
+        /* Empty root so the loader always has a tree */
+        w.num_nodes = 1;
+    }
+
+    hdr.num_nodes = w.num_nodes;
+    hdr.num_folder_games = w.num_folder_games;
+    hdr.pool_size = w.pool_size;
+
+    FILE* fd = fopen(bin_filename, "wb");
+    if (!fd) {
+        LOG_ERROR("INI:Error cant write %s!\n", bin_filename);
+        goto done;
+    }
+    uint32_t offset = 0;
+    gd_bin_write_section(fd, &offset, &hdr, sizeof(hdr));
+    hdr.items_offset = offset;
+    gd_bin_write_section(fd, &offset, items, hdr.num_items * sizeof(gd_bin_item));
+    hdr.nodes_offset = offset;
+    gd_bin_write_section(fd, &offset, w.nodes, hdr.num_nodes * sizeof(gd_bin_node));
+    hdr.folder_games_offset = offset;
+    gd_bin_write_section(fd, &offset, w.folder_games ? (void*)w.folder_games : (void*)"", hdr.num_folder_games * sizeof(uint32_t));
+    hdr.perm_name_offset = offset;
+    gd_bin_write_section(fd, &offset, perm_name, num_sorted * sizeof(uint32_t));
+    hdr.perm_region_offset = offset;
+    gd_bin_write_section(fd, &offset, perm_region, num_sorted * sizeof(uint32_t));
+    hdr.facets_offset = offset;
+    gd_bin_write_section(fd, &offset, facets, GD_FACET_COUNT * hdr.facet_words * sizeof(uint32_t));
+    hdr.pool_offset = offset;
+    gd_bin_write_section(fd, &offset, w.pool, w.pool_size);
+
+    /* Offsets are only known now */
+    fseek(fd, 0, SEEK_SET);
+    fwrite(&hdr, sizeof(hdr), 1, fd);
+    fclose(fd);
+
+    LOG_INFO("INI:Wrote %s (%u items, %u folders, %u bytes of strings, %u bytes)\n", bin_filename, hdr.num_items,
+             hdr.num_nodes - 1, hdr.pool_size, offset);
+    ret = 0;
+
+done:
+    {
+        gd_bin_str *entry, *tmp;
+        HASH_ITER(hh, w.strings, entry, tmp) {
+            HASH_DEL(w.strings, entry);
+            free(entry->key);
+            free(entry);
+        }
+    }
+    free(w.pool);
+    free(w.nodes);
+    free(w.folder_games);
+    free(items);
+    free(perm_name);
+    free(perm_region);
+    free(facets);
+    return ret;
+}
+#endif
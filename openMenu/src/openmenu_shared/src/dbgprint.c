@@ -0,0 +1,134 @@
+/*
+ * File: dbgprint.c
+ * Project: openmenu_shared
+ * File Created: Monday, 19th October 2026 5:20:04 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "dbgprint.h"
+
+#if LOG_BUFFERED
+
+/* Writers take a ticket and own ring[ticket] until they publish it by
+ * setting seq to ticket + 1. seq is 0 while the text is being written, so a
+ * flush that raced a writer wrapping onto the same slot can tell its copy is
+ * torn. Nothing ever blocks a writer */
+typedef struct log_entry {
+    uint32_t seq;
+    char text[LOG_ENTRY_SIZE];
+} log_entry;
+
+static log_entry ring[LOG_RING_ENTRIES];
+static uint32_t ring_head = 0; /* next ticket to hand out */
+static uint32_t ring_tail = 0; /* next ticket to write out, only touched while draining */
+static uint32_t draining = 0;
+static unsigned int dropped = 0;
+static unsigned int dropped_reported = 0;
+
+void
+log_write(int level, const char* fmt, ...) {
+    const uint32_t ticket = __atomic_fetch_add(&ring_head, 1, __ATOMIC_RELAXED);
+    log_entry* entry = &ring[ticket & (LOG_RING_ENTRIES - 1)];
+
+    __atomic_store_n(&entry->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    va_list args;
+    va_start(args, fmt);
+    const int len = vsnprintf(entry->text, sizeof(entry->text), fmt, args);
+    va_end(args);
+    if (len >= (int)sizeof(entry->text)) {
+        memcpy(entry->text + sizeof(entry->text) - 5, "...\n", 5);
+    }
+
+    __atomic_store_n(&entry->seq, ticket + 1, __ATOMIC_RELEASE);
+
+    if (level == LOG_LEVEL_ERROR) {
+        log_flush();
+    }
+}
+
+void
+log_flush(void) {
+    /* One drainer at a time, anyone else finds their messages gone out on
+     * the next flush */
+    if (__atomic_exchange_n(&draining, 1, __ATOMIC_ACQUIRE)) {
+        return;
+    }
+
+    const uint32_t head = __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE);
+    if (head - ring_tail > LOG_RING_ENTRIES) {
+        dropped += head - ring_tail - LOG_RING_ENTRIES;
+        ring_tail = head - LOG_RING_ENTRIES;
+    }
+
+    char text[LOG_ENTRY_SIZE];
+    while (ring_tail != head) {
+        const log_entry* entry = &ring[ring_tail & (LOG_RING_ENTRIES - 1)];
+        const uint32_t seq = __atomic_load_n(&entry->seq, __ATOMIC_ACQUIRE);
+        if (seq != ring_tail + 1) {
+            if (seq && (int32_t)(seq - (ring_tail + 1)) > 0) {
+                /* Lapped by a newer message while we got here */
+                dropped++;
+                ring_tail++;
+                continue;
+            }
+            /* Still being written, picked up next flush */
+            break;
+        }
+        memcpy(text, entry->text, sizeof(text));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&entry->seq, __ATOMIC_RELAXED) != seq) {
+            dropped++;
+        } else {
+            fputs(text, stdout);
+        }
+        ring_tail++;
+    }
+
+    if (dropped != dropped_reported) {
+        printf("LOG:dropped %u messages\n", dropped - dropped_reported);
+        dropped_reported = dropped;
+    }
+    fflush(stdout);
+
+    __atomic_store_n(&draining, 0, __ATOMIC_RELEASE);
+}
+
+unsigned int
+log_dropped(void) {
+    return dropped;
+}
+
+#else
+
+void
+log_write(int level, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+
+    if (level == LOG_LEVEL_ERROR) {
+        fflush(stdout);
+    }
+}
+
+void
+log_flush(void) {
+    fflush(stdout);
+}
+
+unsigned int
+log_dropped(void) {
+    return 0;
+}
+
+#endif /* LOG_BUFFERED */
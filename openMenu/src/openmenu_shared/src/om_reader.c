@@ -0,0 +1,259 @@
+/*
+ * File: om_reader.c
+ * Project: openmenu_shared
+ * File Created: Monday, 19th October 2026 6:02:11 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#if defined(STANDALONE_BINARY) && !defined(_WIN32)
+#include <dirent.h>
+#include <strings.h>
+#endif
+
+#include "dbgprint.h"
+#include "om_reader.h"
+
+static om_reader_stats stats;
+
+#ifdef STANDALONE_BINARY
+static char cd_root[FILENAME_MAX];
+
+void
+om_file_set_cd_root(const char* root) {
+    snprintf(cd_root, sizeof(cd_root), "%s", root ? root : "");
+}
+
+const char*
+om_file_host_path(const char* path, char* buf, size_t size) {
+    if (!cd_root[0] || strncmp(path, "/cd/", 4)) {
+        return path;
+    }
+    int len = snprintf(buf, size, "%s", cd_root);
+#ifndef _WIN32
+    /* Walk down one part at a time taking whatever case the host has */
+    const char* part = path + 4;
+    while (*part && len > 0 && (size_t)len < size) {
+        const char* end = strchr(part, '/');
+        const size_t part_len = end ? (size_t)(end - part) : strlen(part);
+        const char* name = NULL;
+        DIR* dir = opendir(buf);
+        struct dirent* entry;
+        while (dir && (entry = readdir(dir))) {
+            if (strlen(entry->d_name) == part_len && !strncasecmp(entry->d_name, part, part_len)) {
+                name = entry->d_name;
+                break;
+            }
+        }
+        len += name ? snprintf(buf + len, size - len, "/%s", name)
+                    : snprintf(buf + len, size - len, "/%.*s", (int)part_len, part);
+        if (dir) {
+            closedir(dir);
+        }
+        part += part_len + (end ? 1 : 0);
+    }
+#else
+    snprintf(buf + len, size - len, "/%s", path + 4);
+#endif
+    return buf;
+}
+#endif
+
+om_file
+om_file_open(const char* path) {
+    stats.opens++;
+#ifndef STANDALONE_BINARY
+    return fs_open(path, O_RDONLY);
+#else
+    char host_path[FILENAME_MAX];
+    return fopen(om_file_host_path(path, host_path, sizeof(host_path)), "rb");
+#endif
+}
+
+void
+om_file_close(om_file file) {
+#ifndef STANDALONE_BINARY
+    fs_close(file);
+#else
+    fclose(file);
+#endif
+}
+
+size_t
+om_file_size(om_file file) {
+#ifndef STANDALONE_BINARY
+    return fs_total(file);
+#else
+    const long pos = ftell(file);
+    fseek(file, 0, SEEK_END);
+    const long end = ftell(file);
+    fseek(file, pos, SEEK_SET);
+    return (end > 0) ? (size_t)end : 0;
+#endif
+}
+
+size_t
+om_file_read_at(om_file file, uint32_t offset, void* dst, size_t size) {
+    stats.seeks++;
+    stats.reads++;
+#ifndef STANDALONE_BINARY
+    fs_seek(file, offset, SEEK_SET);
+    const ssize_t ret = fs_read(file, dst, size);
+    const size_t got = (ret > 0) ? (size_t)ret : 0;
+#else
+    fseek(file, offset, SEEK_SET);
+    const size_t got = fread(dst, 1, size, file);
+#endif
+    stats.bytes += got;
+    return got;
+}
+
+void*
+om_read_file(const char* path, size_t* size, om_alloc_fn alloc) {
+    om_file file = om_file_open(path);
+    if (file == OM_FILE_INVALID) {
+        return NULL;
+    }
+
+    const size_t len = om_file_size(file);
+    char* buffer = (alloc ? alloc : malloc)(len + 1);
+    if (!buffer) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        om_file_close(file);
+        return NULL;
+    }
+    const size_t got = len ? om_file_read_at(file, 0, buffer, len) : 0;
+    buffer[got] = '\0';
+    om_file_close(file);
+
+    if (size) {
+        *size = got;
+    }
+    return buffer;
+}
+
+int
+om_reader_attach(om_reader* reader, om_file handle, uint32_t offset) {
+    memset(reader, 0, sizeof(om_reader));
+    reader->buf_alloc = malloc(OM_READER_BUF_SIZE + OM_READER_ALIGN - 1);
+    if (!reader->buf_alloc) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        return 1;
+    }
+    reader->buf = (uint8_t*)(((uintptr_t)reader->buf_alloc + OM_READER_ALIGN - 1) & ~(uintptr_t)(OM_READER_ALIGN - 1));
+    reader->handle = handle;
+    reader->buf_offset = offset;
+    return 0;
+}
+
+int
+om_reader_open(om_reader* reader, const char* path) {
+    om_file file = om_file_open(path);
+    if (file == OM_FILE_INVALID) {
+        memset(reader, 0, sizeof(om_reader));
+        return 1;
+    }
+    if (om_reader_attach(reader, file, 0)) {
+        om_file_close(file);
+        return 1;
+    }
+    reader->owns_handle = 1;
+    return 0;
+}
+
+void
+om_reader_close(om_reader* reader) {
+    if (reader->owns_handle) {
+        om_file_close(reader->handle);
+    }
+    free(reader->buf_alloc);
+    memset(reader, 0, sizeof(om_reader));
+}
+
+/* Moves what is left to the front and reads up to the last sector boundary
+ * that fits while still giving at least need bytes, returns bytes available */
+static size_t
+om_reader_fill(om_reader* reader, size_t need) {
+    const size_t left = reader->buf_len - reader->buf_pos;
+    if (left && reader->buf_pos) {
+        memmove(reader->buf, reader->buf + reader->buf_pos, left);
+    }
+    reader->buf_offset += reader->buf_pos;
+    reader->buf_pos = 0;
+    reader->buf_len = left;
+
+    const uint32_t end = reader->buf_offset + left;
+    size_t want = OM_READER_BUF_SIZE - left;
+    const size_t trim = (end + want) & (OM_READER_SECTOR - 1);
+    if (trim < want && left + want - trim >= need) {
+        want -= trim;
+    }
+    reader->buf_len += om_file_read_at(reader->handle, end, reader->buf + left, want);
+    return reader->buf_len;
+}
+
+size_t
+om_reader_read(om_reader* reader, void* dst, size_t size) {
+    uint8_t* out = dst;
+    size_t done = 0;
+
+    while (done < size) {
+        size_t avail = reader->buf_len - reader->buf_pos;
+        if (!avail) {
+            /* Big reads skip the buffer */
+            if (size - done >= OM_READER_BUF_SIZE) {
+                const size_t got = om_file_read_at(reader->handle, reader->buf_offset + reader->buf_pos, out + done,
+                                                   size - done);
+                reader->buf_offset += reader->buf_pos + got;
+                reader->buf_pos = reader->buf_len = 0;
+                return done + got;
+            }
+            avail = om_reader_fill(reader, 1);
+            if (!avail) {
+                break;
+            }
+        }
+        const size_t chunk = (size - done < avail) ? size - done : avail;
+        memcpy(out + done, reader->buf + reader->buf_pos, chunk);
+        reader->buf_pos += chunk;
+        done += chunk;
+    }
+    return done;
+}
+
+const void*
+om_reader_peek(om_reader* reader, size_t size) {
+    if (size > OM_READER_BUF_SIZE) {
+        return NULL;
+    }
+    if (reader->buf_len - reader->buf_pos < size && om_reader_fill(reader, size) < size) {
+        return NULL;
+    }
+    return reader->buf + reader->buf_pos;
+}
+
+void
+om_reader_skip(om_reader* reader, size_t size) {
+    const size_t avail = reader->buf_len - reader->buf_pos;
+    if (size <= avail) {
+        reader->buf_pos += size;
+        return;
+    }
+    /* Past the buffer, just drop it and start again further on */
+    reader->buf_offset += reader->buf_pos + size;
+    reader->buf_pos = reader->buf_len = 0;
+}
+
+uint32_t
+om_reader_tell(const om_reader* reader) {
+    return reader->buf_offset + reader->buf_pos;
+}
+
+const om_reader_stats*
+om_reader_get_stats(void) {
+    return &stats;
+}
@@ -0,0 +1,167 @@
+/*
+ * File: profiler.c
+ * Project: openmenu_shared
+ * File Created: Monday, 19th October 2026 3:02:48 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <string.h>
+
+#ifdef _arch_dreamcast
+#include <arch/timer.h>
+#else
+#include <time.h>
+#endif
+
+#include "profiler.h"
+
+static uint64_t
+prof_clock_us(void) {
+#ifdef _arch_dreamcast
+    return timer_us_gettime64();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+#endif
+}
+
+uint32_t
+prof_now_us(void) {
+    static uint64_t epoch = 0;
+    if (!epoch) {
+        epoch = prof_clock_us();
+    }
+    return (uint32_t)(prof_clock_us() - epoch);
+}
+
+#if PROFILER
+
+static const char* timer_names[PROF_NUM_TIMERS] = {
+#define PROF_TIMER(id, name) name,
+#define PROF_COUNTER(id, name)
+#include "profiler.def"
+};
+
+static const char* counter_names[PROF_NUM_COUNTERS] = {
+#define PROF_TIMER(id, name)
+#define PROF_COUNTER(id, name) name,
+#include "profiler.def"
+};
+
+static prof_frame frames[PROF_FRAMES];
+static prof_frame current;
+static uint32_t num_frames = 0; /* completed, frames[num_frames % PROF_FRAMES] is next */
+static uint32_t frame_start_us = 0;
+
+/* Timers can nest into themselves, list_set_genre_sort calling list_set_genre,
+ * only the outermost pair counts */
+static uint32_t timer_start_us[PROF_NUM_TIMERS];
+static uint8_t timer_depth[PROF_NUM_TIMERS];
+
+static prof_mark marks[PROF_MARKS];
+static uint32_t num_marks = 0;
+
+void
+prof_begin(PROF_TIMER_ID id) {
+    if (!timer_depth[id]++) {
+        timer_start_us[id] = prof_now_us();
+    }
+}
+
+void
+prof_end(PROF_TIMER_ID id) {
+    if (timer_depth[id] && !--timer_depth[id]) {
+        current.timer_us[id] += prof_now_us() - timer_start_us[id];
+    }
+}
+
+void
+prof_count(PROF_COUNTER_ID id, uint32_t n) {
+    const uint32_t sum = current.counter[id] + n;
+    current.counter[id] = (sum < UINT16_MAX) ? sum : UINT16_MAX;
+}
+
+void
+prof_mark_add(const char* name, uint32_t start_us, uint32_t end_us) {
+    prof_mark* mark = &marks[num_marks++ % PROF_MARKS];
+    mark->name = name;
+    mark->start_us = start_us;
+    mark->end_us = end_us;
+}
+
+void
+prof_frame_end(void) {
+    const uint32_t now = prof_now_us();
+
+    /* The frame timer is wall time from one frame_end to the next */
+    if (frame_start_us) {
+        current.timer_us[PROF_FRAME] = now - frame_start_us;
+        if (current.timer_us[PROF_FRAME] > PROF_HITCH_US) {
+            prof_mark_add("hitch", frame_start_us, now);
+        }
+    }
+    frame_start_us = now;
+
+    current.frame = num_frames;
+    frames[num_frames++ % PROF_FRAMES] = current;
+    memset(&current, 0, sizeof(current));
+}
+
+const char*
+prof_timer_name(PROF_TIMER_ID id) {
+    return timer_names[id];
+}
+
+const char*
+prof_counter_name(PROF_COUNTER_ID id) {
+    return counter_names[id];
+}
+
+const prof_frame*
+prof_get_frame(int ago) {
+    if (ago < 0 || (uint32_t)ago >= num_frames || ago >= PROF_FRAMES) {
+        return NULL;
+    }
+    return &frames[(num_frames - 1 - ago) % PROF_FRAMES];
+}
+
+void
+prof_dump(FILE* out) {
+    fprintf(out, "PROF:marks\nname,start_us,end_us,duration_us\n");
+    const uint32_t first_mark = (num_marks > PROF_MARKS) ? num_marks - PROF_MARKS : 0;
+    for (uint32_t i = first_mark; i < num_marks; i++) {
+        const prof_mark* mark = &marks[i % PROF_MARKS];
+        fprintf(out, "%s,%lu,%lu,%lu\n", mark->name, (unsigned long)mark->start_us, (unsigned long)mark->end_us,
+                (unsigned long)(mark->end_us - mark->start_us));
+    }
+
+    fprintf(out, "PROF:frames\nframe");
+    for (int i = 0; i < PROF_NUM_TIMERS; i++) {
+        fprintf(out, ",%s_us", timer_names[i]);
+    }
+    for (int i = 0; i < PROF_NUM_COUNTERS; i++) {
+        fprintf(out, ",%s", counter_names[i]);
+    }
+    fprintf(out, "\n");
+    for (int ago = PROF_FRAMES - 1; ago >= 0; ago--) {
+        const prof_frame* frame = prof_get_frame(ago);
+        if (!frame) {
+            continue;
+        }
+        fprintf(out, "%lu", (unsigned long)frame->frame);
+        for (int i = 0; i < PROF_NUM_TIMERS; i++) {
+            fprintf(out, ",%lu", (unsigned long)frame->timer_us[i]);
+        }
+        for (int i = 0; i < PROF_NUM_COUNTERS; i++) {
+            fprintf(out, ",%u", (unsigned int)frame->counter[i]);
+        }
+        fprintf(out, "\n");
+    }
+    fflush(out);
+}
+
+#endif /* PROFILER */
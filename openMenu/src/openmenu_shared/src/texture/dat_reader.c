@@ -14,19 +14,16 @@
 
 #include <uthash.h>
 
+#include <arena.h>
 #include <backend/dat_format.h>
+#include <om_reader.h>
 
-/* Define configure constants */
-/* only defined when building the binary tool */
+/* DAT_info dumps are only wanted from the binary tools */
 #ifdef STANDALONE_BINARY
-#define DEBUG
-#endif
-
-#ifdef DEBUG
-#define DBG_PRINT(...) printf(__VA_ARGS__)
-#else
-#define DBG_PRINT(...)
+#define LOG_LEVEL_DAT LOG_LEVEL_DEBUG
 #endif
+#define LOG_MODULE DAT
+#include <dbgprint.h>
 
 typedef struct bin_item_raw {
     char ID[12];
@@ -40,84 +37,81 @@ DAT_init(dat_file* bin) {
 }
 
 int
-DAT_load_parse(dat_file* bin, const char* path) {
-#ifndef STANDALONE_BINARY
-    file_t bin_fd;
-#else
-    FILE* bin_fd;
-#endif
+DAT_load_parse(dat_file* bin, const char* path, uint32_t max_version) {
     bin_header file_header;
+    om_reader reader;
 
 #ifdef STANDALONE_BINARY
-    bin_fd = fopen(path, "rb");
     const char* filename_safe = path;
 #else
     char filename_safe[128];
     snprintf(filename_safe, 127, "/cd/%s", path);
-
-    bin_fd = fs_open(filename_safe, O_RDONLY);
 #endif
 
-#ifndef STANDALONE_BINARY
-    if (bin_fd == -1)
-#else
-    if (!bin_fd)
-#endif
-    {
-        printf("DAT:Error Cant read input %s!\n", filename_safe);
+    om_file bin_fd = om_file_open(filename_safe);
+    if (bin_fd == OM_FILE_INVALID) {
+        LOG_ERROR("DAT:Error Cant read input %s!\n", filename_safe);
         return 1;
     }
 
-    printf("DAT:Open %s (%s)\n", filename_safe, path);
+    LOG_INFO("DAT:Open %s (%s)\n", filename_safe, path);
 
-#ifndef STANDALONE_BINARY
-    fs_read(bin_fd, &file_header, sizeof(bin_header));
-#else
-    fread(&file_header, sizeof(bin_header), 1, bin_fd);
-#endif
-    if (file_header.magic.rich.version != 1) {
-        printf("DAT:Error Incorrect input file format!\n");
+    /* The index is 16 bytes a record, read ahead instead of once per record */
+    if (om_reader_attach(&reader, bin_fd, 0)) {
+        om_file_close(bin_fd);
+        return 1;
+    }
+    if (om_reader_read(&reader, &file_header, sizeof(bin_header)) != sizeof(bin_header)
+        || file_header.magic.rich.version < 1 || (uint32_t)file_header.magic.rich.version > max_version) {
+        LOG_ERROR("DAT:Error Incorrect input file format!\n");
+        om_reader_close(&reader);
+        om_file_close(bin_fd);
         return 1;
     }
 
     /* setup basic bin file info */
+    bin->version = (uint32_t)file_header.magic.rich.version;
     bin->chunk_size = file_header.chunk_size;
     bin->num_chunks = file_header.num_chunks;
     bin->handle = bin_fd;
-    bin->items = malloc(bin->num_chunks * sizeof(bin_item));
+    /* Indexes are kept for as long as the menu runs */
+    bin->items = arena_alloc(ARENA_DAT, bin->num_chunks * sizeof(bin_item));
     if (!bin->items) {
-        printf("%s no free memory\n", __func__);
+        LOG_ERROR("%s no free memory\n", __func__);
+        om_reader_close(&reader);
+        om_file_close(bin_fd);
+        bin->handle = OM_FILE_INVALID;
         return 1;
     }
     bin->hash = NULL;
 
     /* Parse file table to Hash table */
     for (unsigned int i = 0; i < file_header.num_chunks; i++) {
-#ifndef STANDALONE_BINARY
-        fs_read(bin->handle, &bin->items[i], sizeof(bin_item_raw));
-#else
-        fread(&bin->items[i], sizeof(bin_item_raw), 1, bin->handle);
-#endif
+        if (om_reader_read(&reader, &bin->items[i], sizeof(bin_item_raw)) != sizeof(bin_item_raw)) {
+            LOG_ERROR("DAT:Error index ends at record %u of %u!\n", i, file_header.num_chunks);
+            HASH_CLEAR(hh, bin->hash);
+            bin->num_chunks = 0;
+            om_reader_close(&reader);
+            om_file_close(bin_fd);
+            bin->handle = OM_FILE_INVALID;
+            return 1;
+        }
         HASH_ADD_STR(bin->hash, ID, &bin->items[i]);
     }
 
-    /* Leave our handle in a handy place in case we need to read after */
-#ifndef STANDALONE_BINARY
-    fs_seek(bin->handle, bin->items[0].offset * bin->chunk_size, SEEK_SET);
-#else
-    fseek(bin->handle, bin->items[0].offset * bin->chunk_size, SEEK_SET);
-#endif
+    /* Chunks are read by offset, the handle stays open for them */
+    om_reader_close(&reader);
     return 0;
 }
 
 void
 DAT_info(const dat_file* bin) {
-    DBG_PRINT("DAT:Stats\nChunk Size: %u\nNum Chunks: %u\n\n", bin->chunk_size, bin->num_chunks);
+    LOG_DEBUG("DAT:Stats\nChunk Size: %u\nNum Chunks: %u\n\n", bin->chunk_size, bin->num_chunks);
     for (unsigned int i = 0; i < bin->num_chunks; i++) {
-        DBG_PRINT("Record[%u] %s at 0x%X\n", bin->items[i].offset, bin->items[i].ID,
+        LOG_DEBUG("Record[%u] %s at 0x%X\n", bin->items[i].offset, bin->items[i].ID,
                   (unsigned int)(bin->items[i].offset * bin->chunk_size));
     }
-    DBG_PRINT("\n");
+    LOG_DEBUG("\n");
 }
 
 uint32_t
@@ -154,13 +148,7 @@ int
 DAT_read_file_by_ID(const dat_file* bin, const char* ID, void* buf) {
     uint32_t offset = DAT_get_offset_by_ID(bin, ID);
     if (offset) {
-#ifndef STANDALONE_BINARY
-        fs_seek(bin->handle, offset, SEEK_SET);
-        fs_read(bin->handle, buf, bin->chunk_size);
-#else
-        fseek(bin->handle, offset, SEEK_SET);
-        fread(buf, bin->chunk_size, 1, bin->handle);
-#endif
+        om_file_read_at(bin->handle, offset, buf, bin->chunk_size);
         return 1;
     }
     return 0;
@@ -170,13 +158,7 @@ int
 DAT_read_file_by_num(const dat_file* bin, uint32_t chunk_num, void* buf) {
     uint32_t offset = chunk_num * bin->chunk_size;
     if (chunk_num <= bin->num_chunks) {
-#ifndef STANDALONE_BINARY
-        fs_seek(bin->handle, offset, SEEK_SET);
-        fs_read(bin->handle, buf, bin->chunk_size);
-#else
-        fseek(bin->handle, offset, SEEK_SET);
-        fread(buf, bin->chunk_size, 1, bin->handle);
-#endif
+        om_file_read_at(bin->handle, offset, buf, bin->chunk_size);
         return 1;
     }
     return 0;
@@ -0,0 +1,455 @@
+/*
+ * File: omf_font.c
+ * Project: texture
+ * File Created: Monday, 19th October 2026 11:02:37 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <arena.h>
+#include <dbgprint.h>
+#include <om_reader.h>
+#include <texture/omf_format.h>
+#include <texture/pvr_palette.h>
+
+#define PRINT_MEMBER(struct, member)                                                                                   \
+    do {                                                                                                               \
+        DBG_PRINT("%s: %d\n", #member, (int)((struct).member));                                                        \
+    } while (0)
+
+/* BMFont implementation */
+
+typedef struct bm_header {
+    char bmf[3];
+    uint8_t version;
+} bm_header;
+
+/* Binary font info structures */
+
+// Tag header for each block type
+typedef enum BM_BLOCK_TYPE { INFO = 1, COMMON, PAGES, CHARS, KERNING } BM_BLOCK_TYPE;
+
+typedef struct __attribute__((__packed__)) bm_block_tag {
+    uint8_t type;
+    uint32_t size;
+} bm_block_tag;
+
+// Block type 1: info
+typedef struct __attribute__((__packed__)) bm_info {
+    int16_t fontSize;
+    uint8_t bitField;
+    uint8_t charSet;
+    uint16_t stretchH;
+    uint8_t aa;
+    uint8_t paddingUp;
+    uint8_t paddingRight;
+    uint8_t paddingDown;
+    uint8_t paddingLeft;
+    uint8_t spacingHoriz;
+    uint8_t spacingVert;
+    uint8_t outline;
+    char fontName[64];
+    /* VLA, size of block length - 14, null terminated string with length n */ // 64 for fix allign in stack
+} bm_info;
+
+// Block type 2: common
+typedef struct __attribute__((__packed__)) bm_common {
+    uint16_t lineHeight;
+    uint16_t base;
+    uint16_t scaleW;
+    uint16_t scaleH;
+    uint16_t pages;
+    uint8_t bitField; // bits 0-6: reserved, bit 7: packed
+    uint8_t alphaChnl;
+    uint8_t redChnl;
+    uint8_t greenChnl;
+    uint8_t blueChnl;
+} bm_common;
+
+// Block type 4: chars
+typedef struct __attribute__((__packed__)) bm_char {
+    uint32_t id;
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    int16_t xoffset;
+    int16_t yoffset;
+    int16_t xadvance;
+    uint8_t page;
+    uint8_t chnl;
+} bm_char;
+
+// Block type 5: kerning pairs
+typedef struct __attribute__((__packed__)) bm_kern_pair {
+    uint32_t first;
+    uint32_t second;
+    int16_t amount;
+} bm_kern_pair;
+
+/* Texture position of each glyph until the texture size is known */
+typedef struct bm_parse {
+    uint16_t x[OMF_GLYPHS];
+    uint16_t y[OMF_GLYPHS];
+} bm_parse;
+
+/* Reads a block into a fixed struct, anything past it is skipped */
+static void
+BMF_read_block(om_reader* reader, size_t block_size, void* dst, size_t dst_size) {
+    const size_t len = (block_size < dst_size) ? block_size : dst_size;
+    om_reader_read(reader, dst, len);
+    om_reader_skip(reader, block_size - len);
+}
+
+static int
+BMF_parse_info(om_reader* reader, size_t block_size, omf_font* font) {
+    DBG_PRINT("BMF found info block!\n");
+    /* Unsure why youd want to have this around or on heap */
+    static bm_info temp_info;
+    BMF_read_block(reader, block_size, &temp_info, sizeof(temp_info));
+
+    /* Fix fontSize, its negative ? */
+    temp_info.fontSize *= -1;
+
+    font->font_size = temp_info.fontSize;
+
+    PRINT_MEMBER(temp_info, fontSize);
+    PRINT_MEMBER(temp_info, bitField);
+    PRINT_MEMBER(temp_info, charSet);
+    PRINT_MEMBER(temp_info, stretchH);
+    PRINT_MEMBER(temp_info, aa);
+    PRINT_MEMBER(temp_info, paddingUp);
+    PRINT_MEMBER(temp_info, paddingRight);
+    PRINT_MEMBER(temp_info, paddingDown);
+    PRINT_MEMBER(temp_info, paddingLeft);
+    PRINT_MEMBER(temp_info, spacingHoriz);
+    PRINT_MEMBER(temp_info, spacingVert);
+    PRINT_MEMBER(temp_info, outline);
+    DBG_PRINT("name: %s\n", temp_info.fontName);
+    DBG_PRINT("\n");
+
+    return 0;
+}
+
+static int
+BMF_parse_common(om_reader* reader, size_t block_size, omf_font* font) {
+    DBG_PRINT("BMF found common block!\n");
+    bm_common temp_common;
+    BMF_read_block(reader, block_size, &temp_common, sizeof(temp_common));
+
+    font->tex_width = temp_common.scaleW;
+    font->tex_height = temp_common.scaleH;
+    font->line_height = temp_common.lineHeight;
+
+    PRINT_MEMBER(temp_common, lineHeight);
+    PRINT_MEMBER(temp_common, base);
+    PRINT_MEMBER(temp_common, scaleW);
+    PRINT_MEMBER(temp_common, scaleH);
+    PRINT_MEMBER(temp_common, pages);
+    PRINT_MEMBER(temp_common, bitField);
+    PRINT_MEMBER(temp_common, alphaChnl);
+    PRINT_MEMBER(temp_common, redChnl);
+    PRINT_MEMBER(temp_common, greenChnl);
+    PRINT_MEMBER(temp_common, blueChnl);
+
+    DBG_PRINT("\n");
+    return 0;
+}
+
+static int
+BMF_parse_chars(om_reader* reader, size_t block_size, omf_font* font, bm_parse* parse) {
+    DBG_PRINT("BMF found char block!\n");
+
+    int num_chars = block_size / sizeof(bm_char);
+    bm_char temp_char;
+
+    DBG_PRINT("BMF %d chars present\n", num_chars);
+
+    /* One at a time to font charset, out of the read ahead buffer */
+    for (int i = 0; i < num_chars; i++) {
+        om_reader_read(reader, &temp_char, sizeof(bm_char));
+        if (temp_char.id < OMF_GLYPHS) {
+            /* Optionally print out info for each char parsed */
+#if defined(DBG_CHAR_INFO) && DBG_CHAR_INFO
+            char temp = (char)temp_char.id;
+            DBG_PRINT("Char: %c\n", temp);
+            PRINT_MEMBER(temp_char, id);
+            PRINT_MEMBER(temp_char, x);
+            PRINT_MEMBER(temp_char, y);
+            PRINT_MEMBER(temp_char, width);
+            PRINT_MEMBER(temp_char, height);
+            PRINT_MEMBER(temp_char, xoffset);
+            PRINT_MEMBER(temp_char, yoffset);
+            PRINT_MEMBER(temp_char, xadvance);
+            DBG_PRINT("\n");
+#endif
+
+            omf_glyph* glyph = &font->glyphs[temp_char.id];
+            glyph->xoffset = temp_char.xoffset;
+            glyph->yoffset = temp_char.yoffset;
+            glyph->xadvance = temp_char.xadvance;
+            glyph->width = temp_char.width;
+            glyph->height = temp_char.height;
+            parse->x[temp_char.id] = temp_char.x;
+            parse->y[temp_char.id] = temp_char.y;
+        }
+    }
+
+    DBG_PRINT("\n");
+    return 0;
+}
+
+static int
+_kern_pair_sort(const void* a, const void* b) {
+    const bm_kern_pair* ia = (const bm_kern_pair*)a;
+    const bm_kern_pair* ib = (const bm_kern_pair*)b;
+    if (ia->first == ib->first) {
+        return ia->second - ib->second;
+    }
+    return ia->first - ib->first;
+}
+
+static int
+BMF_parse_kerning(om_reader* reader, size_t block_size, omf_font* font) {
+    DBG_PRINT("BMF found kerning block!\n");
+
+    /* Parse and save */
+    int num_pairs = block_size / sizeof(bm_kern_pair);
+
+    DBG_PRINT("BMF %d kerning pairs present\n", num_pairs);
+
+    void* block = arena_alloc(ARENA_FONT, sizeof(bm_kern_pair) * num_pairs);
+    bm_kern_pair* pairs = block;
+    if (!block) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        return 0;
+    }
+    om_reader_read(reader, pairs, num_pairs * sizeof(bm_kern_pair));
+
+    /* Sort Kerning pairs */
+    qsort(pairs, num_pairs, sizeof(bm_kern_pair), _kern_pair_sort);
+
+    /* Compact in place to the pairs we can draw, each glyph gets the span of
+     * its pairs. omf_kern is smaller so the write never passes the read */
+    omf_kern* kerns = block;
+    int num_kerns = 0;
+    for (int i = 0; i < num_pairs; i++) {
+        const bm_kern_pair pair = pairs[i];
+
+        if (pair.first >= OMF_GLYPHS || pair.second >= OMF_GLYPHS) {
+            continue;
+        }
+        omf_glyph* glyph = &font->glyphs[pair.first];
+        if (!glyph->kern_count) {
+            glyph->kern_start = num_kerns;
+        }
+        glyph->kern_count++;
+        kerns[num_kerns].second = pair.second;
+        kerns[num_kerns].pad = 0;
+        kerns[num_kerns].amount = pair.amount;
+        num_kerns++;
+
+#if defined(DBG_KERN_INFO) && DBG_KERN_INFO
+        char first = (char)pair.first;
+        char second = (char)pair.second;
+        DBG_PRINT("First: %c\n", first);
+        DBG_PRINT("Second: %c\n", second);
+        DBG_PRINT("amount: %d\n", pair.amount);
+        DBG_PRINT("\n");
+#endif
+    }
+    font->kerns = arena_realloc(ARENA_FONT, block, sizeof(bm_kern_pair) * num_pairs, sizeof(omf_kern) * num_kerns);
+    font->num_kerns = num_kerns;
+
+    DBG_PRINT("\n");
+    return 0;
+}
+
+int
+omf_font_from_fnt(const char* path, omf_font* font) {
+    // Zero out
+    memset(font, '\0', sizeof(omf_font));
+
+    static bm_parse parse;
+    om_reader reader;
+    bool parsing = true;
+
+    memset(&parse, 0, sizeof(parse));
+
+    /* The whole font is a few KB, one read covers every block */
+    if (om_reader_open(&reader, path)) {
+        LOG_ERROR("BMF:Error file %s not found!\n", path);
+        return 1;
+    }
+
+    bm_header file_header;
+    if (om_reader_read(&reader, &file_header, sizeof(bm_header)) != sizeof(bm_header) || file_header.version != 3) {
+        om_reader_close(&reader);
+        LOG_ERROR("BMF:Error font magic wrong %.3s!\n", file_header.bmf);
+        return 1;
+    }
+
+    bm_block_tag next_block = {0, 0};
+    size_t ele_read;
+    while (parsing) {
+        ele_read = om_reader_read(&reader, &next_block, sizeof(bm_block_tag));
+        DBG_PRINT("Found block type %d of size %u\n", next_block.type, (unsigned int)next_block.size);
+
+        if (ele_read != sizeof(bm_block_tag)) {
+            break;
+        }
+
+        switch (next_block.type) {
+            case INFO: BMF_parse_info(&reader, next_block.size, font); break;
+            case COMMON: BMF_parse_common(&reader, next_block.size, font); break;
+            case CHARS: BMF_parse_chars(&reader, next_block.size, font, &parse); break;
+            case KERNING:
+                BMF_parse_kerning(&reader, next_block.size, font);
+                parsing = false; /* should be end of file */
+                break;
+            case PAGES:
+            default: om_reader_skip(&reader, next_block.size); break;
+        }
+    }
+
+    om_reader_close(&reader);
+
+    if (!font->tex_width || !font->tex_height) {
+        LOG_ERROR("BMF:Error %s has no common block!\n", path);
+        return 1;
+    }
+
+    /* Texture coords once, instead of per letter drawn */
+    for (int i = 0; i < OMF_GLYPHS; i++) {
+        omf_glyph* glyph = &font->glyphs[i];
+        glyph->u1 = (float)parse.x[i] / (float)font->tex_width;
+        glyph->v1 = (float)parse.y[i] / (float)font->tex_height;
+        glyph->u2 = (float)(parse.x[i] + glyph->width) / (float)font->tex_width;
+        glyph->v2 = (float)(parse.y[i] + glyph->height) / (float)font->tex_height;
+        glyph->uv_a = omf_pack_uv(glyph->u1, glyph->v1);
+        glyph->uv_b = omf_pack_uv(glyph->u2, glyph->v1);
+        glyph->uv_c = omf_pack_uv(glyph->u2, glyph->v2);
+    }
+
+    return 0;
+}
+
+int
+omf_font_from_blob(const void* blob, size_t size, omf_font* font, const void** pvr, size_t* pvr_size) {
+    const uint8_t* data = blob;
+    omf_header hdr;
+
+    if (size < sizeof(hdr)) {
+        return 1;
+    }
+    memcpy(&hdr, data, sizeof(hdr));
+    if (memcmp(hdr.magic, OMF_MAGIC, 4) || hdr.version != OMF_VERSION) {
+        LOG_ERROR("OMF:Error wrong magic or version %u\n", (unsigned int)hdr.version);
+        return 1;
+    }
+    if ((uint64_t)hdr.glyphs_offset + OMF_GLYPHS * sizeof(omf_glyph) > size
+        || (uint64_t)hdr.kerns_offset + hdr.num_kerns * sizeof(omf_kern) > size
+        || (uint64_t)hdr.texture_offset + hdr.texture_size > size || hdr.texture_size < PVR_PAL_HDR_SIZE) {
+        LOG_ERROR("OMF:Error truncated, %u bytes\n", (unsigned int)size);
+        return 1;
+    }
+
+    *pvr = data + hdr.texture_offset;
+    *pvr_size = hdr.texture_size;
+    if (!font) {
+        return 0;
+    }
+
+    font->font_size = hdr.font_size;
+    font->line_height = hdr.line_height;
+    font->tex_width = hdr.tex_width;
+    font->tex_height = hdr.tex_height;
+    font->num_kerns = hdr.num_kerns;
+    memcpy(font->glyphs, data + hdr.glyphs_offset, sizeof(font->glyphs));
+    font->kerns = arena_alloc(ARENA_FONT, hdr.num_kerns * sizeof(omf_kern));
+    if (hdr.num_kerns && !font->kerns) {
+        LOG_ERROR("%s no free memory\n", __func__);
+        return 1;
+    }
+    memcpy(font->kerns, data + hdr.kerns_offset, hdr.num_kerns * sizeof(omf_kern));
+
+    /* A bad span would read past the kerning table */
+    for (int i = 0; i < OMF_GLYPHS; i++) {
+        if ((uint32_t)font->glyphs[i].kern_start + font->glyphs[i].kern_count > hdr.num_kerns) {
+            font->glyphs[i].kern_count = 0;
+        }
+    }
+    return 0;
+}
+
+#ifdef STANDALONE_BINARY
+/* OMF writer, host only (fontcompile) */
+
+static void
+omf_pad(FILE* fd, uint32_t* offset, uint32_t align) {
+    static const uint8_t zero[32] = {0};
+    if (*offset & (align - 1)) {
+        const uint32_t pad = align - (*offset & (align - 1));
+        fwrite(zero, pad, 1, fd);
+        *offset += pad;
+    }
+}
+
+int
+omf_font_write(const char* path, const omf_font* font, const void* pvr, size_t pvr_size) {
+    static const char gbix[PVR_PAL_HDR_SIZE / 2] = {'G', 'B', 'I', 'X', 8, 0, 0, 0, 0, 0, 0, 0, ' ', ' ', ' ', ' '};
+    const int has_gbix = (pvr_size >= 4 && !memcmp(pvr, "GBIX", 4));
+    if (pvr_size < (has_gbix ? PVR_PAL_HDR_SIZE : PVR_PAL_HDR_SIZE / 2)) {
+        LOG_ERROR("OMF:Error texture too small\n");
+        return 1;
+    }
+
+    FILE* fd = fopen(path, "wb");
+    if (!fd) {
+        LOG_ERROR("OMF:Error cant write %s\n", path);
+        return 1;
+    }
+
+    omf_header hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, OMF_MAGIC, 4);
+    hdr.version = OMF_VERSION;
+    hdr.font_size = font->font_size;
+    hdr.line_height = font->line_height;
+    hdr.tex_width = font->tex_width;
+    hdr.tex_height = font->tex_height;
+    hdr.num_kerns = font->num_kerns;
+    hdr.glyphs_offset = sizeof(omf_header);
+    hdr.kerns_offset = hdr.glyphs_offset + sizeof(font->glyphs);
+    hdr.texture_offset = (hdr.kerns_offset + font->num_kerns * sizeof(omf_kern) + 31) & ~31u;
+    hdr.texture_size = pvr_size + (has_gbix ? 0 : sizeof(gbix));
+
+    uint32_t offset = 0;
+    fwrite(&hdr, sizeof(hdr), 1, fd);
+    fwrite(font->glyphs, sizeof(font->glyphs), 1, fd);
+    if (font->num_kerns) {
+        fwrite(font->kerns, sizeof(omf_kern), font->num_kerns, fd);
+    }
+    offset = hdr.kerns_offset + font->num_kerns * sizeof(omf_kern);
+    omf_pad(fd, &offset, 32);
+    if (!has_gbix) {
+        fwrite(gbix, sizeof(gbix), 1, fd);
+    }
+    fwrite(pvr, pvr_size, 1, fd);
+
+    const int err = ferror(fd);
+    fclose(fd);
+    if (err) {
+        LOG_ERROR("OMF:Error writing %s\n", path);
+        return 1;
+    }
+    return 0;
+}
+#endif
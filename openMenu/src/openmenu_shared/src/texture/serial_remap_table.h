@@ -0,0 +1,230 @@
+/* Generated by remapgen from serial_remap.def, do not edit */
+
+#pragma once
+
+#include <stdint.h>
+
+/* Little endian words so the image keeps its 4 byte alignment */
+static const uint32_t serial_remap_builtin[1761] = {
+    0x4D524D4F, 0x00000001, 0x00000082, 0x00000100, 0x00000080, 0x00000083, 0x00000819, 0x0000002C,
+    0x0000012C, 0x0000092C, 0x00001368, 0x00010000, 0x00000000, 0x00010001, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000,
+    0x00000000, 0x00010002, 0x00000000, 0x00000000, 0x00000002, 0x00010000, 0x00000000, 0x00000000,
+    0x00000001, 0x00000001, 0x00000001, 0x00000000, 0x00000000, 0x00010000, 0x00010000, 0x00000000,
+    0x00000000, 0x00010000, 0x00000000, 0x00010000, 0x00000000, 0x00010002, 0x00000001, 0x00000000,
+    0x00000002, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00010000, 0x00000000, 0x00000001, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0x00010000, 0x00000000, 0x00000000, 0x00020002, 0x00000000,
+    0x00010002, 0x00010002, 0x00000000, 0x00000487, 0x00010044, 0x000001C1, 0x00010014, 0x00000336,
+    0x0001002F, 0x000001DF, 0x00010016, 0x00000384, 0x00010034, 0x00000000, 0x00000000, 0x000003F4,
+    0x0001003B, 0x000000D5, 0x00020008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000007A3, 0x0001007A, 0x000005F5, 0x0001005D, 0x00000000,
+    0x00000000, 0x000005D5, 0x0001005A, 0x00000000, 0x00000000, 0x0000011F, 0x00010047, 0x00000416,
+    0x0001003D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000002BE, 0x00010027, 0x000001CB,
+    0x0001005E, 0x00000000, 0x00000000, 0x00000141, 0x0001000D, 0x000000A3, 0x00010006, 0x00000052,
+    0x00010003, 0x0000017D, 0x00010010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000003C4, 0x00010038, 0x000001D5, 0x00010015, 0x00000000, 0x00000000, 0x0000021A,
+    0x00010071, 0x00000000, 0x00000000, 0x00000478, 0x00010043, 0x00000199, 0x0001005B, 0x00000293,
+    0x00010024, 0x00000233, 0x0001001C, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000004D7,
+    0x0001004A, 0x0000062F, 0x00010061, 0x00000000, 0x00000000, 0x00000436, 0x0001003F, 0x00000801,
+    0x00010080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000352,
+    0x00010031, 0x0000076E, 0x00010076, 0x0000074E, 0x00010073, 0x00000000, 0x00000000, 0x00000585,
+    0x00010055, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000525, 0x0001004F, 0x00000207,
+    0x00010019, 0x00000497, 0x00010045, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000362, 0x00010032, 0x000003E4, 0x0001003A, 0x00000000,
+    0x00000000, 0x000000BE, 0x00010007, 0x0000006D, 0x00010004, 0x000001FD, 0x00010018, 0x00000000,
+    0x00000000, 0x00000428, 0x0001003E, 0x00000000, 0x00000000, 0x000006D7, 0x0001006B, 0x00000671,
+    0x00010065, 0x00000565, 0x00010053, 0x00000000, 0x00000000, 0x000006E9, 0x0001006C, 0x00000000,
+    0x00000000, 0x000002AC, 0x00010026, 0x00000783, 0x00010078, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000344, 0x00010030, 0x000002F2, 0x0001002A, 0x0000025A,
+    0x00010020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000756, 0x00010074, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000001C, 0x00010001, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000641, 0x00010062, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000026A, 0x00010021, 0x0000075E, 0x00010075, 0x00000324,
+    0x0001002E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000775, 0x00010077, 0x00000718,
+    0x0001006F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000466, 0x00010042, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000005B3,
+    0x00010058, 0x000007C5, 0x0001007C, 0x00000001, 0x00010000, 0x00000000, 0x00000000, 0x0000010E,
+    0x0001000B, 0x00000000, 0x00000000, 0x0000028A, 0x00010023, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x0000016B, 0x0001000F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000555,
+    0x00010052, 0x0000073E, 0x00010072, 0x00000000, 0x00000000, 0x00000709, 0x0001006E, 0x00000000,
+    0x00000000, 0x000002F9, 0x0001002B, 0x00000681, 0x00010066, 0x000003A8, 0x00010036, 0x00000000,
+    0x00000000, 0x000001AD, 0x00010013, 0x00000158, 0x0001000E, 0x00000000, 0x00000000, 0x00000691,
+    0x00010067, 0x00000000, 0x00000000, 0x000001B7, 0x0001005C, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000003D4, 0x00010039, 0x00000037, 0x00010002, 0x000000B5, 0x0001001F, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000315, 0x0001002D, 0x00000307, 0x0001002C, 0x000002E1,
+    0x00010029, 0x00000000, 0x00000000, 0x00000129, 0x0001000C, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000005A1, 0x00010057, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000575, 0x00010054, 0x00000000,
+    0x00000000, 0x00000211, 0x0001001A, 0x00000372, 0x00010033, 0x00000000, 0x00000000, 0x0000061F,
+    0x00010060, 0x00000000, 0x00000000, 0x000002CF, 0x00010028, 0x000004E7, 0x0001004B, 0x00000000,
+    0x00000000, 0x00000278, 0x00010022, 0x000006B3, 0x00010069, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000446, 0x00010040, 0x000007B3,
+    0x0001007B, 0x00000000, 0x00000000, 0x000007EF, 0x0001007F, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000661, 0x00010064, 0x0000018F, 0x00010011, 0x000006A1,
+    0x00010068, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000E5,
+    0x00010025, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000507, 0x0001004D, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000809, 0x00010081, 0x000004F7, 0x0001004C, 0x000006C5,
+    0x0001006A, 0x00000099, 0x0001001D, 0x00000396, 0x00010035, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000811, 0x00010082, 0x00000000, 0x00000000, 0x00000793, 0x00010079, 0x000004A7,
+    0x00010046, 0x00000000, 0x00000000, 0x00000515, 0x0001004E, 0x00000000, 0x00000000, 0x00000456,
+    0x00010041, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000651, 0x00010063, 0x00000223,
+    0x0001001B, 0x000006F9, 0x0001006D, 0x000003B6, 0x00010037, 0x00000088, 0x00010005, 0x00000728,
+    0x00010070, 0x00000000, 0x00000000, 0x000007DD, 0x0001007E, 0x00000000, 0x00000000, 0x000007CD,
+    0x0001007D, 0x00000245, 0x0001001E, 0x000001A3, 0x00010012, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000535, 0x00010050, 0x00000000, 0x00000000, 0x00000404,
+    0x0001003C, 0x000004B7, 0x00010048, 0x00000000, 0x00000000, 0x000004C7, 0x00010049, 0x00000000,
+    0x00000000, 0x000000F3, 0x0001000A, 0x00000593, 0x00010056, 0x0000060F, 0x0001005F, 0x00000545,
+    0x00010051, 0x000005C5, 0x00010059, 0x00000000, 0x00000000, 0x000001E9, 0x00010017, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000009, 0x00000012, 0x00000000, 0x00000000,
+    0x00000001, 0x00000024, 0x0000002D, 0x00000000, 0x00000000, 0x00000001, 0x00000041, 0x0000004A,
+    0x00000000, 0x00000000, 0x00000001, 0x0000005A, 0x00000063, 0x00000000, 0x00000000, 0x00000001,
+    0x00000075, 0x0000007E, 0x00000000, 0x00000000, 0x00000001, 0x00000090, 0x00000099, 0x00000000,
+    0x00000000, 0x00000001, 0x000000AC, 0x000000B5, 0x00000000, 0x00000000, 0x00000001, 0x000000C5,
+    0x000000CE, 0x00000000, 0x00000000, 0x00000001, 0x000000DC, 0x000000E5, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000EC, 0x00000001, 0x000000FB, 0x00000104,
+    0x00000000, 0x00000000, 0x00000001, 0x00000116, 0x0000011F, 0x00000000, 0x00000000, 0x00000001,
+    0x00000130, 0x00000139, 0x00000000, 0x00000000, 0x00000001, 0x00000148, 0x00000151, 0x00000000,
+    0x00000000, 0x00000002, 0x0000015F, 0x00000164, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000175, 0x00000175, 0x00000000, 0x00000000, 0x00000000, 0x00000186, 0x00000186,
+    0x00000000, 0x00000000, 0x00000000, 0x00000199, 0x00000199, 0x00000000, 0x00000000, 0x00000000,
+    0x00000199, 0x00000199, 0x00000000, 0x00000000, 0x00000000, 0x000001B7, 0x000001B7, 0x00000000,
+    0x00000000, 0x00000000, 0x000001CB, 0x000001CB, 0x00000000, 0x00000000, 0x00000000, 0x000001CB,
+    0x000001CB, 0x00000000, 0x00000000, 0x00000000, 0x000001CB, 0x000001CB, 0x00000000, 0x00000000,
+    0x00000000, 0x000001F3, 0x000001F3, 0x00000000, 0x00000000, 0x00000000, 0x000001F3, 0x000001F3,
+    0x00000000, 0x00000000, 0x00000000, 0x000001F3, 0x000001F3, 0x00000000, 0x00000000, 0x00000000,
+    0x0000021A, 0x0000021A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000022B, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000023D, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000088, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000024C, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000253, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000263,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000271, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000282, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000CE, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000029D, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000002A5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000002B6, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x000002C7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000002D9,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000002EB, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000002EB, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000300, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000030E, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0000031C, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000032E, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x0000033D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000034B,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000035A, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x0000036B, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000037C, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000038E, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000003A0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000003AF, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x000003BD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000003CC,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000003DC, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000003EC, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000003FC, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000040E, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000420, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000042F, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x0000043E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000044F,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000045F, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000470, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000480, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000048F, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0000049F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000004AF, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x0000010E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000004C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000004CF, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000004DF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000004EF, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000500, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0000050E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000051D, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x0000052D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000053D,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000054D, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x0000055D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000056D, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000057E, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0000058C, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000059A, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x000005AB, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000005BD,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000005CD, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000005DD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000005E5, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000005ED, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000005FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000607, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000617, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000627,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000639, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x0000064A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000659, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000669, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000679, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000068A, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000699, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000006AB,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000006BD, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000006CF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000006E1, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000006F1, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000701, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000711, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000720, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000072F,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000737, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000746, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000038E, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000001C, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000766, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000775, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x0000077C, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000078B,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000079B, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x000007AB, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000007BB, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000003A0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x000007D5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000007E5, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x000007F7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000005CD,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000005DD, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000470, 0x35315400, 0x4E373131, 0x30303200, 0x32343031, 0x31540033, 0x32313135,
+    0x00353044, 0x31354B4D, 0x00353330, 0x30303032, 0x30323130, 0x354B4D00, 0x35333031, 0x54003035,
+    0x31373731, 0x30354434, 0x30303200, 0x31313130, 0x31540036, 0x39313737, 0x4B4D004E, 0x31313135,
+    0x30320034, 0x39303130, 0x4D003032, 0x3131354B, 0x30353431, 0x36335400, 0x4E323038, 0x39393100,
+    0x32323139, 0x33540030, 0x33303836, 0x00353044, 0x31354B4D, 0x00383731, 0x31303032, 0x39323131,
+    0x354B4D00, 0x38373131, 0x54003035, 0x36303739, 0x00303544, 0x39393931, 0x31303231, 0x37395400,
+    0x35443530, 0x39540030, 0x4D343035, 0x30303200, 0x30343030, 0x39540037, 0x4E343035, 0x30375400,
+    0x00443530, 0x30303032, 0x31313730, 0x30375400, 0x00443330, 0x30323154, 0x4D004E33, 0x3031354B,
+    0x32003235, 0x30313030, 0x00363033, 0x31354B4D, 0x35323530, 0x31540030, 0x38303033, 0x3032004E,
+    0x34303130, 0x54003230, 0x31303331, 0x30354431, 0x30305400, 0x004D3030, 0x39393931, 0x33313830,
+    0x33315400, 0x4E313037, 0x30305400, 0x004D3630, 0x33303032, 0x39303630, 0x30305400, 0x004D3031,
+    0x30303054, 0x6F004D39, 0x00687472, 0x32303054, 0x54004D36, 0x30303331, 0x35304431, 0x33315400,
+    0x44313030, 0x31385400, 0x35443131, 0x38540038, 0x44313131, 0x54003035, 0x30303534, 0x39304431,
+    0x35345400, 0x44313030, 0x54003530, 0x30303534, 0x38314431, 0x35345400, 0x44323030, 0x54003930,
+    0x30303534, 0x35304432, 0x36335400, 0x44353138, 0x54003630, 0x30383633, 0x35304434, 0x36335400,
+    0x44353138, 0x54003331, 0x31383633, 0x38314435, 0x354B4D00, 0x35393031, 0x4D003630, 0x3031354B,
+    0x35303539, 0x354B4D00, 0x35393031, 0x4D003930, 0x3031354B, 0x38313539, 0x31385400, 0x314E3330,
+    0x38540038, 0x4E333031, 0x54003035, 0x30303031, 0x54004431, 0x30303031, 0x4D004E34, 0x3031354B,
+    0x30353430, 0x354B4D00, 0x34303031, 0x37395400, 0x00443331, 0x30373954, 0x54004E39, 0x36303739,
+    0x3954004E, 0x44333037, 0x54003035, 0x33303739, 0x3854004E, 0x44323031, 0x31385400, 0x004E3130,
+    0x31354B4D, 0x35353230, 0x4B4D0030, 0x32303135, 0x39540035, 0x44323035, 0x4D003035, 0x3131354B,
+    0x30353230, 0x354B4D00, 0x32303131, 0x32315400, 0x004E3730, 0x37373154, 0x35443031, 0x31540030,
+    0x33313737, 0x3854004E, 0x44363031, 0x54003035, 0x30313133, 0x4D004E31, 0x3031354B, 0x30353136,
+    0x354B4D00, 0x31363031, 0x35345400, 0x44363030, 0x31003035, 0x31303737, 0x3731004E, 0x44313037,
+    0x37373100, 0x00443730, 0x30373731, 0x54004E37, 0x37303138, 0x38540044, 0x4E393031, 0x30375400,
+    0x00443231, 0x32303454, 0x004E3831, 0x31354B4D, 0x35313230, 0x34540031, 0x35313230, 0x3754004E,
+    0x44343030, 0x32315400, 0x004E3530, 0x32303754, 0x54004431, 0x30323231, 0x3254004E, 0x31303932,
+    0x32540044, 0x31303932, 0x3954004E, 0x44393037, 0x54003035, 0x37303739, 0x4B4D004E, 0x30303135,
+    0x00303536, 0x31354B4D, 0x00363030, 0x31354B4D, 0x35333530, 0x4B4D0030, 0x35303135, 0x4B4D0033,
+    0x31303135, 0x00303539, 0x31354B4D, 0x00393130, 0x30313854, 0x54004434, 0x36303138, 0x3954004E,
+    0x44353035, 0x35395400, 0x004E3730, 0x31353154, 0x00443930, 0x31353154, 0x004E3830, 0x31353154,
+    0x00443430, 0x31353154, 0x004E3630, 0x37373154, 0x00443232, 0x32303454, 0x004E3730, 0x37373154,
+    0x00443632, 0x32303454, 0x004E3231, 0x31354B4D, 0x35303030, 0x4B4D0030, 0x30303135, 0x4B4D0030,
+    0x36303135, 0x00303530, 0x31354B4D, 0x00303630, 0x30343154, 0x54004431, 0x31303431, 0x3454004E,
+    0x31303431, 0x34540044, 0x31303431, 0x3854004E, 0x44353031, 0x54003035, 0x35303138, 0x3854004E,
+    0x44323131, 0x54003035, 0x36313138, 0x4B4D004E, 0x35303135, 0x00303531, 0x31354B4D, 0x00313530,
+    0x38363354, 0x00443631, 0x31323154, 0x54004E36, 0x30303534, 0x54004434, 0x30373134, 0x54004E34,
+    0x30373731, 0x54004432, 0x30373731, 0x54004E32, 0x31373731, 0x54004433, 0x31373731, 0x54004E38,
+    0x37313138, 0x00303544, 0x31313854, 0x54004E38, 0x30303332, 0x54004431, 0x30303332, 0x54004E31,
+    0x31303331, 0x54004430, 0x30303332, 0x54004E33, 0x32373731, 0x54004433, 0x30323034, 0x54004E39,
+    0x33313037, 0x00303544, 0x31323154, 0x54004E33, 0x36303037, 0x31540044, 0x4E303132, 0x37315400,
+    0x44313137, 0x37315400, 0x4E383037, 0x30345400, 0x44363032, 0x30345400, 0x4E363032, 0x37315400,
+    0x44313237, 0x30345400, 0x4E363132, 0x37315400, 0x44333037, 0x37315400, 0x4E333037, 0x36335400,
+    0x44373038, 0x36335400, 0x4E353038, 0x36335400, 0x44383038, 0x36335400, 0x4E383038, 0x30375400,
+    0x35443930, 0x31540030, 0x4E383032, 0x31385400, 0x00443830, 0x30313854, 0x54004E38, 0x33303539,
+    0x39540044, 0x4E323135, 0x354B4D00, 0x32303031, 0x4D003035, 0x3031354B, 0x4D003230, 0x3031354B,
+    0x33353131, 0x354B4D00, 0x31313031, 0x30345400, 0x44313032, 0x30345400, 0x4E323032, 0x30345400,
+    0x44303132, 0x30345400, 0x4E313132, 0x30345400, 0x4E313034, 0x30345400, 0x4E323034, 0x36335400,
+    0x44353138, 0x54003530, 0x31383633, 0x54004E32, 0x30383633, 0x54004E36, 0x30303331, 0x54004438,
+    0x30303331, 0x54004E36, 0x30323034, 0x54004434, 0x30323034, 0x4D004E35, 0x3031354B, 0x30353032,
+    0x354B4D00, 0x30323037, 0x31385400, 0x35443130, 0x38540030, 0x4E323031, 0x30345400, 0x44333032,
+    0x30345400, 0x4E343032, 0x35315400, 0x44333131, 0x35315400, 0x4E353231, 0x36335400, 0x44303138,
+    0x36335400, 0x4E303138, 0x31385400, 0x35443031, 0x38540030, 0x4E303131, 0x33315400, 0x44323030,
+    0x33315400, 0x4E323030, 0x354B4D00, 0x34393031, 0x54003035, 0x30333434, 0x4D004E31, 0x3031354B,
+    0x30353130, 0x354B4D00, 0x31303031, 0x354B4D00, 0x38323031, 0x4D003035, 0x3031354B, 0x4D003832,
+    0x3031354B, 0x30353435, 0x354B4D00, 0x34353031, 0x35315400, 0x44363031, 0x35315400, 0x4E333131,
+    0x36335400, 0x44393038, 0x36335400, 0x4E343038, 0x30345400, 0x44343035, 0x31385400, 0x004E3131,
+    0x36303454, 0x00443130, 0x36303454, 0x004E3130, 0x31303754, 0x54004436, 0x30393232, 0x54004E34,
+    0x33303138, 0x3154004E, 0x33303030, 0x31540044, 0x35303030, 0x4448004E, 0x35303052, 0x44480034,
+    0x35303052, 0x44480033, 0x35313052, 0x4B4D0039, 0x33313135, 0x33540036, 0x4D313036, 0x36335400,
+    0x004D3230, 0x30363354, 0x54004E31, 0x30393034, 0x54004D33, 0x30393034, 0x48004D31, 0x31305244,
+    0x4D003932, 0x3131354B, 0x48003030, 0x31305244, 0x4D003336, 0x3131354B, 0x48003339, 0x31305244,
+    0x4D003837, 0x3131354B, 0x30353239, 0x52444800, 0x30313030, 0x52444800, 0x33363030, 0x354B4D00,
+    0x32393031, 0x52444800, 0x36313030, 0x354B4D00, 0x39353031, 0x48003035, 0x31305244, 0x4D003436,
+    0x3131354B, 0x30353438, 0x30335400, 0x4D313038, 0x30335400, 0x4D333038, 0x52444800, 0x39323030,
+    0x00000000,
+};
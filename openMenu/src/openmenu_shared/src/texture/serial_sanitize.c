@@ -9,202 +9,187 @@
  * http://www.opensource.org/licenses/BSD-3-Clause
  */
 
-#include <uthash.h>
-
-// Disc serial will be the filename, e.g. T8119N.PVR
-/* Name, IP Serial, Disc Serial */
-// F355 Challenge: Passione Rossa, MK-0100, T-8119N
-
-enum REMAP_TYPE {
-    REMAP_NONE = (0 << 0), // 0
-    REMAP_ART = (1 << 0),  // 1
-    REMAP_META = (1 << 1), // 2
-};
-
-#define REMAP_ADD_ART(ip, disc)                                                                                        \
-    (serial_remap) { .ip_serial = ip, .art_serial = disc, .remap_choice = REMAP_ART }
-
-#define REMAP_ADD_META(ip, disc)                                                                                       \
-    (serial_remap) { .ip_serial = ip, .meta_serial = disc, .remap_choice = REMAP_META }
-
-#define REMAP_ADD_BOTH(ip, disc)                                                                                       \
-    (serial_remap) { .ip_serial = ip, .meta_serial = disc, .art_serial = disc, .remap_choice = REMAP_META | REMAP_ART }
-
-typedef struct serial_remap {
-    const char* ip_serial;
-    const char* art_serial;
-    const char* meta_serial;
-    UT_hash_handle hh; /* makes this structure hashable */
-    const enum REMAP_TYPE remap_choice;
-} serial_remap;
-
-/* Generate from excel with:
-find:     ^(.*)[\t](.*)[\n]
-replace:  REMAP_ADD_META("$1", "$2"),\n
-*/
-
-static serial_remap serial_remap_members[] = {
-    /* PAL Regional Duplicates */
-    REMAP_ADD_BOTH("T13001D05", "T13001D"), /* Blue Stinger */
-    REMAP_ADD_BOTH("T8111D58", "T8111D50"), /* ECW Hardcore Revolution */
-    // T9705D50	T9706D50	NBA Showtime: NBA on NBC, Incorrect IP.BIN
-    // T7003D	  T7005D	  Plasma Sword: Nightmare of Bilstein, Incorrect
-    // IP.BIN
-    REMAP_ADD_BOTH("T45001D09", "T45001D05"), /* Tom Clancy's Rainbow Six */
-    REMAP_ADD_BOTH("T45001D18", "T45001D05"), /* Tom Clancy's Rainbow Six */
-    REMAP_ADD_BOTH("T45002D09", "T45002D05"), /* Tom Clancy's Rainbow Six: Rogue Spear */
-    REMAP_ADD_BOTH("T36815D06", "T36804D05"), /* Tomb Raider Chronicles */
-    REMAP_ADD_BOTH("T36815D13", "T36804D05"), /* Tomb Raider Chronicles */
-    REMAP_ADD_BOTH("T36815D18", "T36804D05"), /* Tomb Raider Chronicles */
-    REMAP_ADD_BOTH("MK5109506", "MK5109505"), /* UEFA Dream Soccer */
-    REMAP_ADD_BOTH("MK5109509", "MK5109505"), /* UEFA Dream Soccer */
-    REMAP_ADD_BOTH("MK5109518", "MK5109505"), /* UEFA Dream Soccer */
-    REMAP_ADD_BOTH("T8103N18", "T8103N50"),   /* WWF Attitude */
-
-    /* PAL Missing Meta */
-    REMAP_ADD_META("T10001D", "T10004N"),
-    REMAP_ADD_META("MK5100450", "MK51004"),
-    REMAP_ADD_META("MK5117850", "MK51178"), /* NBA 2K2 */
-    REMAP_ADD_META("T9713D", "T9709N"),
-    REMAP_ADD_META("T9705D50", "T9706N"),
-    REMAP_ADD_META("T9703D50", "T9703N"),
-    REMAP_ADD_META("T8102D", "T8101N"),
-    REMAP_ADD_META("MK5102550", "MK51025"),
-    REMAP_ADD_META("T9502D50", "T9504N"), /* Nightmare Creatures II */
-    REMAP_ADD_META("MK5110250", "MK51102"),
-    REMAP_ADD_META("T7003D", "T1207N"),
-    REMAP_ADD_META("T17710D50", "T17713N"),
-    REMAP_ADD_META("T8106D50", "T31101N"),
-    REMAP_ADD_META("MK5106150", "MK51061"),
-    REMAP_ADD_META("T45006D50", "17701N"),
-    REMAP_ADD_META("17701D", "17701N"),
-    REMAP_ADD_META("17707D", "17707N"),
-    REMAP_ADD_META("T8107D", "T8109N"),
-    REMAP_ADD_META("T7012D", "T40218N"),
-    REMAP_ADD_META("MK5102151", "T40215N"),
-    REMAP_ADD_META("T7004D", "T1205N"),
-    REMAP_ADD_META("T7021D", "T1220N"),
-    REMAP_ADD_META("T22901D", "T22901N"),
-    REMAP_ADD_META("T9709D50", "T9707N"),
-    REMAP_ADD_META("MK5100650", "MK51006"),
-    REMAP_ADD_META("MK5105350", "MK51053"),
-    REMAP_ADD_META("MK5101950", "MK51019"),
-    REMAP_ADD_META("T8104D", "T8106N"),
-    REMAP_ADD_META("T9505D", "T9507N"),
-    REMAP_ADD_META("T15109D", "T15108N"),
-    REMAP_ADD_META("T15104D", "T15106N"),
-    REMAP_ADD_META("T17722D", "T40207N"),
-    REMAP_ADD_META("T17726D", "T40212N"),
-    REMAP_ADD_META("MK5100050", "MK51000"),
-    REMAP_ADD_META("MK5106050", "MK51060"),
-    REMAP_ADD_META("T1401D", "T1401N"),
-    REMAP_ADD_META("T41401D", "T41401N"),
-    REMAP_ADD_META("T8105D50", "T8105N"),
-    REMAP_ADD_META("T8112D50", "T8116N"),
-    REMAP_ADD_META("MK5105150", "MK51051"),
-    REMAP_ADD_META("T36816D", "T1216N"),
-    REMAP_ADD_META("T45004D", "T41704N"),
-    REMAP_ADD_META("T17702D", "T17702N"),
-    REMAP_ADD_META("T17713D", "T17718N"),
-    REMAP_ADD_META("T13011D50", "T13008N"), /* Spider-Man */
-    REMAP_ADD_META("T8117D50", "T8118N"),
-    REMAP_ADD_META("T23001D", "T23001N"),
-    REMAP_ADD_META("T13010D", "T23003N"),
-    REMAP_ADD_META("T17723D", "T40209N"),
-    REMAP_ADD_META("T7005D", "T1203N"),
-    REMAP_ADD_META("T7013D50", "T1213N"),
-    REMAP_ADD_META("T7006D", "T1210N"),
-    REMAP_ADD_META("T17711D", "T17708N"),
-    REMAP_ADD_META("T40206D", "T40206N"),
-    REMAP_ADD_META("T17721D", "T40216N"),
-    REMAP_ADD_META("T17703D", "T17703N"),
-    REMAP_ADD_META("T36807D", "T36805N"),
-    REMAP_ADD_META("T36808D", "T36808N"),
-    REMAP_ADD_META("T7009D50", "T1208N"),
-    REMAP_ADD_META("T8108D", "T8108N"),
-    REMAP_ADD_META("T9503D", "T9512N"),
-    REMAP_ADD_META("MK5100250", "MK51002"),
-    REMAP_ADD_META("MK5101153", "MK51011"),
-    REMAP_ADD_META("T40201D", "T40202N"),
-    REMAP_ADD_META("T40210D", "T40211N"),
-    REMAP_ADD_META("T45001D05", "T40401N"),
-    REMAP_ADD_META("T45002D05", "T40402N"),
-    REMAP_ADD_META("T36815D05", "T36812N"),
-    REMAP_ADD_META("T36804D05", "T36806N"),
-    REMAP_ADD_META("T13008D", "T13006N"),
-    REMAP_ADD_META("T40204D", "T40205N"),
-    REMAP_ADD_META("MK5102050", "MK57020"),
-    REMAP_ADD_META("T8101D50", "T8102N"),
-    REMAP_ADD_META("T40203D", "T40204N"),
-    REMAP_ADD_META("T15113D", "T15125N"),
-    REMAP_ADD_META("T36810D", "T36810N"),
-    REMAP_ADD_META("T8110D50", "T8110N"),
-    REMAP_ADD_META("T13002D", "T13002N"),
-    REMAP_ADD_META("MK5109450", "T44301N"),
-    REMAP_ADD_META("MK5100150", "MK51001"),
-    REMAP_ADD_META("MK5102850", "MK51028"),
-    REMAP_ADD_META("MK5105450", "MK51054"),
-    REMAP_ADD_META("T15106D", "T15113N"),
-    REMAP_ADD_META("T36809D", "T36804N"),
-    REMAP_ADD_META("T40504D", "T8111N"),
-    REMAP_ADD_META("T40601D", "T40601N"),
-    REMAP_ADD_META("T7016D", "T22904N"),
-    REMAP_ADD_META("T8103N50", "T8103N"),
-    REMAP_ADD_META("T10003D", "T10005N"),
-
-    /* JAP Missing Meta */
-    REMAP_ADD_META("HDR0054", "MK51053"), /* Sega GT */
-    REMAP_ADD_META("HDR0053", "MK51035"),
-    REMAP_ADD_META("HDR0159", "MK51136"),
-    REMAP_ADD_META("T3601M", "T3602M"),
-    REMAP_ADD_META("T3602M", "T3601N"),
-    REMAP_ADD_META("T40903M", "T40901M"),
-    REMAP_ADD_META("HDR0129", "MK51100"),
-    REMAP_ADD_META("HDR0163", "MK51193"),
-    REMAP_ADD_META("HDR0178", "MK5119250"),
-    REMAP_ADD_META("HDR0010", "MK51019"),
-    REMAP_ADD_META("HDR0063", "MK51092"),
-    REMAP_ADD_META("HDR0016", "MK5105950"),
-    REMAP_ADD_META("HDR0164", "MK5118450"),
-    REMAP_ADD_META("T30801M", "T40202N"),
-    REMAP_ADD_META("T30803M", "T40211N"),
-    REMAP_ADD_META("HDR0029", "MK51051"),
-};
-
-static const int serials_added = sizeof(serial_remap_members) / sizeof(serial_remap);
-static serial_remap* serial_remap_list = NULL;
-
-const char*
-serial_santize_art(const char* id) {
-    const serial_remap* item;
-    const char* ret = id;
-
-    HASH_FIND_STR(serial_remap_list, id, item);
-
-    if (item && (item->remap_choice & REMAP_ART)) {
-        ret = item->art_serial;
-    }
-    return ret;
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "backend/gd_item.h"
+#include "texture/serial_remap.h"
+#include "texture/serial_sanitize.h"
+#include "dbgprint.h"
+
+#ifdef _arch_dreamcast
+#include <kos/fs.h>
+#define PATH_PREFIX "/cd/"
+#else
+#define PATH_PREFIX ""
+#endif
+
+/* Disc serial will be the filename, e.g. T8119N.PVR
+ * Name, IP Serial, Disc Serial
+ * F355 Challenge: Passione Rossa, MK-0100, T-8119N
+ *
+ * The rules live in serial_remap.def, serial_remap_table.h is the same table
+ * compiled by remapgen: ./remapgen -c serial_remap_table.h */
+#include "serial_remap_table.h"
+
+static const serial_remap_header* remap_image = NULL;
+static unsigned char* remap_loaded = NULL;
+
+static int
+remap_str_ok(const serial_remap_header* hdr, uint32_t offset, size_t max_len) {
+    const char* pool = (const char*)hdr + hdr->pool_offset;
+    return offset < hdr->pool_size && strlen(pool + offset) < max_len;
 }
 
-const char*
-serial_santize_meta(const char* id) {
-    const serial_remap* item;
-    const char* ret = id;
+static int
+remap_section_ok(uint32_t offset, uint32_t count, size_t elem_size, size_t size) {
+    return (offset & 3) == 0 && offset >= sizeof(serial_remap_header) && offset <= size
+           && (uint64_t)count * elem_size <= (uint64_t)(size - offset);
+}
+
+/* Everything a lookup touches has to be in bounds, REMAP.BIN comes off the disc */
+static int
+remap_image_valid(const unsigned char* image, size_t size) {
+    const serial_remap_header* hdr = (const serial_remap_header*)image;
+
+    if (size < sizeof(*hdr) || memcmp(hdr->magic, SERIAL_REMAP_MAGIC, 4) || hdr->version != SERIAL_REMAP_VERSION) {
+        return 0;
+    }
+    if (!hdr->table_size || (hdr->table_size & (hdr->table_size - 1)) || !hdr->num_buckets
+        || (hdr->num_buckets & (hdr->num_buckets - 1)) || hdr->num_rules > 0xFFFF) {
+        return 0;
+    }
+    if (!remap_section_ok(hdr->disp_offset, hdr->num_buckets, sizeof(uint16_t), size)
+        || !remap_section_ok(hdr->slots_offset, hdr->table_size, sizeof(serial_remap_slot), size)
+        || !remap_section_ok(hdr->rules_offset, hdr->num_rules, sizeof(serial_remap_rule), size)
+        || !remap_section_ok(hdr->pool_offset, hdr->pool_size, 1, size) || !hdr->pool_size
+        || image[hdr->pool_offset + hdr->pool_size - 1] != '\0') {
+        return 0;
+    }
 
-    HASH_FIND_STR(serial_remap_list, id, item);
+    const serial_remap_slot* slots = (const serial_remap_slot*)(image + hdr->slots_offset);
+    for (uint32_t i = 0; i < hdr->table_size; i++) {
+        if (!remap_str_ok(hdr, slots[i].key, SERIAL_REMAP_KEY_MAX)
+            || (uint32_t)slots[i].first_rule + slots[i].num_rules > hdr->num_rules) {
+            return 0;
+        }
+    }
+    const serial_remap_rule* rules = (const serial_remap_rule*)(image + hdr->rules_offset);
+    for (uint32_t i = 0; i < hdr->num_rules; i++) {
+        if (rules[i].cond_type > SERIAL_REMAP_NAME || !remap_str_ok(hdr, rules[i].cond, hdr->pool_size)
+            || !remap_str_ok(hdr, rules[i].fixed_product, SERIAL_REMAP_KEY_MAX)
+            || !remap_str_ok(hdr, rules[i].art, hdr->pool_size) || !remap_str_ok(hdr, rules[i].meta, hdr->pool_size)) {
+            return 0;
+        }
+    }
+    return 1;
+}
 
-    if (item && (item->remap_choice & REMAP_META)) {
-        ret = item->meta_serial;
+/* REMAP.BIN on the disc wins over the built in table so new fixes don't need a new build */
+static unsigned char*
+remap_load_file(const char* filename, size_t* size) {
+#ifndef STANDALONE_BINARY
+    file_t fd = fs_open(filename, O_RDONLY);
+    if (fd == -1) {
+        return NULL;
+    }
+    *size = fs_total(fd);
+#else
+    FILE* fd = fopen(filename, "rb");
+    if (!fd) {
+        return NULL;
+    }
+    fseek(fd, 0, SEEK_END);
+    *size = ftell(fd);
+    fseek(fd, 0, SEEK_SET);
+#endif
+
+    unsigned char* buffer = malloc(*size ? *size : 1);
+    if (!buffer) {
+        LOG_ERROR("%s no free memory\n", __func__);
+#ifndef STANDALONE_BINARY
+        fs_close(fd);
+#else
+        fclose(fd);
+#endif
+        return NULL;
+    }
+#ifndef STANDALONE_BINARY
+    ssize_t got = fs_read(fd, buffer, *size);
+    fs_close(fd);
+    if (got < 0 || (size_t)got != *size) {
+#else
+    size_t got = fread(buffer, 1, *size, fd);
+    fclose(fd);
+    if (got != *size) {
+#endif
+        free(buffer);
+        return NULL;
     }
-    return ret;
+    return buffer;
 }
 
 int
 serial_sanitizer_init(void) {
-    for (int i = 0; i < serials_added; i++) {
-        HASH_ADD_STR(serial_remap_list, ip_serial, &serial_remap_members[i]);
+    if (remap_image) {
+        return 0;
     }
 
+    size_t size = 0;
+    remap_loaded = remap_load_file(PATH_PREFIX "REMAP.BIN", &size);
+    if (remap_loaded && remap_image_valid(remap_loaded, size)) {
+        remap_image = (const serial_remap_header*)remap_loaded;
+        LOG_INFO("REMAP:Using " PATH_PREFIX "REMAP.BIN (%u serials)\n", (unsigned int)remap_image->num_keys);
+        return 0;
+    }
+    if (remap_loaded) {
+        LOG_ERROR("REMAP:" PATH_PREFIX "REMAP.BIN is invalid, using built in table\n");
+        free(remap_loaded);
+        remap_loaded = NULL;
+    }
+
+    remap_image = (const serial_remap_header*)serial_remap_builtin;
     return 0;
 }
+
+void
+serial_sanitize_item(gd_item* item) {
+    if (!remap_image) {
+        serial_sanitizer_init();
+    }
+    item->art_id = NULL;
+    item->meta_id = NULL;
+
+    const serial_remap_slot* slot = serial_remap_find(remap_image, item->product);
+    if (!slot) {
+        return;
+    }
+
+    const unsigned char* image = (const unsigned char*)remap_image;
+    const serial_remap_rule* rules = (const serial_remap_rule*)(image + remap_image->rules_offset);
+    const char* pool = (const char*)(image + remap_image->pool_offset);
+    const serial_remap_rule* rule = &rules[slot->first_rule];
+    const serial_remap_rule* end = rule + slot->num_rules;
+
+    /* Serial clash fixups come first, the fixed serial then takes its own remap */
+    for (; rule != end && rule->cond_type != SERIAL_REMAP_ALWAYS; rule++) {
+        const char* cond = pool + rule->cond;
+        if ((rule->cond_type == SERIAL_REMAP_DATE) ? !strcmp(item->date, cond) : (strstr(item->name, cond) != NULL)) {
+            strcpy(item->product, pool + rule->fixed_product);
+            if (!(slot = serial_remap_find(remap_image, item->product))) {
+                return;
+            }
+            rule = &rules[slot->first_rule];
+            end = rule + slot->num_rules;
+            while (rule != end && rule->cond_type != SERIAL_REMAP_ALWAYS) {
+                rule++;
+            }
+            break;
+        }
+    }
+    if (rule != end) {
+        item->art_id = rule->art ? pool + rule->art : NULL;
+        item->meta_id = rule->meta ? pool + rule->meta : NULL;
+    }
+}
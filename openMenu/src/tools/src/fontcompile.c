@@ -0,0 +1,81 @@
+/*
+ * File: fontcompile.c
+ * Project: tools
+ * File Created: Monday, 19th October 2026 11:40:12 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <om_reader.h>
+#include <texture/omf_format.h>
+
+/* Called:
+./fontcompile FONT.fnt TEXTURE.pvr [OUT.OMF]
+
+parses an AngelCode binary .fnt on the host and writes it together with its
+PVR texture as one OMF file (see omf_format.h), by default next to the texture
+with the extension swapped: FONT/BASILEA_W.PVR gives FONT/BASILEA_W.OMF, which
+is the name font_bmf looks for. The texture is stored as is, already twiddled.
+Needs rerunning whenever either input changes, without an OMF the .fnt and
+.pvr are loaded as before.
+*/
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    printf("Incorrect usage!\n\t./fontcompile FONT.fnt TEXTURE.pvr [OUT.OMF]\n");
+    return EXIT_FAILURE;
+  }
+  const char *fnt_path = argv[1];
+  const char *pvr_path = argv[2];
+  char omf_path[FILENAME_MAX];
+
+  if (argc > 3) {
+    snprintf(omf_path, sizeof(omf_path), "%s", argv[3]);
+  } else {
+    const char *ext = strrchr(pvr_path, '.');
+    const char *sep = strrchr(pvr_path, '/');
+    const int base = (ext && (!sep || ext > sep)) ? (int)(ext - pvr_path) : (int)strlen(pvr_path);
+    snprintf(omf_path, sizeof(omf_path), "%.*s.OMF", base, pvr_path);
+  }
+
+  static omf_font font;
+  if (omf_font_from_fnt(fnt_path, &font)) {
+    printf("Err: cant parse %s!\n", fnt_path);
+    return EXIT_FAILURE;
+  }
+  size_t pvr_size;
+  void *pvr = om_read_file(pvr_path, &pvr_size, NULL);
+  if (!pvr) {
+    printf("Err: cant read %s!\n", pvr_path);
+    return EXIT_FAILURE;
+  }
+  if (omf_font_write(omf_path, &font, pvr, pvr_size)) {
+    free(pvr);
+    return EXIT_FAILURE;
+  }
+
+  /* Round trip, the OMF has to load back to the same glyphs and kerning */
+  size_t omf_size;
+  void *omf = om_read_file(omf_path, &omf_size, NULL);
+  static omf_font check;
+  const void *check_pvr;
+  size_t check_pvr_size;
+  int ret = EXIT_SUCCESS;
+  if (!omf || omf_font_from_blob(omf, omf_size, &check, &check_pvr, &check_pvr_size)
+      || memcmp(check.glyphs, font.glyphs, sizeof(font.glyphs)) || check.num_kerns != font.num_kerns
+      || memcmp(check.kerns, font.kerns, font.num_kerns * sizeof(omf_kern))) {
+    printf("Err: %s does not load back!\n", omf_path);
+    ret = EXIT_FAILURE;
+  } else {
+    printf("%s: %u kerning pairs, %u byte texture, %u bytes\n", omf_path, (unsigned int)font.num_kerns,
+           (unsigned int)check_pvr_size, (unsigned int)omf_size);
+  }
+  free(omf);
+  free(pvr);
+  return ret;
+}
@@ -0,0 +1,139 @@
+/*
+ * File: io_check.c
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 3:40:21 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <backend/dat_format.h>
+#include <om_reader.h>
+#include <texture/omf_format.h>
+
+/* Called:
+./iocheck FILE.DAT FONT.fnt [FONT.OMF]
+
+loads a DAT index, one of its chunks and a BMF font the way the menu does and
+fails unless om_reader made the backend calls it should: the DAT index and
+the font front to back in OM_READER_BUF_SIZE refills, a chunk or an OMF in a
+single read. Every read is a round trip to the GD emulator on hardware, so a
+loader going back to per record reads shows up here as a failure.
+*/
+
+#define DAT_INDEX_RECORD (12 + sizeof(uint32_t)) /* ID and offset, as on disc */
+
+static int failures;
+
+static om_reader_stats since(const om_reader_stats *before) {
+  const om_reader_stats *now = om_reader_get_stats();
+  om_reader_stats delta = {now->opens - before->opens, now->reads - before->reads, now->seeks - before->seeks,
+                           now->bytes - before->bytes};
+  return delta;
+}
+
+static void expect(const char *what, const om_reader_stats *got, uint32_t opens, uint32_t reads) {
+  const int ok = got->opens == opens && got->reads == reads;
+  printf("%-4s %-10s opens %u (want %u) reads %u (want %u) bytes %lu\n", ok ? "ok" : "FAIL", what,
+         (unsigned int)got->opens, (unsigned int)opens, (unsigned int)got->reads, (unsigned int)reads,
+         (unsigned long)got->bytes);
+  failures += !ok;
+}
+
+/* Front to back in records that never straddle a refill, so every refill but
+ * the last is a whole buffer */
+static uint32_t buffered_reads(size_t size) {
+  return (uint32_t)((size + OM_READER_BUF_SIZE - 1) / OM_READER_BUF_SIZE);
+}
+
+static size_t file_size(const char *path) {
+  om_file file = om_file_open(path);
+  if (file == OM_FILE_INVALID) {
+    return 0;
+  }
+  const size_t size = om_file_size(file);
+  om_file_close(file);
+  return size;
+}
+
+static void check_dat(const char *path) {
+  static dat_file dat;
+  om_reader_stats before = *om_reader_get_stats();
+  DAT_init(&dat);
+  if (DAT_load_parse(&dat, path, DAT_VERSION_META)) {
+    printf("FAIL %s cant be parsed\n", path);
+    failures++;
+    return;
+  }
+  om_reader_stats got = since(&before);
+  expect("dat index", &got, 1, buffered_reads(sizeof(bin_header) + dat.num_chunks * DAT_INDEX_RECORD));
+
+  if (!dat.num_chunks) {
+    return;
+  }
+  void *chunk = malloc(dat.chunk_size);
+  if (!chunk) {
+    printf("Err: no free memory!\n");
+    exit(EXIT_FAILURE);
+  }
+  before = *om_reader_get_stats();
+  DAT_read_file_by_ID(&dat, dat.items[0].ID, chunk);
+  got = since(&before);
+  expect("dat chunk", &got, 0, 1);
+  if (got.bytes != dat.chunk_size) {
+    printf("FAIL dat chunk read %lu of %u bytes\n", (unsigned long)got.bytes, (unsigned int)dat.chunk_size);
+    failures++;
+  }
+  free(chunk);
+}
+
+static void check_fnt(const char *path) {
+  static omf_font font;
+  const size_t size = file_size(path);
+  const om_reader_stats before = *om_reader_get_stats();
+  if (omf_font_from_fnt(path, &font)) {
+    printf("FAIL %s cant be parsed\n", path);
+    failures++;
+    return;
+  }
+  const om_reader_stats got = since(&before);
+  /* Blocks are a few KB at most and come out of the buffer */
+  expect("bmf", &got, 1, buffered_reads(size));
+}
+
+static void check_omf(const char *path) {
+  size_t size;
+  const om_reader_stats before = *om_reader_get_stats();
+  void *blob = om_read_file(path, &size, NULL);
+  if (!blob) {
+    printf("FAIL %s cant be read\n", path);
+    failures++;
+    return;
+  }
+  const om_reader_stats got = since(&before);
+  expect("omf", &got, 1, 1);
+  free(blob);
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    printf("Incorrect usage!\n\t./iocheck FILE.DAT FONT.fnt [FONT.OMF]\n");
+    return EXIT_FAILURE;
+  }
+
+  check_dat(argv[1]);
+  check_fnt(argv[2]);
+  if (argc > 3) {
+    check_omf(argv[3]);
+  }
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+/*
+ * File: menucompile.c
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 9:58:03 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <backend/gd_list.h>
+
+/* Called:
+./menucompile OPENMENU.INI [OPENMENU.BIN]
+
+parses OPENMENU.INI once on the host and writes OPENMENU.BIN next to it (or to the
+given path): the item table, folder tree, sort orders and filter facets openMenu
+would otherwise rebuild every boot. Needs rerunning whenever the INI changes, a
+stale BIN is ignored and the INI parsed as before.
+*/
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    printf("Incorrect usage!\n\t./menucompile OPENMENU.INI [OPENMENU.BIN]\n");
+    return EXIT_FAILURE;
+  }
+  const char *ini_path = argv[1];
+  char bin_path[FILENAME_MAX];
+
+  if (argc > 2) {
+    snprintf(bin_path, sizeof(bin_path), "%s", argv[2]);
+  } else {
+    /* Same folder as the INI */
+    const char *sep = strrchr(ini_path, '/');
+    const char *sep_win = strrchr(ini_path, '\\');
+    if (sep_win && (!sep || sep_win > sep)) {
+      sep = sep_win;
+    }
+    const int dir_len = sep ? (int)(sep - ini_path + 1) : 0;
+    snprintf(bin_path, sizeof(bin_path), "%.*sOPENMENU.BIN", dir_len, ini_path);
+  }
+
+  if (list_read(ini_path)) {
+    return EXIT_FAILURE;
+  }
+  list_folder_init();
+  if (list_write_bin(bin_path, ini_path)) {
+    return EXIT_FAILURE;
+  }
+
+  /* Round trip, the BIN has to load back against the INI it came from */
+  list_folder_destroy();
+  list_destroy();
+  if (list_read_bin(bin_path, ini_path)) {
+    printf("Err: %s does not load back!\n", bin_path);
+    return EXIT_FAILURE;
+  }
+  list_folder_destroy();
+  list_destroy();
+  return EXIT_SUCCESS;
+}
@@ -8,21 +8,38 @@
  * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
  */
 #include <errno.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <backend/db_item.h>
+
+#include "dat_packer_interface.h"
+#include "pvr_image.h"
+
 /* Called:
 ./menufaker filelist.csv
 
 reads filelist.csv and creates a full OPENMENU.INI from it
-*/
 
-/* Compile:
-x86_64-w64-mingw32-gcc menufaker.c -Os -s -o menufaker.exe
-gcc menufaker.c -Os -s -o menufaker
+./menufaker -g [options] OUTDIR
+
+generates a reproducible synthetic card in OUTDIR: OPENMENU.INI plus matching
+ICON.DAT, BOX.DAT and META.DAT, meant for scaling/worst case measurements
+  -n COUNT    number of games (default 1000)
+  -s SEED     rng seed (default 1), same seed + options = same output
+  -d DEPTH    max folder depth, 0 for a flat card (default 3, reader max 8)
+  -f FANOUT   subfolders per folder (default 6)
+  -m PCT      percent of titles that are multi-disc sets of 2-4 discs (default 5)
+  -l          long names, near the 127 char limit for names and folders
+  -r DIST     region weights, e.g. "U=40,E=30,J=25,JUE=5" (default)
+  -G DIST     genre weights by metapacker name, e.g. "Action=3,RPG=1" (default all equal)
+  -a PCT      percent of products that get icon/box art (default 100)
+  -i SIZE     icon size (default 128), -b SIZE box size (default 256)
+  -x          skip writing DAT files
 */
 
 #ifdef WIN32
@@ -108,12 +125,429 @@ static void ini_add_game(int num, const char *product_id, const char *name, FILE
 }
 
 #define NUM_ARGS (1)
+#define MAX_DIST (32)
+#define MAX_FOLDER_NODES_READER (1024) /* gd_list.c MAX_FOLDER_NODES */
+
+typedef struct dist_entry {
+  char key[16];
+  unsigned int weight;
+} dist_entry;
+
+typedef struct dist {
+  dist_entry entries[MAX_DIST];
+  unsigned int count;
+  unsigned int total;
+} dist;
+
+typedef struct gen_opts {
+  unsigned int count;
+  uint64_t seed;
+  unsigned int depth;
+  unsigned int fanout;
+  unsigned int multidisc_pct;
+  int long_names;
+  unsigned int art_pct;
+  unsigned int icon_size;
+  unsigned int box_size;
+  int write_dats;
+  dist regions;
+  dist genres;
+} gen_opts;
+
+typedef struct gen_product {
+  char id[12];
+  unsigned int discs;
+  int has_art;
+} gen_product;
+
+static const char *genre_names[] = {"Action",    "Racing",     "Simulation", "Sports", "Lightgun", "Fighting",
+                                    "Shooter",   "Survival",   "Adventure",  "Platformer", "RPG",   "Shmup",
+                                    "Strategy",  "Puzzle",     "Arcade",     "Music"};
+
+static const char *words[] = {"Sonic",  "Crazy",  "Soul",     "Power",   "Stone", "Skies",   "Arcadia", "Jet",
+                              "Grind",  "Radio",  "Shenmue",  "Virtua",  "Tennis", "Rally",  "Street",  "Fighter",
+                              "Blade",  "Dream",  "Phantasy", "Star",    "Online", "Space",  "Channel", "Ikaruga",
+                              "Marvel", "Capcom", "Dead",     "House",   "Sega",   "Bass",   "Fishing", "Rush",
+                              "Hydro",  "Thunder", "Quake",   "Unreal",  "Tour",   "Legacy", "Kao",     "Kangaroo"};
+
+/* xorshift64*, fixed here so output doesn't depend on the host libc rand() */
+static uint64_t rng_state;
+
+static uint32_t rng_next(void) {
+  rng_state ^= rng_state >> 12;
+  rng_state ^= rng_state << 25;
+  rng_state ^= rng_state >> 27;
+  return (uint32_t)((rng_state * 2685821657736338717ULL) >> 32);
+}
+
+static unsigned int rng_range(unsigned int n) {
+  return n ? rng_next() % n : 0;
+}
+
+static const char *dist_pick(const dist *d) {
+  unsigned int roll = rng_range(d->total);
+  for (unsigned int i = 0; i < d->count; i++) {
+    if (roll < d->entries[i].weight) {
+      return d->entries[i].key;
+    }
+    roll -= d->entries[i].weight;
+  }
+  return d->entries[0].key;
+}
+
+static int dist_parse(dist *d, const char *spec) {
+  char temp[512];
+  strncpy(temp, spec, sizeof(temp) - 1);
+  temp[sizeof(temp) - 1] = '\0';
+  d->count = 0;
+  d->total = 0;
+
+  for (char *item = strtok(temp, ","); item && d->count < MAX_DIST; item = strtok(NULL, ",")) {
+    char *eq = strchr(item, '=');
+    dist_entry *e = &d->entries[d->count];
+    if (eq) {
+      *eq = '\0';
+    }
+    strncpy(e->key, item, sizeof(e->key) - 1);
+    e->key[sizeof(e->key) - 1] = '\0';
+    e->weight = eq ? (unsigned int)atoi(eq + 1) : 1;
+    d->total += e->weight;
+    d->count++;
+  }
+  if (!d->count || !d->total) {
+    printf("Err: bad distribution \"%s\"\n", spec);
+    return -1;
+  }
+  return 0;
+}
+
+static unsigned short genre_from_name(const char *name) {
+  for (unsigned int i = 0; i < sizeof(genre_names) / sizeof(genre_names[0]); i++) {
+    if (!strcmp(genre_names[i], name)) {
+      return (unsigned short)(1 << i);
+    }
+  }
+  return 0;
+}
+
+/* Appends random words to out until at least min_len chars, never past max_len */
+static void gen_words(char *out, size_t min_len, size_t max_len) {
+  size_t len = 0;
+  out[0] = '\0';
+  do {
+    const char *word = words[rng_range(sizeof(words) / sizeof(words[0]))];
+    const size_t word_len = strlen(word);
+    if (len + word_len + 1 >= max_len) {
+      break;
+    }
+    if (len) {
+      out[len++] = ' ';
+    }
+    memcpy(out + len, word, word_len + 1);
+    len += word_len;
+  } while (len < min_len);
+}
+
+static void gen_folder(const gen_opts *opts, char *out, size_t out_size) {
+  const unsigned int depth = rng_range(opts->depth + 1);
+  size_t len = 0;
+  out[0] = '\0';
+
+  /* Folder names are derived from their position so siblings are shared between games */
+  for (unsigned int level = 0; level < depth; level++) {
+    char segment[128];
+    const unsigned int child = rng_range(opts->fanout);
+    if (opts->long_names) {
+      snprintf(segment, sizeof(segment), "L%u-%02u Collection Of Long Folder Names For Stress Testing", level, child);
+    } else {
+      snprintf(segment, sizeof(segment), "L%u-%02u", level, child);
+    }
+    const size_t seg_len = strlen(segment);
+    if (len + seg_len + 2 >= out_size) {
+      break;
+    }
+    if (len) {
+      out[len++] = '\\';
+    }
+    memcpy(out + len, segment, seg_len + 1);
+    len += seg_len;
+  }
+}
+
+static void gen_icon(uint16_t *linear, unsigned int size, uint32_t hash) {
+  /* Cheap per product gradient, enough that every texture is distinct */
+  for (unsigned int y = 0; y < size; y++) {
+    for (unsigned int x = 0; x < size; x++) {
+      const uint32_t r = ((x * 255 / size) + hash) & 0xFF;
+      const uint32_t g = ((y * 255 / size) + (hash >> 8)) & 0xFF;
+      const uint32_t b = ((x + y) * 127 / size + (hash >> 16)) & 0xFF;
+      linear[y * size + x] = pvr_pack_color(0xFF000000 | r << 16 | g << 8 | b, PVR_PX_RGB565);
+    }
+  }
+}
+
+static uint32_t hash_id(const char *id) {
+  uint32_t h = 2166136261u;
+  while (*id) {
+    h = (h ^ (unsigned char)*id++) * 16777619u;
+  }
+  return h;
+}
+
+static int write_art_dat(const char *outdir, const char *name, const gen_product *products, unsigned int num_products,
+                         unsigned int size) {
+  bin_header file_header;
+  char path[FILENAME_MAX];
+  unsigned int num_art = 0;
+
+  for (unsigned int i = 0; i < num_products; i++) {
+    num_art += products[i].has_art;
+  }
+  if (!num_art) {
+    return 0;
+  }
+
+  memcpy(&file_header.magic.rich.alpha, "DAT", 3);
+  file_header.magic.rich.version = 1;
+  file_header.chunk_size = PVR_PAL_HDR_SIZE + size * size * 2;
+  file_header.num_chunks = 0;
+  file_header.padding0 = (sizeof(bin_header) + num_art * sizeof(bin_item_raw)) / file_header.chunk_size;
+
+  bin_item_raw *bin_items = calloc(num_art, sizeof(bin_item_raw));
+  unsigned char *data_buf = malloc((size_t)num_art * file_header.chunk_size);
+  uint16_t *linear = malloc(size * size * sizeof(uint16_t));
+  if (!bin_items || !data_buf || !linear) {
+    printf("%s no free memory\n", __func__);
+    free(bin_items);
+    free(data_buf);
+    free(linear);
+    return -1;
+  }
+
+  for (unsigned int i = 0; i < num_products; i++) {
+    if (!products[i].has_art) {
+      continue;
+    }
+    unsigned char *chunk = data_buf + (size_t)file_header.num_chunks * file_header.chunk_size;
+    gen_icon(linear, size, hash_id(products[i].id));
+    pvr_image_write_header(chunk, PVR_PX_RGB565, PVR_DF_TWIDDLED, size, size, size * size * 2);
+    pvr_twiddle_16bpp(linear, (uint16_t *)(chunk + PVR_PAL_HDR_SIZE), size, size);
+
+    memcpy(bin_items[file_header.num_chunks].ID, products[i].id, sizeof(bin_items->ID));
+    bin_items[file_header.num_chunks].offset = file_header.padding0 + file_header.num_chunks + 1;
+    file_header.num_chunks++;
+  }
+
+  snprintf(path, sizeof(path), "%s%s%s", outdir, PATH_SEP, name);
+  open_output(path);
+  write_bin_file(&file_header, bin_items, data_buf);
+
+  free(bin_items);
+  free(data_buf);
+  free(linear);
+  return 0;
+}
+
+static int write_meta_dat(const char *outdir, const gen_opts *opts, const gen_product *products,
+                          unsigned int num_products) {
+  bin_header file_header;
+  char path[FILENAME_MAX];
+
+  memcpy(&file_header.magic.rich.alpha, "DAT", 3);
+  file_header.magic.rich.version = 1;
+  file_header.chunk_size = sizeof(db_item);
+  file_header.num_chunks = 0;
+  file_header.padding0 = (sizeof(bin_header) + num_products * sizeof(bin_item_raw)) / file_header.chunk_size;
+
+  bin_item_raw *bin_items = calloc(num_products, sizeof(bin_item_raw));
+  db_item *records = calloc(num_products, sizeof(db_item));
+  if (!bin_items || !records) {
+    printf("%s no free memory\n", __func__);
+    free(bin_items);
+    free(records);
+    return -1;
+  }
+
+  for (unsigned int i = 0; i < num_products; i++) {
+    db_item *item = &records[i];
+    item->num_players = 1 + rng_range(4);
+    item->vmu_blocks = rng_range(200);
+    item->accessories = (unsigned char)(rng_range(4) ? ACCESORIES_JUMP_PACK : (1 << rng_range(8)));
+    item->genre = genre_from_name(dist_pick(&opts->genres));
+    if (!rng_range(4)) {
+      item->genre |= genre_from_name(dist_pick(&opts->genres)); /* some titles carry two genres */
+    }
+    gen_words(item->description, opts->long_names ? sizeof(item->description) - 16 : 120, sizeof(item->description));
+
+    memcpy(bin_items[i].ID, products[i].id, sizeof(bin_items->ID));
+    bin_items[i].offset = file_header.padding0 + i + 1;
+    file_header.num_chunks++;
+  }
+
+  snprintf(path, sizeof(path), "%s%sMETA.DAT", outdir, PATH_SEP);
+  open_output(path);
+  write_bin_file(&file_header, bin_items, records);
+
+  free(bin_items);
+  free(records);
+  return 0;
+}
+
+static int generate_card(const char *outdir, const gen_opts *opts) {
+  char path[FILENAME_MAX];
+  char name[128];
+  char folder[512];
+  gen_product *products = calloc(opts->count, sizeof(gen_product));
+  unsigned int num_products = 0;
+  unsigned int slot = 2;
+
+  if (!products) {
+    printf("%s no free memory\n", __func__);
+    return -1;
+  }
+
+  unsigned int folder_nodes = 0;
+  for (unsigned int i = 1, level = 1; i <= opts->depth; i++) {
+    level *= opts->fanout;
+    folder_nodes += level;
+  }
+  if (folder_nodes > MAX_FOLDER_NODES_READER) {
+    printf("Warn: up to %u folders possible, openMenu keeps the first %u\n", folder_nodes, MAX_FOLDER_NODES_READER);
+  }
+
+  /* Work out the product list first so num_items is known up front */
+  rng_state = opts->seed ? opts->seed : 1;
+  for (unsigned int games = 0; games < opts->count; num_products++) {
+    gen_product *prod = &products[num_products];
+    snprintf(prod->id, sizeof(prod->id), "T%05uN", num_products + 1);
+    prod->discs = (rng_range(100) < opts->multidisc_pct) ? 2 + rng_range(3) : 1;
+    if (games + prod->discs > opts->count) {
+      prod->discs = opts->count - games;
+    }
+    prod->has_art = rng_range(100) < opts->art_pct;
+    games += prod->discs;
+  }
+
+  snprintf(path, sizeof(path), "%s%sOPENMENU.INI", outdir, PATH_SEP);
+  FILE *ini_fd = fopen(path, "w");
+  if (!ini_fd) {
+    printf("ERR: unable to open %s for writing!\n", path);
+    free(products);
+    return -1;
+  }
+  ini_write_header(opts->count + 1, ini_fd);
+
+  for (unsigned int p = 0; p < num_products; p++) {
+    const gen_product *prod = &products[p];
+    const char *region = dist_pick(&opts->regions);
+    gen_words(name, opts->long_names ? 110 : 8 + rng_range(24), sizeof(name));
+    gen_folder(opts, folder, sizeof(folder));
+    const unsigned int year = 1998 + rng_range(10);
+
+    for (unsigned int disc = 1; disc <= prod->discs; disc++) {
+      fprintf(ini_fd,
+              "%02u.name=%s\n"
+              "%02u.disc=%u/%u\n"
+              "%02u.vga=%u\n"
+              "%02u.region=%s\n"
+              "%02u.version=V1.%03u\n"
+              "%02u.date=%04u%02u%02u\n"
+              "%02u.product=%s\n",
+              slot, name, slot, disc, prod->discs, slot, rng_range(2), slot, region, slot, rng_range(5), slot, year,
+              1 + rng_range(12), 1 + rng_range(28), slot, prod->id);
+      if (folder[0]) {
+        fprintf(ini_fd, "%02u.folder=%s\n", slot, folder);
+      }
+      fprintf(ini_fd, "\n");
+      slot++;
+    }
+  }
+  fclose(ini_fd);
+  printf("Wrote %u games (%u products) to %s\n", opts->count, num_products, path);
+
+  int ret = 0;
+  if (opts->write_dats) {
+    ret |= write_art_dat(outdir, "ICON.DAT", products, num_products, opts->icon_size);
+    ret |= write_art_dat(outdir, "BOX.DAT", products, num_products, opts->box_size);
+    ret |= write_meta_dat(outdir, opts, products, num_products);
+  }
+  free(products);
+  return ret;
+}
+
+static int generate_main(int argc, char **argv) {
+  gen_opts opts;
+  const char *outdir = NULL;
+
+  memset(&opts, 0, sizeof(opts));
+  opts.count = 1000;
+  opts.seed = 1;
+  opts.depth = 3;
+  opts.fanout = 6;
+  opts.multidisc_pct = 5;
+  opts.art_pct = 100;
+  opts.icon_size = 128;
+  opts.box_size = 256;
+  opts.write_dats = 1;
+  dist_parse(&opts.regions, "U=40,E=30,J=25,JUE=5");
+  dist_parse(&opts.genres, "Action,Racing,Simulation,Sports,Lightgun,Fighting,Shooter,Survival,Adventure,"
+                           "Platformer,RPG,Shmup,Strategy,Puzzle,Arcade,Music");
+
+  for (int i = 2; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+    if (!strcmp(arg, "-l")) {
+      opts.long_names = 1;
+    } else if (!strcmp(arg, "-x")) {
+      opts.write_dats = 0;
+    } else if (arg[0] == '-' && val) {
+      i++;
+      switch (arg[1]) {
+        case 'n': opts.count = (unsigned int)atoi(val); break;
+        case 's': opts.seed = strtoull(val, NULL, 10); break;
+        case 'd': opts.depth = (unsigned int)atoi(val); break;
+        case 'f': opts.fanout = (unsigned int)atoi(val); break;
+        case 'm': opts.multidisc_pct = (unsigned int)atoi(val); break;
+        case 'a': opts.art_pct = (unsigned int)atoi(val); break;
+        case 'i': opts.icon_size = (unsigned int)atoi(val); break;
+        case 'b': opts.box_size = (unsigned int)atoi(val); break;
+        case 'r':
+          if (dist_parse(&opts.regions, val)) {
+            return 1;
+          }
+          break;
+        case 'G':
+          if (dist_parse(&opts.genres, val)) {
+            return 1;
+          }
+          break;
+        default: printf("Unknown option %s\n", arg); return 1;
+      }
+    } else {
+      outdir = arg;
+    }
+  }
+
+  if (!outdir || !opts.count || !opts.fanout) {
+    printf("Incorrect usage!\n\t./menufaker -g [-n COUNT] [-s SEED] [-d DEPTH] [-f FANOUT] [-m PCT] [-l] [-r DIST] "
+           "[-G DIST] [-a PCT] [-i SIZE] [-b SIZE] [-x] OUTDIR\n");
+    return 1;
+  }
+  if ((opts.icon_size & (opts.icon_size - 1)) || (opts.box_size & (opts.box_size - 1))) {
+    printf("Err: art sizes must be a power of two!\n");
+    return 1;
+  }
+  return generate_card(outdir, &opts) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
 
 int main(int argc, char **argv) {
   if (argc < NUM_ARGS + 1 /*binary itself*/) {
-    printf("Incorrect usage!\n\t./menufaker filelist.csv\n");
+    printf("Incorrect usage!\n\t./menufaker filelist.csv\n\t./menufaker -g [options] OUTDIR\n");
     return 1;
   }
+  if (!strcmp(argv[1], "-g")) {
+    return generate_main(argc, argv);
+  }
 
   const char *csv_file = argv[1];
   char filename_temp[FILENAME_MAX];
@@ -0,0 +1,360 @@
+/*
+ * File: meta_text.c
+ * Project: tools
+ * File Created: Monday, 19th October 2026 1:12:40 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <uthash.h>
+
+#include "meta_text.h"
+
+/* Candidates are runs of up to MAX_RUN_TOKENS words, a word carries the space
+ * in front of it so " the" and " of the" come out as single entries */
+#define MAX_RUN_TOKENS (3)
+#define MAX_TEXT_LEN (1024)
+#define TRAIN_ROUNDS (3)
+
+typedef struct text_candidate {
+  const char *str;
+  uint32_t len;
+  uint32_t count;
+  UT_hash_handle hh;
+} text_candidate;
+
+typedef struct text_entry {
+  const char *str;
+  uint32_t len;
+  uint32_t uses;
+  int64_t score;
+} text_entry;
+
+typedef struct text_dict {
+  text_entry *entries;
+  uint32_t num_entries;
+  uint32_t *bucket_start; /* entries sorted by their first two bytes */
+  uint32_t *bucket_entries;
+} text_dict;
+
+static int is_word_char(char c) {
+  return isalnum((unsigned char)c) || c == '\'';
+}
+
+static int is_token_start(const char *text, uint32_t i) {
+  if (i == 0) {
+    return 1;
+  }
+  if (!is_word_char(text[i])) {
+    return 1;
+  }
+  return !is_word_char(text[i - 1]) && text[i - 1] != ' ';
+}
+
+static int literal_cost(uint8_t c) {
+  return (c >= 0x80 || (c >= DB_TEXT_LONG_FIRST && c <= DB_TEXT_ESCAPE)) ? 2 : 1;
+}
+
+static int code_cost(uint32_t entry) {
+  return entry < DB_TEXT_SHORT_CODES ? 1 : 2;
+}
+
+static int sort_by_score(const void *a, const void *b) {
+  const text_entry *ea = (const text_entry *)a;
+  const text_entry *eb = (const text_entry *)b;
+  if (ea->score != eb->score) {
+    return ea->score < eb->score ? 1 : -1;
+  }
+  if (ea->len != eb->len) {
+    return ea->len < eb->len ? 1 : -1;
+  }
+  return memcmp(ea->str, eb->str, ea->len);
+}
+
+static int count_candidates(const char *const *texts, uint32_t count, text_candidate **candidates) {
+  uint32_t starts[MAX_TEXT_LEN + 1];
+
+  for (uint32_t t = 0; t < count; t++) {
+    const char *text = texts[t];
+    const uint32_t len = strlen(text);
+    uint32_t num_starts = 0;
+
+    for (uint32_t i = 0; i < len && i < MAX_TEXT_LEN; i++) {
+      if (is_token_start(text, i)) {
+        starts[num_starts++] = i;
+      }
+    }
+    starts[num_starts] = len;
+
+    for (uint32_t s = 0; s < num_starts; s++) {
+      for (uint32_t run = 1; run <= MAX_RUN_TOKENS && s + run <= num_starts; run++) {
+        const uint32_t run_len = starts[s + run] - starts[s];
+        if (run_len > DB_TEXT_MAX_ENTRY) {
+          break;
+        }
+        if (run_len < 2) {
+          continue;
+        }
+        text_candidate *found;
+        HASH_FIND(hh, *candidates, text + starts[s], run_len, found);
+        if (!found) {
+          found = calloc(1, sizeof(text_candidate));
+          if (!found) {
+            printf("%s no free memory\n", __func__);
+            return -1;
+          }
+          found->str = text + starts[s];
+          found->len = run_len;
+          HASH_ADD_KEYPTR(hh, *candidates, found->str, found->len, found);
+        }
+        found->count++;
+      }
+    }
+  }
+  return 0;
+}
+
+static uint32_t bucket_key(const char *str) {
+  return (uint8_t)str[0] | ((uint32_t)(uint8_t)str[1] << 8);
+}
+
+static int dict_index(text_dict *dict) {
+  free(dict->bucket_start);
+  free(dict->bucket_entries);
+  dict->bucket_start = calloc(0x10000 + 1, sizeof(uint32_t));
+  dict->bucket_entries = malloc((dict->num_entries ? dict->num_entries : 1) * sizeof(uint32_t));
+  if (!dict->bucket_start || !dict->bucket_entries) {
+    printf("%s no free memory\n", __func__);
+    return -1;
+  }
+  for (uint32_t i = 0; i < dict->num_entries; i++) {
+    dict->bucket_start[bucket_key(dict->entries[i].str) + 1]++;
+  }
+  for (uint32_t b = 0; b < 0x10000; b++) {
+    dict->bucket_start[b + 1] += dict->bucket_start[b];
+  }
+  uint32_t *fill = malloc(0x10000 * sizeof(uint32_t));
+  if (!fill) {
+    printf("%s no free memory\n", __func__);
+    return -1;
+  }
+  memcpy(fill, dict->bucket_start, 0x10000 * sizeof(uint32_t));
+  for (uint32_t i = 0; i < dict->num_entries; i++) {
+    dict->bucket_entries[fill[bucket_key(dict->entries[i].str)]++] = i;
+  }
+  free(fill);
+  return 0;
+}
+
+/* Cheapest parse of text against dict, written to out when given and entry
+ * uses counted. Returns the encoded length including the end byte */
+static uint32_t encode_text(text_dict *dict, const char *text, uint8_t *out) {
+  const uint32_t len = strlen(text);
+  uint32_t cost[MAX_TEXT_LEN + 1];
+  int32_t choice[MAX_TEXT_LEN + 1];
+
+  if (len > MAX_TEXT_LEN) {
+    return 0;
+  }
+  cost[len] = 0;
+  for (int32_t i = (int32_t)len - 1; i >= 0; i--) {
+    cost[i] = literal_cost((uint8_t)text[i]) + cost[i + 1];
+    choice[i] = -1;
+    if (i + 1 >= (int32_t)len) {
+      continue;
+    }
+    const uint32_t key = bucket_key(text + i);
+    for (uint32_t b = dict->bucket_start[key]; b < dict->bucket_start[key + 1]; b++) {
+      const uint32_t e = dict->bucket_entries[b];
+      const text_entry *entry = &dict->entries[e];
+      if (entry->len > len - i || memcmp(entry->str, text + i, entry->len)) {
+        continue;
+      }
+      const uint32_t c = code_cost(e) + cost[i + entry->len];
+      if (c < cost[i]) {
+        cost[i] = c;
+        choice[i] = (int32_t)e;
+      }
+    }
+  }
+
+  uint32_t written = 0;
+  for (uint32_t i = 0; i < len;) {
+    if (choice[i] < 0) {
+      const uint8_t c = (uint8_t)text[i++];
+      if (literal_cost(c) == 2) {
+        if (out) {
+          out[written] = DB_TEXT_ESCAPE;
+        }
+        written++;
+      }
+      if (out) {
+        out[written] = c;
+      }
+      written++;
+      continue;
+    }
+    const uint32_t e = (uint32_t)choice[i];
+    if (e < DB_TEXT_SHORT_CODES) {
+      if (out) {
+        out[written] = (uint8_t)(0x80 + e);
+      }
+      written++;
+    } else {
+      if (out) {
+        out[written] = (uint8_t)(DB_TEXT_LONG_FIRST + (e - DB_TEXT_SHORT_CODES) / 256);
+        out[written + 1] = (uint8_t)((e - DB_TEXT_SHORT_CODES) % 256);
+      }
+      written += 2;
+    }
+    dict->entries[e].uses++;
+    i += dict->entries[e].len;
+  }
+  if (out) {
+    out[written] = DB_TEXT_END;
+  }
+  return written + 1;
+}
+
+/* Recount what the parse actually used and rebuild the dictionary from that:
+ * the most used entries get the one byte codes, anything that no longer pays
+ * for its own bytes is dropped */
+static void dict_refine(text_dict *dict, const char *const *texts, uint32_t count) {
+  for (uint32_t i = 0; i < dict->num_entries; i++) {
+    dict->entries[i].uses = 0;
+  }
+  for (uint32_t t = 0; t < count; t++) {
+    encode_text(dict, texts[t], NULL);
+  }
+  for (uint32_t i = 0; i < dict->num_entries; i++) {
+    dict->entries[i].score = dict->entries[i].uses;
+  }
+  qsort(dict->entries, dict->num_entries, sizeof(text_entry), sort_by_score);
+
+  uint32_t kept = 0;
+  for (uint32_t i = 0; i < dict->num_entries; i++) {
+    const text_entry *entry = &dict->entries[i];
+    const int64_t saved = (int64_t)entry->uses * ((int64_t)entry->len - code_cost(kept)) - entry->len;
+    if (saved > 0) {
+      dict->entries[kept++] = *entry;
+    }
+  }
+  dict->num_entries = kept;
+}
+
+int meta_text_build(const char *const *texts, uint32_t count, meta_text_block *block) {
+  text_candidate *candidates = NULL, *iter, *tmp;
+  text_dict dict = {0};
+  int ret = -1;
+
+  memset(block, 0, sizeof(meta_text_block));
+  if (count_candidates(texts, count, &candidates)) {
+    goto cleanup;
+  }
+
+  /* First cut assumes every entry costs two bytes */
+  dict.entries = malloc((HASH_COUNT(candidates) + 1) * sizeof(text_entry));
+  if (!dict.entries) {
+    printf("%s no free memory\n", __func__);
+    goto cleanup;
+  }
+  HASH_ITER(hh, candidates, iter, tmp) {
+    const int64_t score = (int64_t)iter->count * ((int64_t)iter->len - 2) - iter->len;
+    if (score > 0) {
+      dict.entries[dict.num_entries++] = (text_entry){iter->str, iter->len, 0, score};
+    }
+  }
+  qsort(dict.entries, dict.num_entries, sizeof(text_entry), sort_by_score);
+  uint32_t strings_size = 0;
+  for (uint32_t i = 0; i < dict.num_entries; i++) {
+    if (i == DB_TEXT_MAX_ENTRIES || strings_size + dict.entries[i].len > 0xFFFF) {
+      dict.num_entries = i;
+      break;
+    }
+    strings_size += dict.entries[i].len;
+  }
+
+  for (int round = 0; round < TRAIN_ROUNDS; round++) {
+    if (dict_index(&dict)) {
+      goto cleanup;
+    }
+    dict_refine(&dict, texts, count);
+  }
+  if (dict_index(&dict)) {
+    goto cleanup;
+  }
+
+  /* Dictionary */
+  block->offsets = malloc((dict.num_entries + 1) * sizeof(uint16_t));
+  block->strings = malloc(strings_size ? strings_size : 1);
+  block->text_offsets = malloc((count ? count : 1) * sizeof(uint32_t));
+  if (!block->offsets || !block->strings || !block->text_offsets) {
+    printf("%s no free memory\n", __func__);
+    goto cleanup;
+  }
+  memcpy(block->header.magic, DB_TEXT_MAGIC, 4);
+  block->header.num_entries = dict.num_entries;
+  block->header.dict_size = 0;
+  for (uint32_t i = 0; i < dict.num_entries; i++) {
+    block->offsets[i] = (uint16_t)block->header.dict_size;
+    memcpy(block->strings + block->header.dict_size, dict.entries[i].str, dict.entries[i].len);
+    block->header.dict_size += dict.entries[i].len;
+  }
+  block->offsets[dict.num_entries] = (uint16_t)block->header.dict_size;
+
+  /* Descriptions, worst case every byte escaped */
+  uint32_t data_max = 0;
+  for (uint32_t t = 0; t < count; t++) {
+    data_max += strlen(texts[t]) * 2 + 1;
+  }
+  block->data = malloc(data_max ? data_max : 1);
+  if (!block->data) {
+    printf("%s no free memory\n", __func__);
+    goto cleanup;
+  }
+  for (uint32_t t = 0; t < count; t++) {
+    block->text_offsets[t] = block->header.data_size;
+    block->header.data_size += encode_text(&dict, texts[t], block->data + block->header.data_size);
+  }
+
+  uint32_t text_size = 0;
+  for (uint32_t t = 0; t < count; t++) {
+    text_size += strlen(texts[t]) + 1;
+  }
+  printf("TEXT: %u entries (%u bytes), %u -> %u bytes of descriptions\n", block->header.num_entries,
+         block->header.dict_size, text_size, block->header.data_size);
+  ret = 0;
+
+cleanup:
+  HASH_ITER(hh, candidates, iter, tmp) {
+    HASH_DEL(candidates, iter);
+    free(iter);
+  }
+  free(dict.entries);
+  free(dict.bucket_start);
+  free(dict.bucket_entries);
+  if (ret) {
+    meta_text_free(block);
+  }
+  return ret;
+}
+
+void meta_text_write(const meta_text_block *block, FILE *out) {
+  fwrite(&block->header, sizeof(db_text_header), 1, out);
+  fwrite(block->offsets, sizeof(uint16_t), block->header.num_entries + 1, out);
+  fwrite(block->strings, block->header.dict_size, 1, out);
+  fwrite(block->data, block->header.data_size, 1, out);
+}
+
+void meta_text_free(meta_text_block *block) {
+  free(block->offsets);
+  free(block->strings);
+  free(block->data);
+  free(block->text_offsets);
+  memset(block, 0, sizeof(meta_text_block));
+}
@@ -0,0 +1,30 @@
+/*
+ * File: meta_text.h
+ * Project: tools
+ * File Created: Monday, 19th October 2026 1:12:40 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <backend/db_text.h>
+
+/* META.DAT v2 description block as laid out in db_text.h */
+typedef struct meta_text_block {
+  db_text_header header;
+  uint16_t *offsets; /* num_entries + 1 */
+  char *strings;
+  uint8_t *data;
+  uint32_t *text_offsets; /* start of each input text in data */
+} meta_text_block;
+
+/* Trains the dictionary over all texts and encodes them in order */
+int meta_text_build(const char *const *texts, uint32_t count, meta_text_block *block);
+void meta_text_write(const meta_text_block *block, FILE *out);
+void meta_text_free(meta_text_block *block);
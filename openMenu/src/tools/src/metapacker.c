@@ -21,22 +21,37 @@
 
 #include <backend/db_item.h>
 #include <ini.h>
+#include <uthash.h>
 
 #include "dat_packer_interface.h"
+#include "meta_text.h"
 
 /* Called:
-./metapack FOLDER output.dat
-
-packs the items in the folder into the output.dat
+./metapack [-1] FOLDER output.dat
+./metapack [-1] -t input.tsv output.dat
+./metapack [-1] -d input.dat output.dat
+
+packs the items in the folder into the output.dat, or with -t reads the
+metadata sheet directly (same columns tsv2ini expects) in a single pass, or
+with -d repacks an existing META.DAT.
+Writes v2 with the descriptions compressed (backend/db_text.h) unless -1 is
+given for the old fixed size records
 */
 
 #define NUM_ARGS (2)
+#define TSV_COLUMNS (9)
 
 /* Locals */
 static bin_header file_header;
 static bin_item_raw *bin_items;
 static unsigned char *data_buf;
 
+typedef struct tsv_id {
+  char ID[12];
+  uint32_t index;
+  UT_hash_handle hh;
+} tsv_id;
+
 static inline long int filelen(FILE *f) {
   long int end;
   fseek(f, 0, SEEK_END);
@@ -272,9 +287,281 @@ int add_bin_file(const char *path, const char *folder, struct stat *statptr) {
   return 0;
 }
 
+/* Returns the next tab separated field and advances cursor, NULL once the line is used up */
+static char *tsv_next_field(char **cursor) {
+  char *field = *cursor;
+  if (!field) {
+    return NULL;
+  }
+  char *tab = strchr(field, '\t');
+  if (tab) {
+    *tab = '\0';
+    *cursor = tab + 1;
+  } else {
+    *cursor = NULL;
+  }
+  return field;
+}
+
+static const char *tsv_default(const char *field) {
+  return (field && field[0]) ? field : "0";
+}
+
+/* Same cleanup the INI route ended up with: no line ending, no wrapping quotes, no outer whitespace */
+static char *tsv_clean_synopsis(char *synopsis) {
+  size_t len = strlen(synopsis);
+  while (len && (synopsis[len - 1] == '\r' || synopsis[len - 1] == '\n' || isspace((unsigned char)synopsis[len - 1]))) {
+    synopsis[--len] = '\0';
+  }
+  while (isspace((unsigned char)*synopsis)) {
+    synopsis++;
+    len--;
+  }
+  if (synopsis[0] == '"') {
+    synopsis++;
+    len--;
+    if (len && synopsis[len - 1] == '"') {
+      synopsis[--len] = '\0';
+    }
+  }
+  return synopsis;
+}
+
+static int tsv_parse_row(char *line, db_item *item, char *id) {
+  char *cursor = line;
+  char *fields[TSV_COLUMNS];
+  int num_fields;
+
+  /* Region | Players | VMU Blocks | Genre | Network | Accesories | Product ID | Name | Synopsis */
+  for (num_fields = 0; num_fields < TSV_COLUMNS; num_fields++) {
+    fields[num_fields] = tsv_next_field(&cursor);
+    if (!fields[num_fields]) {
+      break;
+    }
+  }
+  if (num_fields < 7 || !fields[6][0]) {
+    return -1;
+  }
+
+  meta_init_item(item);
+  item->num_players = (unsigned char)atoi(tsv_default(fields[1]));
+  item->vmu_blocks = (unsigned char)atoi(tsv_default(fields[2]));
+  item->genre = meta_parse_genre(tsv_default(fields[3]));
+  item->network = 0; /* Never carried over from the sheet, matches tsv2ini */
+  item->accessories = meta_parse_accessories(tsv_default(fields[5]));
+
+  const char *synopsis = (num_fields > 8) ? tsv_clean_synopsis(fields[8]) : "";
+  synopsis = synopsis[0] ? synopsis : "0";
+  if (strlen(synopsis) >= sizeof(item->description)) {
+    printf("META: Truncating description for %s\n", fields[6]);
+  }
+  strncpy(item->description, synopsis, sizeof(item->description) - 1);
+  item->description[sizeof(item->description) - 1] = '\0';
+
+  /* Same ID rules as the folder route: uppercase, max 10 chars */
+  memset(id, '\0', 12);
+  strncpy(id, fields[6], 10);
+  for (char *c = id; *c; c++) {
+    *c = toupper(*c);
+  }
+  return 0;
+}
+
+static int add_tsv_file(const char *tsv_file) {
+  FILE *tsv_fd = fopen(tsv_file, "rb");
+  if (!tsv_fd) {
+    printf("TSV:Error opening %s!\n", tsv_file);
+    return -1;
+  }
+
+  tsv_id *ids = NULL;
+  uint32_t capacity = 0;
+  char line[4096];
+  db_item record;
+  char temp_id[12];
+  int line_num = 0;
+
+  file_header.chunk_size = sizeof(db_item);
+  while (fgets(line, sizeof(line), tsv_fd)) {
+    line_num++;
+    if (!strchr(line, '\n') && !feof(tsv_fd)) {
+      /* Overlong row, keep what fits (description is capped anyway) and drop the rest */
+      int c;
+      while ((c = fgetc(tsv_fd)) != EOF && c != '\n')
+        ;
+    }
+    if (tsv_parse_row(line, &record, temp_id)) {
+      printf("TSV: Skipping line %d, no product id\n", line_num);
+      continue;
+    }
+
+    /* Later rows replace earlier ones, same as tsv2ini overwriting the INI */
+    tsv_id *found;
+    HASH_FIND_STR(ids, temp_id, found);
+    if (found) {
+      memcpy(data_buf + found->index * file_header.chunk_size, &record, sizeof(db_item));
+      continue;
+    }
+
+    if (file_header.num_chunks == capacity) {
+      capacity = capacity ? capacity * 2 : 1024;
+      data_buf = realloc(data_buf, capacity * file_header.chunk_size);
+      bin_items = realloc(bin_items, capacity * sizeof(bin_item_raw));
+      if (!data_buf || !bin_items) {
+        printf("%s no free memory\n", __func__);
+        fclose(tsv_fd);
+        return -1;
+      }
+    }
+    found = malloc(sizeof(tsv_id));
+    memcpy(found->ID, temp_id, sizeof(found->ID));
+    found->index = file_header.num_chunks;
+    HASH_ADD_STR(ids, ID, found);
+
+    memcpy(data_buf + file_header.num_chunks * file_header.chunk_size, &record, sizeof(db_item));
+    memcpy(&bin_items[file_header.num_chunks].ID, temp_id, sizeof(bin_items->ID));
+    (void)file_header.num_chunks++;
+  }
+  fclose(tsv_fd);
+
+  tsv_id *iter, *tmp;
+  HASH_ITER(hh, ids, iter, tmp) {
+    HASH_DEL(ids, iter);
+    free(iter);
+  }
+
+  /* Header size is only known now, fix up offsets once */
+  const uint32_t total_header_size = sizeof(bin_header) + (file_header.num_chunks * sizeof(bin_item_raw));
+  file_header.padding0 = total_header_size / file_header.chunk_size;
+  for (uint32_t i = 0; i < file_header.num_chunks; i++) {
+    bin_items[i].offset = file_header.padding0 + i + 1;
+  }
+
+  printf("TSV: Read %d lines, %u records, %u header chunks\n", line_num, file_header.num_chunks,
+         file_header.padding0 + 1);
+  return 0;
+}
+
+/* Reads back full records from a META.DAT of either version */
+static int add_dat_file(const char *dat_file) {
+  FILE *dat_fd = fopen(dat_file, "rb");
+  if (!dat_fd) {
+    printf("DAT:Error opening %s!\n", dat_file);
+    return -1;
+  }
+  const long int dat_size = filelen(dat_fd);
+  unsigned char *dat_buf = malloc(dat_size);
+  if (!dat_buf || fread(dat_buf, dat_size, 1, dat_fd) != 1) {
+    printf("DAT:Error reading %s!\n", dat_file);
+    fclose(dat_fd);
+    free(dat_buf);
+    return -1;
+  }
+  fclose(dat_fd);
+
+  const bin_header *header = (const bin_header *)dat_buf;
+  const int version = header->magic.rich.version;
+  if ((version != 1 && version != 2) || header->chunk_size != (version == 2 ? sizeof(db_item_v2) : sizeof(db_item))) {
+    printf("DAT:Error %s is not a META.DAT!\n", dat_file);
+    free(dat_buf);
+    return -1;
+  }
+  const bin_item_raw *items = (const bin_item_raw *)(dat_buf + sizeof(bin_header));
+  const uint32_t num_chunks = header->num_chunks;
+  const uint32_t first_offset = num_chunks ? items[0].offset : 0;
+
+  /* v2 keeps the dictionary and text after the last record */
+  db_text_dict dict = {0};
+  const uint8_t *text_data = NULL;
+  const uint8_t *text_end = NULL;
+  if (version == 2) {
+    const db_text_header *text_header = (const db_text_header *)(dat_buf + (first_offset + num_chunks) * header->chunk_size);
+    dict.offsets = (const uint16_t *)(text_header + 1);
+    dict.strings = (const char *)(dict.offsets + text_header->num_entries + 1);
+    dict.num_entries = text_header->num_entries;
+    text_data = (const uint8_t *)dict.strings + text_header->dict_size;
+    text_end = text_data + text_header->data_size;
+  }
+
+  data_buf = malloc((num_chunks ? num_chunks : 1) * sizeof(db_item));
+  bin_items = malloc((num_chunks ? num_chunks : 1) * sizeof(bin_item_raw));
+  if (!data_buf || !bin_items) {
+    printf("%s no free memory\n", __func__);
+    free(dat_buf);
+    return -1;
+  }
+  file_header.chunk_size = sizeof(db_item);
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    const unsigned char *chunk = dat_buf + items[i].offset * header->chunk_size;
+    db_item *record = (db_item *)(data_buf + i * sizeof(db_item));
+    if (version == 2) {
+      const db_item_v2 *packed = (const db_item_v2 *)chunk;
+      memset(record, 0, sizeof(db_item));
+      memcpy(record, &packed->hot, sizeof(db_item_hot));
+      db_text_decode(&dict, text_data + packed->description, text_end, record->description, sizeof(record->description));
+    } else {
+      memcpy(record, chunk, sizeof(db_item));
+    }
+    memcpy(&bin_items[i], &items[i], sizeof(bin_item_raw));
+  }
+  file_header.num_chunks = num_chunks;
+  free(dat_buf);
+
+  const uint32_t total_header_size = sizeof(bin_header) + (file_header.num_chunks * sizeof(bin_item_raw));
+  file_header.padding0 = total_header_size / file_header.chunk_size;
+  for (uint32_t i = 0; i < file_header.num_chunks; i++) {
+    bin_items[i].offset = file_header.padding0 + i + 1;
+  }
+
+  printf("DAT: Read %u records from v%d %s\n", num_chunks, version, dat_file);
+  return 0;
+}
+
+/* Swaps the fixed size records in data_buf for v2 ones, the descriptions go
+ * through the shared dictionary into text */
+static int pack_v2(meta_text_block *text) {
+  const char **descriptions = malloc((file_header.num_chunks ? file_header.num_chunks : 1) * sizeof(char *));
+  db_item_v2 *records = malloc((file_header.num_chunks ? file_header.num_chunks : 1) * sizeof(db_item_v2));
+  if (!descriptions || !records) {
+    printf("%s no free memory\n", __func__);
+    return -1;
+  }
+  for (uint32_t i = 0; i < file_header.num_chunks; i++) {
+    db_item *record = (db_item *)(data_buf + i * file_header.chunk_size);
+    record->description[sizeof(record->description) - 1] = '\0';
+    descriptions[i] = record->description;
+  }
+  if (meta_text_build(descriptions, file_header.num_chunks, text)) {
+    return -1;
+  }
+  for (uint32_t i = 0; i < file_header.num_chunks; i++) {
+    memcpy(&records[i].hot, data_buf + i * file_header.chunk_size, sizeof(db_item_hot));
+    records[i].description = text->text_offsets[i];
+  }
+  free(descriptions);
+  free(data_buf);
+  data_buf = (unsigned char *)records;
+
+  /* Smaller chunks, so the header takes more of them */
+  file_header.magic.rich.version = 2;
+  file_header.chunk_size = sizeof(db_item_v2);
+  const uint32_t total_header_size = sizeof(bin_header) + (file_header.num_chunks * sizeof(bin_item_raw));
+  file_header.padding0 = total_header_size / file_header.chunk_size;
+  for (uint32_t i = 0; i < file_header.num_chunks; i++) {
+    bin_items[i].offset = file_header.padding0 + i + 1;
+  }
+  return 0;
+}
+
 int main(int argc, char **argv) {
-  if (argc < NUM_ARGS + 1 /*binary itself*/) {
-    printf("Incorrect usage!\n\t./datpack FOLDER output.dat\n");
+  const int write_v1 = (argc > 1 && !strcmp(argv[1], "-1"));
+  argc -= write_v1;
+  argv += write_v1;
+  const int tsv_mode = (argc > 1 && !strcmp(argv[1], "-t"));
+  const int dat_mode = (argc > 1 && !strcmp(argv[1], "-d"));
+  if (argc < NUM_ARGS + 1 /*binary itself*/ + tsv_mode + dat_mode) {
+    printf("Incorrect usage!\n\t./metapack [-1] FOLDER output.dat\n\t./metapack [-1] -t input.tsv output.dat\n"
+           "\t./metapack [-1] -d input.dat output.dat\n");
     return 1;
   }
 
@@ -285,9 +572,45 @@ int main(int argc, char **argv) {
   file_header.num_chunks = 0;
   file_header.padding0 = 0;
 
-  open_output(argv[2]);
-  iterate_dir(argv[1], add_bin_file, &file_header, &bin_items);
+  const char *output;
+  if (tsv_mode || dat_mode) {
+    if ((tsv_mode ? add_tsv_file(argv[2]) : add_dat_file(argv[2])) || !file_header.num_chunks) {
+      return EXIT_FAILURE;
+    }
+    output = argv[3];
+  } else {
+    output = argv[2];
+    /* Opened up front so an unwritable output fails before the folder is read */
+    open_output(output);
+    iterate_dir(argv[1], add_bin_file, &file_header, &bin_items);
+  }
+
+  if (write_v1) {
+    if (tsv_mode || dat_mode) {
+      open_output(output);
+    }
+    write_bin_file(&file_header, bin_items, data_buf);
+    return EXIT_SUCCESS;
+  }
+
+  meta_text_block text;
+  if (!file_header.num_chunks || pack_v2(&text)) {
+    return EXIT_FAILURE;
+  }
+  if (tsv_mode || dat_mode) {
+    open_output(output);
+  }
   write_bin_file(&file_header, bin_items, data_buf);
 
+  /* Description block follows the last record */
+  FILE *out = fopen(output, "ab");
+  if (!out) {
+    printf("ERR: unable to open %s for writing!\n", output);
+    return EXIT_FAILURE;
+  }
+  meta_text_write(&text, out);
+  fclose(out);
+  meta_text_free(&text);
+
   return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
@@ -0,0 +1,559 @@
+/*
+ * File: openmenu_bench.c
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 7:12:31 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <arena.h>
+#include <backend/dat_format.h>
+#include <backend/db_list.h>
+#include <backend/gd_item.h>
+#include <backend/gd_list.h>
+#include <om_reader.h>
+#include <profiler.h>
+#include <texture/serial_sanitize.h>
+
+#include "lru.h"
+
+/* Called:
+./openmenu_bench [-i ITERATIONS] [-f json|csv] [-o OUTPUT] [-p PROFILE] [-v] CARD_DIR
+
+times the list, DAT and cache hot paths of the menu against a card directory,
+normally one generated with ./menufaker -g so runs are comparable between releases
+  -i ITERATIONS  timed runs per case after one warmup (default 50)
+  -f FORMAT      json (default) or csv
+  -o OUTPUT      write results here instead of stdout
+  -p PROFILE     write the frame profiler dump here, one frame per case, needs -DOPENMENU_PROFILER=ON
+  -v             keep the library output, it is sent to /dev/null otherwise
+
+CARD_DIR needs OPENMENU.INI and META.DAT, BOX.DAT is used for the DAT cases if present.
+Every case reports min/median/p99 nanoseconds per run, the allocations made per run and the
+file reads issued per run. The high water mark of every boot arena follows the results, on
+stderr for csv.
+*/
+
+#define DEFAULT_ITERATIONS (50)
+#define LRU_SLOTS          (16) /* Same as the icon pool */
+#define MAX_WALK_DEPTH     (8) /* Same as the folder tree */
+#define MAX_WALK_NAMES     (1024)
+
+/* Allocation counters, only live when the bench is linked with --wrap */
+static uint64_t alloc_count;
+static uint64_t alloc_bytes;
+static uint64_t free_count;
+
+#ifdef BENCH_WRAP_MALLOC
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t num, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+/* Only catches calls from objects linked into the bench, libc internals (strdup, fopen) are not seen */
+void *__wrap_malloc(size_t size) {
+  alloc_count++;
+  alloc_bytes += size;
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t num, size_t size) {
+  alloc_count++;
+  alloc_bytes += num * size;
+  return __real_calloc(num, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  alloc_count++;
+  alloc_bytes += size;
+  return __real_realloc(ptr, size);
+}
+
+void __wrap_free(void *ptr) {
+  if (ptr) {
+    free_count++;
+  }
+  __real_free(ptr);
+}
+#endif
+
+typedef struct bench_case {
+  const char *name;
+  void (*prepare)(void); /* untimed, before every run */
+  void (*run)(void);
+  unsigned int *ops; /* operations done by one run, NULL for 1 */
+} bench_case;
+
+typedef struct bench_result {
+  const char *name;
+  unsigned int ops;
+  uint64_t min_ns;
+  uint64_t median_ns;
+  uint64_t p99_ns;
+  double allocs;
+  double alloc_bytes;
+  double frees;
+  double reads; /* om_reader backend calls, the fs_read round trips on hardware */
+} bench_result;
+
+static int iterations = DEFAULT_ITERATIONS;
+
+static dat_file bench_dat;
+static arena_mark bench_dat_mark; /* ARENA_DAT before bench_dat, META.DAT stays below it */
+static const char *bench_dat_name;
+static char (*dat_hit_ids)[12];
+static char (*dat_miss_ids)[12];
+static unsigned int num_dat_ids;
+
+static char (*products)[12];
+static unsigned int num_products;
+
+static cache_instance lru;
+static unsigned int lru_used;
+
+static unsigned int ops_genre = 16;
+static unsigned int ops_filter_genre = 17;
+static unsigned int ops_filter_region = 4;
+static unsigned int ops_filter_letter = 27;
+static unsigned int ops_walk;
+static unsigned int ops_lru;
+static unsigned int ops_products;
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static int cmp_u64(const void *a, const void *b) {
+  const uint64_t ua = *(const uint64_t *)a;
+  const uint64_t ub = *(const uint64_t *)b;
+  return (ua > ub) - (ua < ub);
+}
+
+static void dat_release(dat_file *bin) {
+  HASH_CLEAR(hh, bin->hash);
+  arena_rewind(ARENA_DAT, bench_dat_mark);
+  if (bin->handle) {
+    fclose(bin->handle);
+  }
+  DAT_init(bin);
+}
+
+/* List */
+static void prep_list_read(void) {
+  list_folder_destroy();
+  list_destroy();
+}
+
+static void run_list_read(void) {
+  list_read("OPENMENU.INI");
+}
+
+static void run_folder_init(void) {
+  list_folder_init();
+}
+
+static void run_genre_sort(void) {
+  for (int genre = 0; genre < 16; genre++) {
+    list_set_genre_sort(genre, 1);
+  }
+}
+
+static void run_filter_genre(void) {
+  for (int num = 0; num <= 16; num++) {
+    list_set_sort_filter('G', num);
+  }
+}
+
+static void run_filter_region(void) {
+  for (int num = 0; num < 4; num++) {
+    list_set_sort_filter('R', num);
+  }
+}
+
+static void run_filter_letter(void) {
+  for (int num = 0; num < 27; num++) {
+    list_set_sort_filter('A', num);
+  }
+}
+
+/* Depth first walk of every visible folder the way the folders UI moves through them */
+static unsigned int folder_walk(void) {
+  static char names[MAX_WALK_DEPTH][MAX_WALK_NAMES][128];
+  unsigned int visited = 0;
+  const int depth = list_folder_get_depth();
+  int num_names = 0;
+
+  if (depth >= MAX_WALK_DEPTH) {
+    return 0;
+  }
+
+  /* Entering a folder reuses the list, grab this level's names first */
+  const gd_item **list = list_get();
+  for (int i = 0; i < list_length() && num_names < MAX_WALK_NAMES; i++) {
+    const gd_item *item = list[i];
+    const size_t len = strlen(item->name);
+    if (strcmp(item->disc, "DIR") || item->name[0] != '[' || !strcmp(item->name, "[..]") || len < 2) {
+      continue;
+    }
+    memcpy(names[depth][num_names], item->name + 1, len - 2);
+    names[depth][num_names][len - 2] = '\0';
+    num_names++;
+  }
+
+  for (int i = 0; i < num_names; i++) {
+    list_folder_enter(names[depth][i], i);
+    visited++;
+    if (list_folder_get_depth() > depth) {
+      visited += folder_walk();
+      list_folder_go_back();
+      visited++;
+    }
+  }
+  return visited;
+}
+
+static void run_folder_walk(void) {
+  list_set_folder_root();
+  ops_walk = folder_walk() + 1;
+}
+
+/* DAT */
+static void prep_dat_load(void) {
+  dat_release(&bench_dat);
+}
+
+static void run_dat_load(void) {
+  DAT_load_parse(&bench_dat, bench_dat_name, DAT_VERSION_META);
+}
+
+static void run_dat_hit(void) {
+  for (unsigned int i = 0; i < num_dat_ids; i++) {
+    DAT_get_offset_by_ID(&bench_dat, dat_hit_ids[i]);
+  }
+}
+
+static void run_dat_miss(void) {
+  for (unsigned int i = 0; i < num_dat_ids; i++) {
+    DAT_get_offset_by_ID(&bench_dat, dat_miss_ids[i]);
+  }
+}
+
+/* META.DAT descriptions, scrolling the list the way ui_line_desc reads and prefetches them */
+static void run_meta_scroll(void) {
+  db_item *meta;
+  for (unsigned int i = 0; i < num_products; i++) {
+    db_get_meta(products[i], &meta);
+    db_prefetch_meta(products[(i + 1) % num_products]);
+  }
+}
+
+/* LRU, stands in for the texture pool the same way txr_manager uses it */
+static unsigned int lru_add_cb(const char *key, void *user) {
+  (void)key;
+  (void)user;
+  for (unsigned int slot = 0; slot < LRU_SLOTS; slot++) {
+    if (!(lru_used & (1u << slot))) {
+      lru_used |= 1u << slot;
+      return slot;
+    }
+  }
+  return 0;
+}
+
+static unsigned int lru_del_cb(const char *key, void *value, void *user) {
+  (void)key;
+  (void)user;
+  lru_used &= ~(1u << *(unsigned int *)value);
+  return 0;
+}
+
+static void prep_lru(void) {
+  empty_cache(&lru);
+  lru_used = 0;
+}
+
+static void run_lru(void) {
+  /* Scroll down the whole list and back up, every title misses once per direction past the pool size */
+  for (unsigned int i = 0; i < num_products * 2; i++) {
+    const char *id = products[(i < num_products) ? i : (num_products * 2 - 1 - i)];
+    if (find_in_cache(&lru, id) == -1) {
+      add_to_cache(&lru, id, 0);
+      find_in_cache(&lru, id);
+    }
+  }
+}
+
+/* Serials, what list_read does per item to resolve art_id/meta_id */
+static void run_sanitize(void) {
+  static gd_item scratch;
+  for (unsigned int i = 0; i < num_products; i++) {
+    memcpy(scratch.product, products[i], sizeof(scratch.product));
+    serial_sanitize_item(&scratch);
+  }
+}
+
+static const bench_case cases[] = {
+    {"list_read", prep_list_read, run_list_read, NULL},
+    {"list_folder_init", list_folder_destroy, run_folder_init, NULL},
+    {"list_set_sort_default", NULL, list_set_sort_default, NULL},
+    {"list_set_sort_alphabetical", NULL, list_set_sort_alphabetical, NULL},
+    {"list_set_sort_name", NULL, list_set_sort_name, NULL},
+    {"list_set_sort_region", NULL, list_set_sort_region, NULL},
+    {"list_set_sort_genre", NULL, list_set_sort_genre, NULL},
+    {"list_set_genre_sort", NULL, run_genre_sort, &ops_genre},
+    {"list_set_sort_filter_genre", NULL, run_filter_genre, &ops_filter_genre},
+    {"list_set_sort_filter_region", NULL, run_filter_region, &ops_filter_region},
+    {"list_set_sort_filter_letter", NULL, run_filter_letter, &ops_filter_letter},
+    {"list_set_folder_root", NULL, list_set_folder_root, NULL},
+    {"list_set_folder_path_walk", NULL, run_folder_walk, &ops_walk},
+    {"DAT_load_parse", prep_dat_load, run_dat_load, NULL},
+    {"DAT_get_offset_by_ID_hit", NULL, run_dat_hit, &num_dat_ids},
+    {"DAT_get_offset_by_ID_miss", NULL, run_dat_miss, &num_dat_ids},
+    {"db_get_meta_scroll", NULL, run_meta_scroll, &ops_products},
+    {"lru_scroll", prep_lru, run_lru, &ops_lru},
+    {"serial_sanitize_item", NULL, run_sanitize, &ops_products},
+};
+#define NUM_CASES (sizeof(cases) / sizeof(cases[0]))
+
+static void bench_run(const bench_case *bc, uint64_t *samples, bench_result *res) {
+  uint64_t count, bytes, frees, reads;
+  const om_reader_stats *io = om_reader_get_stats();
+
+  /* Warmup, also fills in the op counts that depend on the card */
+  if (bc->prepare) {
+    bc->prepare();
+  }
+  bc->run();
+
+  count = bytes = frees = reads = 0;
+  for (int i = 0; i < iterations; i++) {
+    if (bc->prepare) {
+      bc->prepare();
+    }
+    const uint64_t a = alloc_count, b = alloc_bytes, f = free_count, r = io->reads;
+    const uint64_t start = now_ns();
+    bc->run();
+    samples[i] = now_ns() - start;
+    count += alloc_count - a;
+    bytes += alloc_bytes - b;
+    frees += free_count - f;
+    reads += io->reads - r;
+  }
+
+  qsort(samples, iterations, sizeof(uint64_t), cmp_u64);
+  res->name = bc->name;
+  res->ops = bc->ops ? *bc->ops : 1;
+  res->min_ns = samples[0];
+  res->median_ns = samples[iterations / 2];
+  res->p99_ns = samples[(iterations * 99 + 99) / 100 - 1];
+  res->allocs = (double)count / iterations;
+  res->alloc_bytes = (double)bytes / iterations;
+  res->frees = (double)frees / iterations;
+  res->reads = (double)reads / iterations;
+}
+
+static void write_json(FILE *out, const char *card, const bench_result *res, size_t num) {
+  fprintf(out, "{\n  \"card\": \"%s\",\n  \"items\": %d,\n  \"iterations\": %d,\n", card, list_length(), iterations);
+#ifdef BENCH_WRAP_MALLOC
+  fprintf(out, "  \"alloc_tracking\": true,\n");
+#else
+  fprintf(out, "  \"alloc_tracking\": false,\n");
+#endif
+  fprintf(out, "  \"results\": [\n");
+  for (size_t i = 0; i < num; i++) {
+    fprintf(out,
+            "    {\"name\": \"%s\", \"ops\": %u, \"min_ns\": %llu, \"median_ns\": %llu, \"p99_ns\": %llu, "
+            "\"allocs\": %.1f, \"alloc_bytes\": %.1f, \"frees\": %.1f, \"reads\": %.1f}%s\n",
+            res[i].name, res[i].ops, (unsigned long long)res[i].min_ns, (unsigned long long)res[i].median_ns,
+            (unsigned long long)res[i].p99_ns, res[i].allocs, res[i].alloc_bytes, res[i].frees, res[i].reads,
+            (i + 1 < num) ? "," : "");
+  }
+  fprintf(out, "  ],\n  \"arenas\": [\n");
+  for (int i = 0; i < ARENA_NUM; i++) {
+    const arena_stats *stats = arena_get_stats((ARENA_ID)i);
+    fprintf(out, "    {\"name\": \"%s\", \"high_water\": %lu, \"reserved\": %lu, \"blocks\": %u}%s\n",
+            arena_name((ARENA_ID)i), (unsigned long)stats->high_water, (unsigned long)stats->reserved,
+            (unsigned int)stats->blocks, (i + 1 < ARENA_NUM) ? "," : "");
+  }
+  fprintf(out, "  ]\n}\n");
+}
+
+/* Kept off the csv so it stays one table */
+static void write_arenas(FILE *out) {
+  for (int i = 0; i < ARENA_NUM; i++) {
+    const arena_stats *stats = arena_get_stats((ARENA_ID)i);
+    fprintf(out, "arena %-8s high_water %8lu reserved %8lu blocks %u\n", arena_name((ARENA_ID)i),
+            (unsigned long)stats->high_water, (unsigned long)stats->reserved, (unsigned int)stats->blocks);
+  }
+}
+
+static void write_csv(FILE *out, const bench_result *res, size_t num) {
+  fprintf(out, "name,ops,iterations,min_ns,median_ns,p99_ns,allocs,alloc_bytes,frees,reads\n");
+  for (size_t i = 0; i < num; i++) {
+    fprintf(out, "%s,%u,%d,%llu,%llu,%llu,%.1f,%.1f,%.1f,%.1f\n", res[i].name, res[i].ops, iterations,
+            (unsigned long long)res[i].min_ns, (unsigned long long)res[i].median_ns,
+            (unsigned long long)res[i].p99_ns, res[i].allocs, res[i].alloc_bytes, res[i].frees, res[i].reads);
+  }
+}
+
+/* Everything the cases read, done once outside of any timing */
+static int bench_setup(void) {
+  if (access("OPENMENU.INI", R_OK) || access("META.DAT", R_OK)) {
+    fprintf(stderr, "Err: card needs OPENMENU.INI and META.DAT!\n");
+    return -1;
+  }
+  serial_sanitizer_init();
+  db_load_DAT();
+
+  if (list_read("OPENMENU.INI")) {
+    fprintf(stderr, "Err: cant parse OPENMENU.INI!\n");
+    return -1;
+  }
+  list_set_sort_default();
+  num_products = list_length();
+  products = calloc(num_products ? num_products : 1, sizeof(*products));
+  if (!products) {
+    fprintf(stderr, "%s no free memory\n", __func__);
+    return -1;
+  }
+  for (unsigned int i = 0; i < num_products; i++) {
+    strncpy(products[i], list_item_get(i)->product, sizeof(products[i]) - 1);
+  }
+  ops_products = num_products;
+  ops_lru = num_products * 2;
+
+  bench_dat_name = access("BOX.DAT", R_OK) ? "META.DAT" : "BOX.DAT";
+  DAT_init(&bench_dat);
+  bench_dat_mark = arena_get_mark(ARENA_DAT);
+  if (DAT_load_parse(&bench_dat, bench_dat_name, DAT_VERSION_META)) {
+    fprintf(stderr, "Err: cant parse %s!\n", bench_dat_name);
+    return -1;
+  }
+  num_dat_ids = bench_dat.num_chunks;
+  dat_hit_ids = calloc(num_dat_ids ? num_dat_ids : 1, sizeof(*dat_hit_ids));
+  dat_miss_ids = calloc(num_dat_ids ? num_dat_ids : 1, sizeof(*dat_miss_ids));
+  if (!dat_hit_ids || !dat_miss_ids) {
+    fprintf(stderr, "%s no free memory\n", __func__);
+    return -1;
+  }
+  for (unsigned int i = 0; i < num_dat_ids; i++) {
+    memcpy(dat_hit_ids[i], bench_dat.items[i].ID, sizeof(dat_hit_ids[i]));
+    dat_hit_ids[i][11] = '\0';
+    /* Same length and prefix, lowercase never makes it into a DAT */
+    memcpy(dat_miss_ids[i], dat_hit_ids[i], sizeof(dat_miss_ids[i]));
+    dat_miss_ids[i][0] = 'x';
+  }
+
+  cache_set_size(&lru, LRU_SLOTS);
+  cache_callback_add(&lru, lru_add_cb);
+  cache_callback_del(&lru, lru_del_cb);
+  return 0;
+}
+
+static void print_usage(const char *prog) {
+  fprintf(stderr, "Usage: %s [-i ITERATIONS] [-f json|csv] [-o OUTPUT] [-p PROFILE] [-v] CARD_DIR\n", prog);
+}
+
+int main(int argc, char **argv) {
+  const char *format = "json";
+  const char *output = NULL;
+  const char *profile = NULL;
+  const char *card = NULL;
+  int verbose = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-i") && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-f") && i + 1 < argc) {
+      format = argv[++i];
+    } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+      output = argv[++i];
+    } else if (!strcmp(argv[i], "-p") && i + 1 < argc) {
+      profile = argv[++i];
+    } else if (!strcmp(argv[i], "-v")) {
+      verbose = 1;
+    } else if (argv[i][0] != '-' && !card) {
+      card = argv[i];
+    } else {
+      print_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (!card || iterations < 1 || (strcmp(format, "json") && strcmp(format, "csv"))) {
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (profile && !PROFILER) {
+    fprintf(stderr, "Err: -p needs a build with -DOPENMENU_PROFILER=ON!\n");
+    return EXIT_FAILURE;
+  }
+
+  /* Results get their own stream so the menu code can keep printing away */
+  FILE *out = output ? fopen(output, "w") : fdopen(dup(STDOUT_FILENO), "w");
+  if (!out) {
+    fprintf(stderr, "Err: cant write %s!\n", output ? output : "stdout");
+    return EXIT_FAILURE;
+  }
+  FILE *prof_out = profile ? fopen(profile, "w") : NULL;
+  if (profile && !prof_out) {
+    fprintf(stderr, "Err: cant write %s!\n", profile);
+    fclose(out);
+    return EXIT_FAILURE;
+  }
+  if (chdir(card)) {
+    fprintf(stderr, "Err: cant enter %s!\n", card);
+    fclose(out);
+    return EXIT_FAILURE;
+  }
+  if (!verbose) {
+    const int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd != -1) {
+      fflush(stdout);
+      dup2(null_fd, STDOUT_FILENO);
+      close(null_fd);
+    }
+  }
+
+  bench_result results[NUM_CASES];
+  uint64_t *samples = malloc(iterations * sizeof(uint64_t));
+  if (!samples || bench_setup()) {
+    fclose(out);
+    return EXIT_FAILURE;
+  }
+
+  for (size_t i = 0; i < NUM_CASES; i++) {
+    fprintf(stderr, "%s\n", cases[i].name);
+    const uint32_t case_start_us = prof_now_us();
+    bench_run(&cases[i], samples, &results[i]);
+    PROF_MARK(cases[i].name, case_start_us, prof_now_us());
+    PROF_FRAME_END();
+  }
+
+  list_set_sort_default();
+  if (!strcmp(format, "csv")) {
+    write_csv(out, results, NUM_CASES);
+    write_arenas(stderr);
+  } else {
+    write_json(out, card, results, NUM_CASES);
+  }
+  fclose(out);
+  if (prof_out) {
+#if PROFILER
+    prof_dump(prof_out);
+#endif
+    fclose(prof_out);
+  }
+  free(samples);
+  return EXIT_SUCCESS;
+}
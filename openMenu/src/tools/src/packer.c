@@ -18,30 +18,108 @@
 #include <unistd.h>
 
 #include "dat_packer_interface.h"
+#include "pvr_image.h"
+#include "pvr_normalize.h"
+#include "pvr_quantize.h"
 
 /* Called:
-./datpack FOLDER output.dat
+./datpack [-s SIZE] [-p8|-p4] [-a] [-d] FOLDER output.dat
 
 packs the items in the folder into the output.bin
+
+Every texture is normalized on the way in: rectangle/stride layouts are
+re-twiddled, non power of two sizes are resampled up, VQ is kept as is and
+anything else (mipmaps, YUV, bump, raw palettized) is rejected.
+
+-s  : resample every texture to SIZE x SIZE, 128 for ICON.DAT and 256 for BOX.DAT
+      matches the texture pool slots exactly
+-p8 : quantize every texture to 8bpp palettized (64 colors, see PVR_PAL_SLOT_COLORS)
+-p4 : quantize every texture to 4bpp palettized (16 colors)
+-a  : keep alpha, palettes are stored as ARGB4444 instead of RGB565
+-d  : Floyd-Steinberg dither while quantizing
 */
 
 #define NUM_ARGS (2)
 
+/* Largest PVR texture plus header and palette */
+#define MAX_CHUNK_SIZE (1024 * 1024 * 2 + PVR_PAL_HDR_SIZE + 1024)
+
 /* Locals */
 static bin_header file_header;
 static bin_item_raw *bin_items;
 static unsigned char *data_buf;
+static unsigned char *scratch_buf;
+static quantize_opts quant_opts;
+static uint16_t slot_size;
+
+/* Builds the chunk for one source texture into out, returns its size or 0 on error */
+static uint32_t build_chunk(const char *file, unsigned char *out, size_t out_size) {
+  FILE *temp_fd = fopen(file, "rb");
+  if (!temp_fd) {
+    printf("ERR: cant read %s\n", file);
+    return 0;
+  }
+  fseek(temp_fd, 0, SEEK_END);
+  const long size = ftell(temp_fd);
+  fseek(temp_fd, 0, SEEK_SET);
+  unsigned char *data = malloc(size);
+  if (!data) {
+    printf("%s no free memory\n", __func__);
+    fclose(temp_fd);
+    return 0;
+  }
+  fread(data, size, 1, temp_fd);
+  fclose(temp_fd);
+
+  uint32_t ret = 0;
+  const int classify = pvr_normalize_classify(data, size);
+  if (classify == 0 && !quant_opts.px_format) {
+    ret = pvr_normalize_raw(data, size, out, out_size);
+  } else if (classify == 1) {
+    pvr_image img;
+    if (!pvr_image_decode(data, size, &img)) {
+      if (!pvr_normalize_image(&img, slot_size)) {
+        ret = quant_opts.px_format ? pvr_quantize(&img, &quant_opts, out) : pvr_normalize_encode(&img, out);
+      }
+      pvr_image_free(&img);
+    }
+  } else if (classify == 0) {
+    printf("Err: VQ textures can't be palettized!\n");
+  }
+  free(data);
+
+  if (!ret) {
+    printf("Err: unable to normalize %s\n", file);
+  }
+  return ret;
+}
 
 int add_pvr_file(const char *path, const char *folder, struct stat *statptr) {
   char temp_id[12];
   char temp_file[FILENAME_MAX];
+  (void)statptr;
+
+  temp_file[0] = '\0';
+  strcpy(temp_file, folder);
+  strcat(temp_file, PATH_SEP);
+  strcat(temp_file, path);
+
+  const uint32_t built = build_chunk(temp_file, scratch_buf, MAX_CHUNK_SIZE);
+  if (!built) {
+    return -1;
+  }
 
   if (file_header.chunk_size == 0) {
-    file_header.chunk_size = (uint32_t)statptr->st_size;
-    data_buf = malloc(file_header.chunk_size * file_header.padding0); /* Temporarily use padding0 as num_files */
+    const uint32_t num_files = file_header.padding0; /* Temporarily use padding0 as num_files */
+    file_header.chunk_size = built;
+    data_buf = malloc(file_header.chunk_size * num_files);
+
+    /* Smaller palettized chunks may need more than one chunk for the header */
+    const uint32_t total_header_size = sizeof(bin_header) + num_files * sizeof(bin_item_raw);
+    file_header.padding0 = total_header_size / file_header.chunk_size;
   } else {
-    if (statptr->st_size != file_header.chunk_size) {
-      printf("Err: Filesize mismatch for %s, found %lld vs %u!\n", path, statptr->st_size, file_header.chunk_size);
+    if (built != file_header.chunk_size) {
+      printf("Err: Size mismatch for %s, found %u vs %u!\n", path, built, file_header.chunk_size);
       return -1;
     }
   }
@@ -52,17 +130,7 @@ int add_pvr_file(const char *path, const char *folder, struct stat *statptr) {
     return -1;
   }
 
-  temp_file[0] = '\0';
-  strcpy(temp_file, folder);
-  strcat(temp_file, PATH_SEP);
-  strcat(temp_file, path);
-  FILE *temp_fd = fopen(temp_file, "rb");
-  if (!temp_fd) {
-    printf("ERR: cant read %s\n", temp_file);
-    return -1;
-  }
-  fread(data_buf + (file_header.num_chunks * file_header.chunk_size), file_header.chunk_size, 1, temp_fd);
-  fclose(temp_fd);
+  memcpy(data_buf + (file_header.num_chunks * file_header.chunk_size), scratch_buf, file_header.chunk_size);
 
   /* Use filename as ID, remove extension */
   printf("Working on %s\n", path);
@@ -82,7 +150,7 @@ int add_pvr_file(const char *path, const char *folder, struct stat *statptr) {
   temp_id[10] = '\0';
   memcpy(&bin_items[file_header.num_chunks].ID, temp_id, sizeof(bin_items->ID));
 
-  bin_items[file_header.num_chunks].offset = file_header.num_chunks + 1;
+  bin_items[file_header.num_chunks].offset = file_header.padding0 + file_header.num_chunks + 1;
   (void)file_header.num_chunks++;
 
   printf("Added[%u] as %s\n", file_header.num_chunks, temp_id);
@@ -90,8 +158,42 @@ int add_pvr_file(const char *path, const char *folder, struct stat *statptr) {
 }
 
 int main(int argc, char **argv) {
-  if (argc < NUM_ARGS + 1 /*binary itself*/) {
-    printf("Incorrect usage!\n\t./datpack FOLDER output.dat\n");
+  const char *args[NUM_ARGS];
+  int num_args = 0;
+
+  quant_opts.px_format = 0;
+  quant_opts.pal_format = PVR_PX_RGB565;
+  quant_opts.dither = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-p8")) {
+      quant_opts.px_format = PVR_PX_PAL8BPP;
+      quant_opts.colors = PVR_PAL_SLOT_COLORS;
+    } else if (!strcmp(argv[i], "-p4")) {
+      quant_opts.px_format = PVR_PX_PAL4BPP;
+      quant_opts.colors = PVR_PAL4_COLORS;
+    } else if (!strcmp(argv[i], "-a")) {
+      quant_opts.pal_format = PVR_PX_ARGB4444;
+    } else if (!strcmp(argv[i], "-d")) {
+      quant_opts.dither = 1;
+    } else if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      slot_size = (uint16_t)atoi(argv[++i]);
+      if (slot_size < 8 || slot_size > 1024 || (slot_size & (slot_size - 1))) {
+        printf("Err: slot size must be a power of two between 8 and 1024!\n");
+        return 1;
+      }
+    } else if (num_args < NUM_ARGS) {
+      args[num_args++] = argv[i];
+    }
+  }
+
+  if (num_args < NUM_ARGS) {
+    printf("Incorrect usage!\n\t./datpack [-s SIZE] [-p8|-p4] [-a] [-d] FOLDER output.dat\n");
+    return 1;
+  }
+
+  scratch_buf = malloc(MAX_CHUNK_SIZE);
+  if (!scratch_buf) {
+    printf("%s no free memory\n", __func__);
     return 1;
   }
 
@@ -102,9 +204,8 @@ int main(int argc, char **argv) {
   file_header.num_chunks = 0;
   file_header.padding0 = 0;
 
-  open_output(argv[2]);
-  iterate_dir(argv[1], add_pvr_file, &file_header, &bin_items);
-  file_header.padding0 = 0;
+  open_output(args[1]);
+  iterate_dir(args[0], add_pvr_file, &file_header, &bin_items);
   write_bin_file(&file_header, bin_items, data_buf);
 
   return EXIT_SUCCESS;
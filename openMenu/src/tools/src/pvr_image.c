@@ -0,0 +1,223 @@
+/*
+ * File: pvr_image.c
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 10:40:12 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pvr_image.h"
+
+static uint32_t twiddle_bits(uint32_t v) {
+  /* Spread the low 16 bits out to the even bit positions */
+  v &= 0xFFFF;
+  v = (v | (v << 8)) & 0x00FF00FF;
+  v = (v | (v << 4)) & 0x0F0F0F0F;
+  v = (v | (v << 2)) & 0x33333333;
+  v = (v | (v << 1)) & 0x55555555;
+  return v;
+}
+
+uint32_t pvr_twiddle_index(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+  const uint32_t side = (width < height) ? width : height;
+  const uint32_t mask = side - 1;
+  const uint32_t block = (width > height) ? (x / side) : (y / side);
+  return block * side * side + (twiddle_bits(y & mask) | (twiddle_bits(x & mask) << 1));
+}
+
+void pvr_twiddle_16bpp(const uint16_t *src, uint16_t *dst, uint32_t width, uint32_t height) {
+  const uint32_t side = (width < height) ? width : height;
+  const uint32_t mask = side - 1;
+  uint32_t tx[1024 / 2]; /* PVR textures top out at 1024 wide */
+
+  /* Column offsets for each even x, the odd x of the quad sits 2 texels later */
+  for (uint32_t x = 0; x < width; x += 2) {
+    tx[x / 2] = (twiddle_bits(x & mask) << 1) + ((width > height) ? (x / side) * side * side : 0);
+  }
+
+  for (uint32_t y = 0; y < height; y += 2) {
+    const uint16_t *row0 = src + y * width;
+    const uint16_t *row1 = row0 + width;
+    uint16_t *out = dst + twiddle_bits(y & mask) + ((width > height) ? 0 : (y / side) * side * side);
+    for (uint32_t x = 0; x < width; x += 2) {
+      uint16_t *quad = out + tx[x / 2];
+      quad[0] = row0[x];
+      quad[1] = row1[x];
+      quad[2] = row0[x + 1];
+      quad[3] = row1[x + 1];
+    }
+  }
+}
+
+uint32_t pvr_unpack_color(uint16_t c, uint8_t px_format) {
+  uint32_t a, r, g, b;
+  switch (px_format) {
+    case PVR_PX_ARGB1555:
+      a = (c & 0x8000) ? 0xFF : 0x00;
+      r = (c >> 10) & 0x1F;
+      g = (c >> 5) & 0x1F;
+      b = c & 0x1F;
+      r = (r << 3) | (r >> 2);
+      g = (g << 3) | (g >> 2);
+      b = (b << 3) | (b >> 2);
+      break;
+    case PVR_PX_ARGB4444:
+      a = ((c >> 12) & 0xF) * 0x11;
+      r = ((c >> 8) & 0xF) * 0x11;
+      g = ((c >> 4) & 0xF) * 0x11;
+      b = (c & 0xF) * 0x11;
+      break;
+    case PVR_PX_RGB565:
+    default:
+      a = 0xFF;
+      r = (c >> 11) & 0x1F;
+      g = (c >> 5) & 0x3F;
+      b = c & 0x1F;
+      r = (r << 3) | (r >> 2);
+      g = (g << 2) | (g >> 4);
+      b = (b << 3) | (b >> 2);
+      break;
+  }
+  return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+uint16_t pvr_pack_color(uint32_t argb, uint8_t px_format) {
+  const uint32_t a = (argb >> 24) & 0xFF;
+  const uint32_t r = (argb >> 16) & 0xFF;
+  const uint32_t g = (argb >> 8) & 0xFF;
+  const uint32_t b = argb & 0xFF;
+  switch (px_format) {
+    case PVR_PX_ARGB1555:
+      return (uint16_t)(((a >= 0x80) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3));
+    case PVR_PX_ARGB4444:
+      return (uint16_t)(((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4));
+    case PVR_PX_RGB565:
+    default:
+      return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+  }
+}
+
+void pvr_image_write_header(unsigned char *out, uint8_t px_format, uint8_t df_format, uint16_t width, uint16_t height,
+                            uint32_t data_size) {
+  const uint32_t pvrt_len = data_size + 8;
+  memset(out, 0, PVR_PAL_HDR_SIZE);
+  memcpy(out, "GBIX", 4);
+  out[4] = 8; /* GBIX payload length, global index left as 0 */
+  memcpy(out + 16, "PVRT", 4);
+  out[20] = pvrt_len & 0xFF;
+  out[21] = (pvrt_len >> 8) & 0xFF;
+  out[22] = (pvrt_len >> 16) & 0xFF;
+  out[23] = (pvrt_len >> 24) & 0xFF;
+  out[24] = px_format;
+  out[25] = df_format;
+  out[28] = width & 0xFF;
+  out[29] = width >> 8;
+  out[30] = height & 0xFF;
+  out[31] = height >> 8;
+}
+
+static int is_pow2(uint32_t v) {
+  return v && !(v & (v - 1));
+}
+
+int pvr_image_decode(const unsigned char *data, size_t size, pvr_image *img) {
+  const unsigned char *hdr = data;
+  memset(img, 0, sizeof(*img));
+
+  /* Same rules as the runtime reader, GBIX is optional */
+  if (size >= 16 && !memcmp(hdr, "GBIX", 4)) {
+    hdr += 16;
+    size -= 16;
+  }
+  if (size < 16 || memcmp(hdr, "PVRT", 4)) {
+    printf("Err: not a PVR texture!\n");
+    return -1;
+  }
+
+  img->px_format = hdr[8];
+  img->df_format = hdr[9];
+  img->width = hdr[12] | hdr[13] << 8;
+  img->height = hdr[14] | hdr[15] << 8;
+
+  const uint32_t texels = (uint32_t)img->width * img->height;
+  const unsigned char *src = hdr + 16;
+  int twiddled;
+
+  if (img->px_format != PVR_PX_ARGB1555 && img->px_format != PVR_PX_RGB565 && img->px_format != PVR_PX_ARGB4444) {
+    printf("Err: unsupported source color format 0x%02x!\n", img->px_format);
+    return -1;
+  }
+  switch (img->df_format) {
+    case PVR_DF_TWIDDLED:
+    case PVR_DF_RECT_TWIDDLED:
+      twiddled = 1;
+      if (!is_pow2(img->width) || !is_pow2(img->height)) {
+        printf("Err: twiddled texture with non power of two size %ux%u!\n", img->width, img->height);
+        return -1;
+      }
+      break;
+    case PVR_DF_RECT:
+    case PVR_DF_STRIDE:
+      twiddled = 0;
+      break;
+    default:
+      printf("Err: unsupported source layout 0x%02x!\n", img->df_format);
+      return -1;
+  }
+  if (size - 16 < texels * 2) {
+    printf("Err: truncated texture data!\n");
+    return -1;
+  }
+
+  img->argb = malloc(texels * sizeof(uint32_t));
+  if (!img->argb) {
+    printf("%s no free memory\n", __func__);
+    return -1;
+  }
+
+  for (uint32_t y = 0; y < img->height; y++) {
+    for (uint32_t x = 0; x < img->width; x++) {
+      const uint32_t idx = twiddled ? pvr_twiddle_index(x, y, img->width, img->height) : y * img->width + x;
+      const uint16_t c = src[idx * 2] | src[idx * 2 + 1] << 8;
+      img->argb[y * img->width + x] = pvr_unpack_color(c, img->px_format);
+    }
+  }
+  return 0;
+}
+
+int pvr_image_read(const char *path, pvr_image *img) {
+  FILE *fd = fopen(path, "rb");
+  if (!fd) {
+    printf("ERR: cant read %s\n", path);
+    return -1;
+  }
+  fseek(fd, 0, SEEK_END);
+  const long size = ftell(fd);
+  fseek(fd, 0, SEEK_SET);
+
+  unsigned char *data = malloc(size);
+  if (!data) {
+    printf("%s no free memory\n", __func__);
+    fclose(fd);
+    return -1;
+  }
+  const size_t got = fread(data, 1, size, fd);
+  fclose(fd);
+
+  int ret = pvr_image_decode(data, got, img);
+  free(data);
+  if (ret) {
+    printf("Err: while decoding %s\n", path);
+  }
+  return ret;
+}
+
+void pvr_image_free(pvr_image *img) {
+  free(img->argb);
+  img->argb = NULL;
+}
@@ -0,0 +1,43 @@
+/*
+ * File: pvr_image.h
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 10:40:12 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <texture/pvr_palette.h>
+
+/* Decoded PVR, always held as ARGB8888 row-major regardless of source layout */
+typedef struct pvr_image {
+  uint16_t width;
+  uint16_t height;
+  uint8_t px_format; /* PVR_PX_* of the source file */
+  uint8_t df_format; /* PVR_DF_* of the source file */
+  uint32_t *argb;
+} pvr_image;
+
+int pvr_image_read(const char *path, pvr_image *img);
+int pvr_image_decode(const unsigned char *data, size_t size, pvr_image *img);
+void pvr_image_free(pvr_image *img);
+
+/* Writes a GBIX+PVRT header (PVR_PAL_HDR_SIZE bytes) for data_size bytes of texture data */
+void pvr_image_write_header(unsigned char *out, uint8_t px_format, uint8_t df_format, uint16_t width, uint16_t height,
+                            uint32_t data_size);
+
+/* Texel index of (x,y) in PVR twiddled order, handles rectangles as a strip of squares */
+uint32_t pvr_twiddle_index(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+/* Bulk row-major -> twiddled copy of 16bpp texels, both sides must be power of two.
+ * Works on 2x2 quads so every store is 4 contiguous texels out of two source rows. */
+void pvr_twiddle_16bpp(const uint16_t *src, uint16_t *dst, uint32_t width, uint32_t height);
+
+uint16_t pvr_pack_color(uint32_t argb, uint8_t px_format);
+uint32_t pvr_unpack_color(uint16_t color, uint8_t px_format);
@@ -0,0 +1,162 @@
+/*
+ * File: pvr_normalize.c
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 2:14:50 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pvr_normalize.h"
+
+static uint16_t next_pow2(uint16_t v) {
+  uint16_t p = 8; /* smallest texture the PVR takes */
+  while (p < v) {
+    p <<= 1;
+  }
+  return p;
+}
+
+static uint32_t lerp_argb(uint32_t a, uint32_t b, uint32_t frac /* 0..256 */) {
+  uint32_t out = 0;
+  for (int shift = 0; shift < 32; shift += 8) {
+    const uint32_t ca = (a >> shift) & 0xFF;
+    const uint32_t cb = (b >> shift) & 0xFF;
+    out |= (((ca * (256 - frac) + cb * frac) >> 8) & 0xFF) << shift;
+  }
+  return out;
+}
+
+/* Stretching instead of padding keeps the menus' full 0..1 UVs valid */
+static int resample(pvr_image *img, uint16_t width, uint16_t height) {
+  uint32_t *argb = malloc((uint32_t)width * height * sizeof(uint32_t));
+  if (!argb) {
+    printf("%s no free memory\n", __func__);
+    return -1;
+  }
+
+  for (uint32_t y = 0; y < height; y++) {
+    /* Sample at texel centers, 8 fractional bits */
+    int32_t sy = (int32_t)(((2 * y + 1) * img->height * 128) / height) - 128;
+    sy = sy < 0 ? 0 : sy;
+    const uint32_t y0 = sy >> 8;
+    const uint32_t y1 = (y0 + 1 < img->height) ? y0 + 1 : y0;
+    const uint32_t fy = sy & 0xFF;
+    for (uint32_t x = 0; x < width; x++) {
+      int32_t sx = (int32_t)(((2 * x + 1) * img->width * 128) / width) - 128;
+      sx = sx < 0 ? 0 : sx;
+      const uint32_t x0 = sx >> 8;
+      const uint32_t x1 = (x0 + 1 < img->width) ? x0 + 1 : x0;
+      const uint32_t fx = sx & 0xFF;
+      const uint32_t top = lerp_argb(img->argb[y0 * img->width + x0], img->argb[y0 * img->width + x1], fx);
+      const uint32_t bot = lerp_argb(img->argb[y1 * img->width + x0], img->argb[y1 * img->width + x1], fx);
+      argb[y * width + x] = lerp_argb(top, bot, fy);
+    }
+  }
+
+  free(img->argb);
+  img->argb = argb;
+  img->width = width;
+  img->height = height;
+  return 0;
+}
+
+int pvr_normalize_image(pvr_image *img, uint16_t slot_size) {
+  const uint16_t width = slot_size ? slot_size : next_pow2(img->width);
+  const uint16_t height = slot_size ? slot_size : next_pow2(img->height);
+
+  if (width > 1024 || height > 1024) {
+    printf("Err: %ux%u is larger than the PVR can sample!\n", img->width, img->height);
+    return -1;
+  }
+  if (width == img->width && height == img->height) {
+    return 0;
+  }
+  printf("Resampling %ux%u -> %ux%u\n", img->width, img->height, width, height);
+  return resample(img, width, height);
+}
+
+uint32_t pvr_normalize_encode(const pvr_image *img, unsigned char *out) {
+  const uint32_t texels = (uint32_t)img->width * img->height;
+  uint16_t *linear = malloc(texels * sizeof(uint16_t));
+  if (!linear) {
+    printf("%s no free memory\n", __func__);
+    return 0;
+  }
+  for (uint32_t i = 0; i < texels; i++) {
+    linear[i] = pvr_pack_color(img->argb[i], img->px_format);
+  }
+
+  pvr_image_write_header(out, img->px_format, (img->width == img->height) ? PVR_DF_TWIDDLED : PVR_DF_RECT_TWIDDLED,
+                         img->width, img->height, texels * 2);
+  /* Chunk data is little endian on both ends, twiddle straight into place */
+  pvr_twiddle_16bpp(linear, (uint16_t *)(out + PVR_PAL_HDR_SIZE), img->width, img->height);
+  free(linear);
+
+  return pvr_normalize_chunk_size(img);
+}
+
+int pvr_normalize_classify(const unsigned char *data, size_t size) {
+  if (size >= 16 && !memcmp(data, "GBIX", 4)) {
+    data += 16;
+    size -= 16;
+  }
+  if (size < 16 || memcmp(data, "PVRT", 4)) {
+    printf("Err: not a PVR texture!\n");
+    return -1;
+  }
+
+  const uint8_t px_format = data[8];
+  const uint8_t df_format = data[9];
+  const uint16_t width = data[12] | data[13] << 8;
+  const uint16_t height = data[14] | data[15] << 8;
+
+  if (px_format != PVR_PX_ARGB1555 && px_format != PVR_PX_RGB565 && px_format != PVR_PX_ARGB4444) {
+    printf("Err: color format 0x%02x can't be used by the texture pools!\n", px_format);
+    return -1;
+  }
+  switch (df_format) {
+    case PVR_DF_TWIDDLED:
+    case PVR_DF_RECT_TWIDDLED:
+    case PVR_DF_RECT:
+    case PVR_DF_STRIDE:
+      return 1;
+    case PVR_DF_VQ:
+    case PVR_DF_SMALL_VQ:
+      /* Already twiddled and compressed, only needs a proper header */
+      if (width != height || (width & (width - 1))) {
+        printf("Err: VQ texture %ux%u is not a power of two square!\n", width, height);
+        return -1;
+      }
+      return 0;
+    default:
+      /* mipmapped, bmp-ish and everything else the pools would just waste space on */
+      printf("Err: layout 0x%02x can't be used by the texture pools!\n", df_format);
+      return -1;
+  }
+}
+
+uint32_t pvr_normalize_raw(const unsigned char *data, size_t size, unsigned char *out, size_t out_size) {
+  if (pvr_normalize_classify(data, size) != 0) {
+    return 0;
+  }
+  if (memcmp(data, "GBIX", 4)) {
+    if (size + 16 > out_size) {
+      return 0;
+    }
+    memset(out, 0, 16);
+    memcpy(out, "GBIX", 4);
+    out[4] = 8;
+    memcpy(out + 16, data, size);
+    return (uint32_t)size + 16;
+  }
+  if (size > out_size) {
+    return 0;
+  }
+  memcpy(out, data, size);
+  return (uint32_t)size;
+}
@@ -0,0 +1,35 @@
+/*
+ * File: pvr_normalize.h
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 2:14:50 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pvr_image.h"
+
+/* Every texture leaving the packer is twiddled (or twiddled VQ), power of two and
+ * carries the 0x20 byte GBIX+PVRT header the runtime expects at the start of a chunk. */
+
+/* Resamples img to the next power of two on each side, or to a fixed square slot size if non zero */
+int pvr_normalize_image(pvr_image *img, uint16_t slot_size);
+
+/* Encodes a normalized image as twiddled 16bpp in its source color format, returns bytes written */
+uint32_t pvr_normalize_encode(const pvr_image *img, unsigned char *out);
+static inline uint32_t pvr_normalize_chunk_size(const pvr_image *img) {
+  return PVR_PAL_HDR_SIZE + (uint32_t)img->width * img->height * 2;
+}
+
+/* Raw pass-through for layouts kept as is (VQ), fills in a missing GBIX.
+ * Returns bytes written to out (at most out_size) or 0 if the layout is unusable. */
+uint32_t pvr_normalize_raw(const unsigned char *data, size_t size, unsigned char *out, size_t out_size);
+
+/* 1 if the file has to be decoded and re-encoded, 0 for pass-through, -1 if it can never be used */
+int pvr_normalize_classify(const unsigned char *data, size_t size);
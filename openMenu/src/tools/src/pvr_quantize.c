@@ -0,0 +1,279 @@
+/*
+ * File: pvr_quantize.c
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 11:05:37 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pvr_quantize.h"
+
+/* Lloyd iterations run on top of the median-cut palette */
+#define KMEANS_PASSES (4)
+
+typedef struct qbox {
+  uint32_t start;
+  uint32_t count;
+  int channel; /* widest channel, as a shift amount */
+  int range;
+} qbox;
+
+static int sort_shift;
+
+static inline int channel(uint32_t argb, int shift) {
+  return (argb >> shift) & 0xFF;
+}
+
+static int cmp_channel(const void *a, const void *b) {
+  return channel(*(const uint32_t *)a, sort_shift) - channel(*(const uint32_t *)b, sort_shift);
+}
+
+static void box_measure(const uint32_t *px, qbox *box, int use_alpha) {
+  static const int shifts[4] = {16, 8, 0, 24};
+  box->range = -1;
+  for (int c = 0; c < (use_alpha ? 4 : 3); c++) {
+    int lo = 255, hi = 0;
+    for (uint32_t i = box->start; i < box->start + box->count; i++) {
+      const int v = channel(px[i], shifts[c]);
+      lo = v < lo ? v : lo;
+      hi = v > hi ? v : hi;
+    }
+    if (hi - lo > box->range) {
+      box->range = hi - lo;
+      box->channel = shifts[c];
+    }
+  }
+}
+
+static inline int color_dist(const int *a, uint32_t argb, int use_alpha) {
+  const int dr = a[1] - channel(argb, 16);
+  const int dg = a[2] - channel(argb, 8);
+  const int db = a[3] - channel(argb, 0);
+  int dist = 2 * dr * dr + 4 * dg * dg + 3 * db * db;
+  if (use_alpha) {
+    const int da = a[0] - channel(argb, 24);
+    dist += 3 * da * da;
+  }
+  return dist;
+}
+
+static unsigned int nearest(const int *argb, const uint32_t *pal, unsigned int colors, int use_alpha) {
+  unsigned int best = 0;
+  int best_dist = 0x7FFFFFFF;
+  for (unsigned int i = 0; i < colors; i++) {
+    const int dist = color_dist(argb, pal[i], use_alpha);
+    if (dist < best_dist) {
+      best_dist = dist;
+      best = i;
+    }
+  }
+  return best;
+}
+
+static inline void split_argb(uint32_t argb, int *out) {
+  out[0] = channel(argb, 24);
+  out[1] = channel(argb, 16);
+  out[2] = channel(argb, 8);
+  out[3] = channel(argb, 0);
+}
+
+/* Rounds a palette entry through the target format so matching sees the real output color */
+static uint32_t snap_color(uint32_t argb, uint8_t pal_format) {
+  return pvr_unpack_color(pvr_pack_color(argb, pal_format), pal_format);
+}
+
+static unsigned int build_palette(const pvr_image *img, const quantize_opts *opts, uint32_t *pal) {
+  const uint32_t texels = (uint32_t)img->width * img->height;
+  const int use_alpha = (opts->pal_format == PVR_PX_ARGB4444);
+  qbox boxes[256];
+  unsigned int num_boxes = 1;
+
+  uint32_t *px = malloc(texels * sizeof(uint32_t));
+  if (!px) {
+    printf("%s no free memory\n", __func__);
+    return 0;
+  }
+  memcpy(px, img->argb, texels * sizeof(uint32_t));
+
+  /* Median cut, always splitting the box with the widest single channel */
+  boxes[0].start = 0;
+  boxes[0].count = texels;
+  box_measure(px, &boxes[0], use_alpha);
+  while (num_boxes < opts->colors) {
+    int widest = -1;
+    for (unsigned int i = 0; i < num_boxes; i++) {
+      if (boxes[i].count > 1 && boxes[i].range > 0 && (widest < 0 || boxes[i].range > boxes[widest].range)) {
+        widest = (int)i;
+      }
+    }
+    if (widest < 0) {
+      break;
+    }
+    qbox *box = &boxes[widest];
+    sort_shift = box->channel;
+    qsort(px + box->start, box->count, sizeof(uint32_t), cmp_channel);
+
+    qbox *upper = &boxes[num_boxes++];
+    upper->start = box->start + box->count / 2;
+    upper->count = box->count - box->count / 2;
+    box->count /= 2;
+    box_measure(px, box, use_alpha);
+    box_measure(px, upper, use_alpha);
+  }
+
+  for (unsigned int i = 0; i < num_boxes; i++) {
+    uint64_t sum[4] = {0, 0, 0, 0};
+    for (uint32_t j = boxes[i].start; j < boxes[i].start + boxes[i].count; j++) {
+      sum[0] += channel(px[j], 24);
+      sum[1] += channel(px[j], 16);
+      sum[2] += channel(px[j], 8);
+      sum[3] += channel(px[j], 0);
+    }
+    const uint32_t n = boxes[i].count;
+    pal[i] = (uint32_t)(((sum[0] + n / 2) / n) << 24 | ((sum[1] + n / 2) / n) << 16 | ((sum[2] + n / 2) / n) << 8 |
+                        ((sum[3] + n / 2) / n));
+  }
+  free(px);
+
+  /* Short k-means refine, median cut alone leaves visible banding on gradients */
+  for (int pass = 0; pass < KMEANS_PASSES; pass++) {
+    uint64_t sum[256][4];
+    uint32_t count[256];
+    memset(sum, 0, sizeof(uint64_t) * 4 * num_boxes);
+    memset(count, 0, sizeof(uint32_t) * num_boxes);
+    for (uint32_t i = 0; i < texels; i++) {
+      int argb[4];
+      split_argb(img->argb[i], argb);
+      const unsigned int idx = nearest(argb, pal, num_boxes, use_alpha);
+      for (int c = 0; c < 4; c++) {
+        sum[idx][c] += argb[c];
+      }
+      count[idx]++;
+    }
+    for (unsigned int i = 0; i < num_boxes; i++) {
+      const uint32_t n = count[i];
+      if (!n) {
+        continue;
+      }
+      pal[i] = (uint32_t)(((sum[i][0] + n / 2) / n) << 24 | ((sum[i][1] + n / 2) / n) << 16 |
+                          ((sum[i][2] + n / 2) / n) << 8 | ((sum[i][3] + n / 2) / n));
+    }
+  }
+
+  for (unsigned int i = 0; i < num_boxes; i++) {
+    pal[i] = use_alpha ? snap_color(pal[i], opts->pal_format) : (snap_color(pal[i], opts->pal_format) | 0xFF000000);
+  }
+  return num_boxes;
+}
+
+static void map_pixels(const pvr_image *img, const quantize_opts *opts, const uint32_t *pal, unsigned int colors,
+                       unsigned char *indices) {
+  const int use_alpha = (opts->pal_format == PVR_PX_ARGB4444);
+  const uint32_t w = img->width;
+  int *err_cur = calloc((w + 2) * 4, sizeof(int));
+  int *err_next = calloc((w + 2) * 4, sizeof(int));
+
+  if (!err_cur || !err_next) {
+    printf("%s no free memory\n", __func__);
+    free(err_cur);
+    free(err_next);
+    return;
+  }
+
+  for (uint32_t y = 0; y < img->height; y++) {
+    memset(err_next, 0, (w + 2) * 4 * sizeof(int));
+    for (uint32_t x = 0; x < w; x++) {
+      int want[4];
+      split_argb(img->argb[y * w + x], want);
+      if (opts->dither) {
+        /* errors are kept in 1/16ths, clamp after adding */
+        for (int c = 0; c < 4; c++) {
+          int v = want[c] + err_cur[(x + 1) * 4 + c] / 16;
+          want[c] = v < 0 ? 0 : (v > 255 ? 255 : v);
+        }
+      }
+      const unsigned int idx = nearest(want, pal, colors, use_alpha);
+      indices[y * w + x] = (unsigned char)idx;
+
+      if (opts->dither) {
+        int got[4];
+        split_argb(pal[idx], got);
+        for (int c = 0; c < 4; c++) {
+          const int e = want[c] - got[c];
+          err_cur[(x + 2) * 4 + c] += e * 7;
+          err_next[(x + 0) * 4 + c] += e * 3;
+          err_next[(x + 1) * 4 + c] += e * 5;
+          err_next[(x + 2) * 4 + c] += e * 1;
+        }
+      }
+    }
+    int *tmp = err_cur;
+    err_cur = err_next;
+    err_next = tmp;
+  }
+  free(err_cur);
+  free(err_next);
+}
+
+uint32_t pvr_quantize_chunk_size(uint16_t width, uint16_t height, const quantize_opts *opts) {
+  return PVR_PAL_HDR_SIZE + pvr_pal_texel_size(width, height, opts->px_format) + pvr_pal_block_size(opts->colors);
+}
+
+uint32_t pvr_quantize(const pvr_image *img, const quantize_opts *opts, unsigned char *out) {
+  const uint32_t texels = (uint32_t)img->width * img->height;
+  const uint32_t texel_size = pvr_pal_texel_size(img->width, img->height, opts->px_format);
+  const uint32_t chunk_size = pvr_quantize_chunk_size(img->width, img->height, opts);
+  uint32_t pal[256];
+
+  if ((img->width & (img->width - 1)) || (img->height & (img->height - 1))) {
+    printf("Err: palettized textures must be twiddled, %ux%u is not a power of two!\n", img->width, img->height);
+    return 0;
+  }
+
+  const unsigned int colors = build_palette(img, opts, pal);
+  if (!colors) {
+    return 0;
+  }
+
+  unsigned char *indices = calloc(texels, 1);
+  if (!indices) {
+    printf("%s no free memory\n", __func__);
+    return 0;
+  }
+  map_pixels(img, opts, pal, colors, indices);
+
+  memset(out, 0, chunk_size);
+  pvr_image_write_header(out, opts->px_format,
+                         (img->width == img->height) ? PVR_DF_TWIDDLED : PVR_DF_RECT_TWIDDLED, img->width, img->height,
+                         texel_size);
+
+  unsigned char *texel_out = out + PVR_PAL_HDR_SIZE;
+  for (uint32_t y = 0; y < img->height; y++) {
+    for (uint32_t x = 0; x < img->width; x++) {
+      const uint32_t t = pvr_twiddle_index(x, y, img->width, img->height);
+      const unsigned char idx = indices[y * img->width + x];
+      if (opts->px_format == PVR_PX_PAL4BPP) {
+        texel_out[t / 2] |= (t & 1) ? (idx << 4) : idx;
+      } else {
+        texel_out[t] = idx;
+      }
+    }
+  }
+  free(indices);
+
+  /* Unused trailing entries stay zeroed, the block always carries opts->colors */
+  pvr_pal_block *block = (pvr_pal_block *)(texel_out + texel_size);
+  memcpy(block->magic, PVR_PAL_BLOCK_MAGIC, 4);
+  block->format = opts->pal_format;
+  block->num_colors = (uint16_t)opts->colors;
+  for (unsigned int i = 0; i < colors; i++) {
+    block->colors[i] = pvr_pack_color(pal[i], opts->pal_format);
+  }
+
+  return chunk_size;
+}
@@ -0,0 +1,29 @@
+/*
+ * File: pvr_quantize.h
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 11:05:37 am
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pvr_image.h"
+
+typedef struct quantize_opts {
+  uint8_t px_format;   /* PVR_PX_PAL4BPP or PVR_PX_PAL8BPP */
+  uint8_t pal_format;  /* PVR_PX_RGB565 or PVR_PX_ARGB4444 */
+  unsigned int colors; /* <= 16 for PAL4, <= PVR_PAL_SLOT_COLORS for PAL8 */
+  int dither;          /* Floyd-Steinberg error diffusion */
+} quantize_opts;
+
+/* Size of a full palettized chunk (header + indices + palette block) for the given opts */
+uint32_t pvr_quantize_chunk_size(uint16_t width, uint16_t height, const quantize_opts *opts);
+
+/* Median-cut + k-means refine, writes a complete palettized PVR to out, returns bytes used or 0 on error */
+uint32_t pvr_quantize(const pvr_image *img, const quantize_opts *opts, unsigned char *out);
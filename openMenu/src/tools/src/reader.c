@@ -86,7 +86,7 @@ int main(int argc, char **argv) {
   /* Basic Usage */
   dat_file input_bin;
   DAT_init(&input_bin);
-  DAT_load_parse(&input_bin, argv[1]);
+  DAT_load_parse(&input_bin, argv[1], DAT_VERSION_META);
 
   /* Dump info and files */
   if (dump_files) {
@@ -0,0 +1,495 @@
+/*
+ * File: remapgen.c
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 11:40:09 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <texture/serial_remap.h>
+#include <uthash.h>
+
+/* Called:
+./remapgen [-n] [-t RULES.TSV]... [-c TABLE.H] [REMAP.BIN]
+
+compiles the serial fixups and remaps into the perfect hash described in
+serial_remap.h, starting from the rules in serial_remap.def
+  -n            leave out the rules from serial_remap.def
+  -t RULES.TSV  extra rules, one per line, tab separated:
+                product, date, name_hint, fixed_product, art_serial, meta_serial
+                a later remap for the same product replaces the earlier one
+  -c TABLE.H    write the image as serial_remap_table.h for the built in table
+  REMAP.BIN     write the image for the disc, picked up by openMenu at boot
+
+Regenerate the built in table after editing serial_remap.def with:
+./remapgen -c ../openmenu_shared/src/texture/serial_remap_table.h
+*/
+
+#define MAX_FIXUPS_PER_KEY (8)
+
+typedef struct remap_key {
+  char product[SERIAL_REMAP_KEY_MAX];
+  const char *fixup_cond[MAX_FIXUPS_PER_KEY];
+  const char *fixup_fixed[MAX_FIXUPS_PER_KEY];
+  int fixup_is_name[MAX_FIXUPS_PER_KEY];
+  int num_fixups;
+  const char *art;
+  const char *meta;
+  int has_remap;
+  uint32_t hash;
+  uint32_t slot;
+  UT_hash_handle hh;
+} remap_key;
+
+typedef struct pool_str {
+  char *str;
+  uint32_t offset;
+  UT_hash_handle hh;
+} pool_str;
+
+static const struct {
+  const char *product, *date, *name_hint, *fixed, *art, *meta;
+} builtin_rules[] = {
+#define SERIAL_FIXUP(product, date, name_hint, fixed) {product, date, name_hint, fixed, "", ""},
+#define SERIAL_REMAP(product, art, meta) {product, "", "", "", art, meta},
+#include <texture/serial_remap.def>
+};
+
+static remap_key *keys = NULL;
+static unsigned int num_fixups = 0, num_remaps = 0;
+
+static char *pool = NULL;
+static uint32_t pool_size = 0, pool_cap = 0;
+static pool_str *pool_strs = NULL;
+
+static int rule_add(const char *product, const char *date, const char *name_hint, const char *fixed, const char *art,
+                    const char *meta, const char *origin) {
+  if (!product[0] || strlen(product) >= SERIAL_REMAP_KEY_MAX || strlen(fixed) >= SERIAL_REMAP_KEY_MAX) {
+    printf("Err: %s, serials have to be 1 to %d characters!\n", origin, SERIAL_REMAP_KEY_MAX - 1);
+    return -1;
+  }
+  if (fixed[0] ? (!date[0] == !name_hint[0] || art[0] || meta[0]) : (date[0] || name_hint[0] || (!art[0] && !meta[0]))) {
+    printf("Err: %s, a fixup needs a date or a name hint, a remap an art or meta serial!\n", origin);
+    return -1;
+  }
+
+  remap_key *key;
+  HASH_FIND_STR(keys, product, key);
+  if (!key) {
+    key = calloc(1, sizeof(remap_key));
+    if (!key) {
+      printf("%s no free memory\n", __func__);
+      return -1;
+    }
+    strcpy(key->product, product);
+    HASH_ADD_STR(keys, product, key);
+  }
+
+  if (fixed[0]) {
+    if (key->num_fixups == MAX_FIXUPS_PER_KEY) {
+      printf("Err: %s, more than %d fixups for %s!\n", origin, MAX_FIXUPS_PER_KEY, product);
+      return -1;
+    }
+    key->fixup_is_name[key->num_fixups] = !date[0];
+    key->fixup_cond[key->num_fixups] = strdup(date[0] ? date : name_hint);
+    key->fixup_fixed[key->num_fixups] = strdup(fixed);
+    key->num_fixups++;
+    num_fixups++;
+  } else {
+    if (!key->has_remap) {
+      num_remaps++;
+    }
+    key->art = strdup(art);
+    key->meta = strdup(meta);
+    key->has_remap = 1;
+  }
+  return 0;
+}
+
+static int rules_read_tsv(const char *filename) {
+  FILE *fd = fopen(filename, "r");
+  if (!fd) {
+    printf("Err: cant open %s!\n", filename);
+    return -1;
+  }
+
+  char line[512];
+  char origin[FILENAME_MAX + 16];
+  int line_num = 0, ret = 0;
+  while (fgets(line, sizeof(line), fd)) {
+    line_num++;
+    line[strcspn(line, "\r\n")] = '\0';
+    if (!line[0] || line[0] == '#') {
+      continue;
+    }
+
+    /* Missing trailing columns are empty */
+    const char *cols[6] = {"", "", "", "", "", ""};
+    char *p = line;
+    for (int c = 0; c < 6 && p; c++) {
+      cols[c] = p;
+      p = strchr(p, '\t');
+      if (p) {
+        *p++ = '\0';
+      }
+    }
+    snprintf(origin, sizeof(origin), "%s:%d", filename, line_num);
+    if (rule_add(cols[0], cols[1], cols[2], cols[3], cols[4], cols[5], origin)) {
+      ret = -1;
+    }
+  }
+  fclose(fd);
+  return ret;
+}
+
+/* Fixed serials are looked up again for their remap but never fixed twice */
+static int rules_check_chains(void) {
+  int ret = 0;
+  for (remap_key *key = keys; key; key = key->hh.next) {
+    for (int i = 0; i < key->num_fixups; i++) {
+      remap_key *target;
+      HASH_FIND_STR(keys, key->fixup_fixed[i], target);
+      if (target && target->num_fixups) {
+        printf("Err: fixup %s -> %s lands on another fixup!\n", key->product, key->fixup_fixed[i]);
+        ret = -1;
+      }
+    }
+  }
+  return ret;
+}
+
+static void pool_reserve(uint32_t len) {
+  if (pool_size + len > pool_cap) {
+    pool_cap = (pool_size + len) * 2;
+    pool = realloc(pool, pool_cap);
+    if (!pool) {
+      printf("%s no free memory\n", __func__);
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+static uint32_t pool_add(const char *str) {
+  if (!pool_size) {
+    /* Offset 0 is the empty string, doubles as "unused" */
+    pool_reserve(1);
+    pool[pool_size++] = '\0';
+  }
+  if (!str[0]) {
+    return 0;
+  }
+  pool_str *found;
+  HASH_FIND_STR(pool_strs, str, found);
+  if (found) {
+    return found->offset;
+  }
+
+  const uint32_t len = (uint32_t)strlen(str) + 1;
+  found = malloc(sizeof(pool_str));
+  if (!found) {
+    printf("%s no free memory\n", __func__);
+    exit(EXIT_FAILURE);
+  }
+  pool_reserve(len);
+  found->offset = pool_size;
+  found->str = strdup(str); /* pool moves on realloc, the hash keys on its own copy */
+  memcpy(pool + pool_size, str, len);
+  pool_size += len;
+  HASH_ADD_KEYPTR(hh, pool_strs, found->str, len - 1, found);
+  return found->offset;
+}
+
+static uint32_t next_pow2(uint32_t v) {
+  uint32_t p = 1;
+  while (p < v) {
+    p <<= 1;
+  }
+  return p;
+}
+
+typedef struct bucket {
+  remap_key **keys;
+  unsigned int count;
+} bucket;
+
+static int bucket_cmp(const void *a, const void *b) {
+  return (int)((const bucket *)b)->count - (int)((const bucket *)a)->count;
+}
+
+/* Hash and displace, biggest buckets first. Returns 0 with disp filled in,
+ * -1 when some bucket found no displacement and the table has to grow */
+static int perfect_hash_place(uint32_t table_size, uint32_t num_buckets, uint16_t *disp) {
+  const unsigned int num_keys = HASH_COUNT(keys);
+  bucket *buckets = calloc(num_buckets, sizeof(bucket));
+  remap_key **by_bucket = malloc((num_keys ? num_keys : 1) * sizeof(remap_key *));
+  unsigned char *taken = calloc(table_size, 1);
+  if (!buckets || !by_bucket || !taken) {
+    printf("%s no free memory\n", __func__);
+    exit(EXIT_FAILURE);
+  }
+
+  for (remap_key *key = keys; key; key = key->hh.next) {
+    key->hash = serial_remap_hash(key->product);
+    buckets[serial_remap_bucket(key->hash, num_buckets)].count++;
+  }
+  unsigned int start = 0;
+  for (uint32_t b = 0; b < num_buckets; b++) {
+    buckets[b].keys = by_bucket + start;
+    start += buckets[b].count;
+    buckets[b].count = 0;
+  }
+  for (remap_key *key = keys; key; key = key->hh.next) {
+    bucket *bk = &buckets[serial_remap_bucket(key->hash, num_buckets)];
+    bk->keys[bk->count++] = key;
+  }
+  bucket *sorted = malloc(num_buckets * sizeof(bucket));
+  if (!sorted) {
+    printf("%s no free memory\n", __func__);
+    exit(EXIT_FAILURE);
+  }
+  memcpy(sorted, buckets, num_buckets * sizeof(bucket));
+  qsort(sorted, num_buckets, sizeof(bucket), bucket_cmp);
+  memset(disp, 0, num_buckets * sizeof(uint16_t));
+
+  int ret = 0;
+  for (uint32_t b = 0; b < num_buckets && sorted[b].count && !ret; b++) {
+    const bucket *bk = &sorted[b];
+    const uint32_t bucket_idx = serial_remap_bucket(bk->keys[0]->hash, num_buckets);
+    uint32_t d;
+    for (d = 0; d <= 0xFFFF; d++) {
+      unsigned int k;
+      for (k = 0; k < bk->count; k++) {
+        const uint32_t slot = serial_remap_index(bk->keys[k]->hash, d, table_size);
+        if (taken[slot]) {
+          break;
+        }
+        taken[slot] = 2; /* claimed by this try */
+        bk->keys[k]->slot = slot;
+      }
+      if (k == bk->count) {
+        break;
+      }
+      for (unsigned int u = 0; u < k; u++) {
+        taken[bk->keys[u]->slot] = 0;
+      }
+    }
+    if (d > 0xFFFF) {
+      ret = -1;
+      break;
+    }
+    for (unsigned int k = 0; k < bk->count; k++) {
+      taken[bk->keys[k]->slot] = 1;
+    }
+    disp[bucket_idx] = (uint16_t)d;
+  }
+
+  free(sorted);
+  free(taken);
+  free(by_bucket);
+  free(buckets);
+  return ret;
+}
+
+static uint32_t align4(uint32_t v) {
+  return (v + 3) & ~3u;
+}
+
+/* Whole image in one buffer, same bytes for REMAP.BIN and the built in table */
+static unsigned char *image_build(uint32_t *image_size) {
+  const uint32_t num_keys = HASH_COUNT(keys);
+  uint32_t table_size = next_pow2(num_keys ? num_keys : 1);
+  uint32_t num_buckets = next_pow2((num_keys + 1) / 2 ? (num_keys + 1) / 2 : 1);
+  uint16_t *disp = NULL;
+
+  for (;;) {
+    disp = realloc(disp, num_buckets * sizeof(uint16_t));
+    if (!disp) {
+      printf("%s no free memory\n", __func__);
+      return NULL;
+    }
+    if (!perfect_hash_place(table_size, num_buckets, disp)) {
+      break;
+    }
+    table_size <<= 1;
+  }
+
+  const uint32_t num_rules = num_fixups + num_remaps;
+  if (num_rules > 0xFFFF) {
+    printf("Err: %u rules, the table holds at most 65535!\n", num_rules);
+    free(disp);
+    return NULL;
+  }
+  serial_remap_slot *slots = calloc(table_size, sizeof(serial_remap_slot));
+  serial_remap_rule *rules = calloc(num_rules ? num_rules : 1, sizeof(serial_remap_rule));
+  if (!slots || !rules) {
+    printf("%s no free memory\n", __func__);
+    exit(EXIT_FAILURE);
+  }
+
+  pool_add("");
+  uint32_t rule_idx = 0;
+  for (remap_key *key = keys; key; key = key->hh.next) {
+    serial_remap_slot *slot = &slots[key->slot];
+    slot->key = pool_add(key->product);
+    slot->first_rule = (uint16_t)rule_idx;
+    for (int i = 0; i < key->num_fixups; i++) {
+      serial_remap_rule *rule = &rules[rule_idx++];
+      rule->cond_type = key->fixup_is_name[i] ? SERIAL_REMAP_NAME : SERIAL_REMAP_DATE;
+      rule->cond = pool_add(key->fixup_cond[i]);
+      rule->fixed_product = pool_add(key->fixup_fixed[i]);
+    }
+    if (key->has_remap) {
+      serial_remap_rule *rule = &rules[rule_idx++];
+      rule->cond_type = SERIAL_REMAP_ALWAYS;
+      rule->art = pool_add(key->art);
+      rule->meta = pool_add(key->meta);
+    }
+    slot->num_rules = (uint16_t)(rule_idx - slot->first_rule);
+  }
+
+  serial_remap_header hdr;
+  memset(&hdr, 0, sizeof(hdr));
+  memcpy(hdr.magic, SERIAL_REMAP_MAGIC, 4);
+  hdr.version = SERIAL_REMAP_VERSION;
+  hdr.num_keys = num_keys;
+  hdr.table_size = table_size;
+  hdr.num_buckets = num_buckets;
+  hdr.num_rules = num_rules;
+  hdr.pool_size = pool_size;
+  hdr.disp_offset = align4(sizeof(hdr));
+  hdr.slots_offset = align4(hdr.disp_offset + num_buckets * sizeof(uint16_t));
+  hdr.rules_offset = align4(hdr.slots_offset + table_size * sizeof(serial_remap_slot));
+  hdr.pool_offset = align4(hdr.rules_offset + num_rules * sizeof(serial_remap_rule));
+  *image_size = align4(hdr.pool_offset + pool_size);
+
+  unsigned char *image = calloc(*image_size, 1);
+  if (!image) {
+    printf("%s no free memory\n", __func__);
+    exit(EXIT_FAILURE);
+  }
+  memcpy(image, &hdr, sizeof(hdr));
+  memcpy(image + hdr.disp_offset, disp, num_buckets * sizeof(uint16_t));
+  memcpy(image + hdr.slots_offset, slots, table_size * sizeof(serial_remap_slot));
+  memcpy(image + hdr.rules_offset, rules, num_rules * sizeof(serial_remap_rule));
+  memcpy(image + hdr.pool_offset, pool, pool_size);
+
+  printf("%u serials, %u fixups, %u remaps, %u slots, %u buckets, %u bytes\n", num_keys, num_fixups, num_remaps,
+         table_size, num_buckets, *image_size);
+  free(rules);
+  free(slots);
+  free(disp);
+  return image;
+}
+
+/* Every key has to come back out of the image with the rules it went in with */
+static int image_verify(const unsigned char *image) {
+  const serial_remap_header *hdr = (const serial_remap_header *)image;
+  const char *image_pool = (const char *)(image + hdr->pool_offset);
+  for (remap_key *key = keys; key; key = key->hh.next) {
+    const serial_remap_slot *slot = serial_remap_find(hdr, key->product);
+    if (!slot || strcmp(image_pool + slot->key, key->product)
+        || slot->num_rules != key->num_fixups + key->has_remap) {
+      printf("Err: %s does not look up!\n", key->product);
+      return -1;
+    }
+  }
+  if (serial_remap_find(hdr, "") || serial_remap_find(hdr, "NOTASERIAL")) {
+    printf("Err: lookup of a missing serial hit!\n");
+    return -1;
+  }
+  return 0;
+}
+
+static int write_bin(const char *filename, const unsigned char *image, uint32_t image_size) {
+  FILE *fd = fopen(filename, "wb");
+  if (!fd) {
+    printf("Err: cant write %s!\n", filename);
+    return -1;
+  }
+  fwrite(image, image_size, 1, fd);
+  fclose(fd);
+  return 0;
+}
+
+static int write_header(const char *filename, const unsigned char *image, uint32_t image_size) {
+  FILE *fd = fopen(filename, "w");
+  if (!fd) {
+    printf("Err: cant write %s!\n", filename);
+    return -1;
+  }
+  fprintf(fd, "/* Generated by remapgen from serial_remap.def, do not edit */\n\n");
+  fprintf(fd, "#pragma once\n\n#include <stdint.h>\n\n");
+  fprintf(fd, "/* Little endian words so the image keeps its 4 byte alignment */\n");
+  fprintf(fd, "static const uint32_t serial_remap_builtin[%u] = {", image_size / 4);
+  for (uint32_t i = 0; i < image_size / 4; i++) {
+    const uint32_t w = (uint32_t)image[i * 4] | (uint32_t)image[i * 4 + 1] << 8 | (uint32_t)image[i * 4 + 2] << 16
+                       | (uint32_t)image[i * 4 + 3] << 24;
+    fprintf(fd, "%s0x%08X,", (i % 8) ? " " : "\n    ", w);
+  }
+  fprintf(fd, "\n};\n");
+  fclose(fd);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  const char *header_file = NULL;
+  const char *bin_file = NULL;
+  int use_builtin = 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n")) {
+      use_builtin = 0;
+    } else if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+      i++;
+    } else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+      header_file = argv[++i];
+    } else if (argv[i][0] != '-') {
+      bin_file = argv[i];
+    } else {
+      printf("Unknown option %s\n", argv[i]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (!header_file && !bin_file) {
+    printf("Incorrect usage!\n\t./remapgen [-n] [-t RULES.TSV]... [-c TABLE.H] [REMAP.BIN]\n");
+    return EXIT_FAILURE;
+  }
+
+  int ret = 0;
+  if (use_builtin) {
+    for (size_t i = 0; i < sizeof(builtin_rules) / sizeof(builtin_rules[0]); i++) {
+      ret |= rule_add(builtin_rules[i].product, builtin_rules[i].date, builtin_rules[i].name_hint,
+                      builtin_rules[i].fixed, builtin_rules[i].art, builtin_rules[i].meta, "serial_remap.def");
+    }
+  }
+  /* Second pass so extra rules always land after the built in ones */
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+      ret |= rules_read_tsv(argv[++i]);
+    } else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+      i++;
+    }
+  }
+  if (ret || rules_check_chains()) {
+    return EXIT_FAILURE;
+  }
+
+  uint32_t image_size;
+  unsigned char *image = image_build(&image_size);
+  if (!image || image_verify(image)) {
+    return EXIT_FAILURE;
+  }
+  if ((header_file && write_header(header_file, image, image_size))
+      || (bin_file && write_bin(bin_file, image, image_size))) {
+    free(image);
+    return EXIT_FAILURE;
+  }
+  free(image);
+  return EXIT_SUCCESS;
+}
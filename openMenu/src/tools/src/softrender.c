@@ -0,0 +1,157 @@
+/*
+ * File: softrender.c
+ * Project: tools
+ * File Created: Monday, 19th October 2026 4:12:33 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <om_reader.h>
+#include <pvr_soft.h>
+#include "ui/draw_prototypes.h"
+#include "ui/font_prototypes.h"
+
+/* Called:
+./softrender CD_ROOT OUT.png [frames]
+
+draws a grid screen with draw_kos and both fonts, the same code the menu runs,
+over the software PowerVR. CD_ROOT is a menu_data style directory, /cd/ paths
+are looked up under it ignoring case. Every frame is counted, the last ten
+are also rendered and the final one written out as PNG, or PPM for a .ppm
+path. Prints what a frame sent to the TA and how many frames a second both
+kinds run at.
+*/
+
+#define DEFAULT_FRAMES (1000)
+#define RENDER_FRAMES  (10)
+#define GRID_COLUMNS   (4)
+#define GRID_ROWS      (2)
+#define GRID_SIZE      (128)
+
+extern image img_empty_boxart;
+static image bg_left, bg_right;
+
+static double now_sec(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void load_image(const char *path, image *img) {
+  const unsigned int slot = texman_create();
+  draw_load_texture_buffer(path, img, texman_get_tex_data(slot));
+  texman_reserve_memory(img->width, img->height, 2 /* 16Bit */);
+}
+
+static void draw_frame(int frame) {
+  pvr_wait_ready();
+  pvr_scene_begin();
+  z_reset();
+
+  draw_set_list(PVR_LIST_OP_POLY);
+  pvr_list_begin(PVR_LIST_OP_POLY);
+  const dimen_RECT left = {.x = 0, .y = 0, .w = 512, .h = 480};
+  const dimen_RECT right = {.x = 0, .y = 0, .w = 128, .h = 480};
+  draw_draw_sub_image(0, 0, 512, 480, COLOR_WHITE, &bg_left, &left);
+  draw_draw_sub_image(512, 0, 128, 480, COLOR_WHITE, &bg_right, &right);
+  for (int i = 0; i < GRID_COLUMNS * GRID_ROWS; i++) {
+    const int x = 28 + (i % GRID_COLUMNS) * (GRID_SIZE + 20);
+    const int y = 100 + (i / GRID_COLUMNS) * (GRID_SIZE + 24);
+    draw_draw_square(x, y, GRID_SIZE, COLOR_WHITE, &img_empty_boxart);
+  }
+  draw_flush();
+  pvr_list_finish();
+
+  draw_set_list(PVR_LIST_TR_POLY);
+  pvr_list_begin(PVR_LIST_TR_POLY);
+  const int selected = frame % (GRID_COLUMNS * GRID_ROWS);
+  draw_draw_quad(24 + (selected % GRID_COLUMNS) * (GRID_SIZE + 20), 96 + (selected / GRID_COLUMNS) * (GRID_SIZE + 24),
+                 GRID_SIZE + 8, GRID_SIZE + 8, 0x80FFFFFF);
+  font_bmf_begin_draw();
+  font_bmf_set_height(24.0f);
+  font_bmf_draw_centered(320, 40, COLOR_WHITE, "Sonic Adventure 2");
+  font_bmf_set_height(14.0f);
+  for (int i = 0; i < GRID_COLUMNS * GRID_ROWS; i++) {
+    const int x = 28 + (i % GRID_COLUMNS) * (GRID_SIZE + 20);
+    const int y = 100 + (i / GRID_COLUMNS) * (GRID_SIZE + 24) + GRID_SIZE + 4;
+    font_bmf_draw_auto_size(x, y, COLOR_BLUE, "Jet Set Radio Future", GRID_SIZE);
+  }
+  font_bmp_begin_draw();
+  font_bmp_set_color(COLOR_ORANGE_U);
+  font_bmp_draw_main(16, 452, "softrender");
+  draw_flush();
+  pvr_list_finish();
+
+  pvr_scene_finish();
+}
+
+static void print_stats(const char *what, const pvr_soft_stats *stats) {
+  static const char *names[PVR_SOFT_LISTS] = {"OP", "OP_MOD", "TR", "TR_MOD", "PT"};
+  printf("%s: %u pvr_prim, %u TA bytes, %u texture loads (%u bytes), %u pixels\n", what, stats->prims,
+         stats->ta_bytes, stats->txr_loads, stats->txr_bytes, stats->pixels);
+  for (int i = 0; i < PVR_SOFT_LISTS; i++) {
+    const pvr_soft_list_stats *list = &stats->lists[i];
+    if (list->headers || list->verts) {
+      printf("  %-6s %4u headers %5u verts %5u strips %5u tris\n", names[i], list->headers, list->verts,
+             list->strips, list->tris);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    printf("Incorrect usage!\n\t./softrender CD_ROOT OUT.png [frames]\n");
+    return EXIT_FAILURE;
+  }
+  const int frames = (argc > 3) ? atoi(argv[3]) : DEFAULT_FRAMES;
+  if (frames < 1) {
+    printf("Err: need at least one frame!\n");
+    return EXIT_FAILURE;
+  }
+
+  om_file_set_cd_root(argv[1]);
+  pvr_init(NULL);
+  draw_init();
+  load_image("EMPTY.PVR", &img_empty_boxart);
+  load_image("THEME/NTSC_U/BG_U_L.PVR", &bg_left);
+  load_image("THEME/NTSC_U/BG_U_R.PVR", &bg_right);
+  if (font_bmf_init("FONT/BASILEA.FNT", "FONT/BASILEA_W.PVR", 0) || font_bmp_init("FONT/GDMNUFNT.PVR", 8, 16)) {
+    printf("Err: cant load the fonts from %s!\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  /* Counting only, what every frame but the checked ones costs */
+  const int render_frames = (frames < RENDER_FRAMES) ? frames : RENDER_FRAMES;
+  const int count_frames = frames - render_frames;
+  const double start = now_sec();
+  for (int i = 0; i < count_frames; i++) {
+    draw_frame(i);
+  }
+  const double counted = now_sec() - start;
+
+  pvr_soft_set_render(1);
+  const double render_start = now_sec();
+  for (int i = count_frames; i < frames; i++) {
+    draw_frame(i);
+  }
+  const double rendered = now_sec() - render_start;
+
+  print_stats("last frame", pvr_soft_get_stats());
+  if (count_frames) {
+    printf("counted %d frames in %.3f ms, %.0f frames/s\n", count_frames, counted * 1e3, count_frames / counted);
+  }
+  printf("rendered %d frames in %.3f ms, %.0f frames/s\n", render_frames, rendered * 1e3, render_frames / rendered);
+
+  if (pvr_soft_write_frame(argv[2])) {
+    printf("Err: cant write %s!\n", argv[2]);
+    return EXIT_FAILURE;
+  }
+  printf("wrote %s\n", argv[2]);
+  return EXIT_SUCCESS;
+}
@@ -220,91 +220,6 @@ int iterate_dir(const char *path, int (*file_cb)(const char *, const char *, str
   return 0;
 }
 
-/* DAT loading */
-
-int DAT_init(dat_file *bin) {
-  memset(bin, '\0', sizeof(dat_file));
-  return 0;
-}
-
-int DAT_load_parse(dat_file *bin, const char *path) {
-  FILE *bin_fd;
-  bin_header file_header;
-
-  bin_fd = fopen(path, "rb");
-  if (!bin_fd) {
-    DBG_PRINT("DAT:Error opening %s!\n", path);
-    return 1;
-  }
-
-  fread(&file_header, sizeof(bin_header), 1, bin_fd);
-  if (file_header.magic.rich.version != 1) {
-    DBG_PRINT("DAT:Error Incorrect file format!\n");
-    return 1;
-  }
-
-  /* setup basic bin file info */
-  bin->chunk_size = file_header.chunk_size;
-  bin->num_chunks = file_header.num_chunks;
-  bin->handle = bin_fd;
-  bin->items = malloc(bin->num_chunks * sizeof(bin_item));
-  bin->hash = NULL;
-
-  /* Parse file table to Hash table */
-  for (int i = 0; i < file_header.num_chunks; i++) {
-    fread(&bin->items[i], sizeof(bin_item_raw), 1, bin->handle);
-    HASH_ADD_STR(bin->hash, ID, &bin->items[i]);
-  }
-
-  printf("DAT:Parse success (%u items)!\n", file_header.num_chunks);
-
-  return 0;
-}
-
-void DAT_info(const dat_file *bin) {
-  DBG_PRINT("BIN Stats:\nChunk Size: %u\nNum Chunks: %u\n\n", bin->chunk_size, bin->num_chunks);
-  for (int i = 0; i < bin->num_chunks; i++) {
-    DBG_PRINT("Record[%u] %s at 0x%X\n", bin->items[i].offset, bin->items[i].ID, bin->items[i].offset * bin->chunk_size);
-  }
-}
-
-uint32_t DAT_get_offset_by_ID(const dat_file *bin, const char *ID) {
-  const bin_item *item;
-  uint32_t ret;
-
-  HASH_FIND_STR(bin->hash, ID, item);
-  if (item) {
-    ret = item->offset * bin->chunk_size;
-  } else {
-    ret = 0;
-  }
-
-  return ret;
-}
-
-int DAT_read_file_by_ID(const dat_file *bin, const char *ID, void *buf) {
-  uint32_t offset = DAT_get_offset_by_ID(bin, ID);
-  if (offset) {
-    fseek(bin->handle, offset, SEEK_SET);
-    fread(buf, bin->chunk_size, 1, bin->handle);
-    return 1;
-  } else {
-    return 0;
-  }
-}
-
-int DAT_read_file_by_num(const dat_file *bin, uint32_t chunk_num, void *buf) {
-  uint32_t offset = chunk_num * bin->chunk_size;
-  if (chunk_num <= bin->num_chunks) {
-    fseek(bin->handle, offset, SEEK_SET);
-    fread(buf, bin->chunk_size, 1, bin->handle);
-    return 1;
-  } else {
-    return 0;
-  }
-  return 1;
-}
-
 int main(int argc, char **argv) {
   if (argc < NUM_ARGS + 1 /*binary itself*/) {
     printf("Incorrect usage!\n\t./datstrip input.dat openmenu.ini output.dat\n");
@@ -319,7 +234,7 @@ int main(int argc, char **argv) {
   /* Basic Usage */
   dat_file input_bin;
   DAT_init(&input_bin);
-  if (DAT_load_parse(&input_bin, argv[1])) {
+  if (DAT_load_parse(&input_bin, argv[1], DAT_VERSION)) {
     return -1;
   }
 
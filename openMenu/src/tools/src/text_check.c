@@ -0,0 +1,127 @@
+/*
+ * File: text_check.c
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 4:22:47 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <om_reader.h>
+#include <pvr_soft.h>
+#include "ui/draw_prototypes.h"
+#include "ui/font_prototypes.h"
+
+/* Called:
+./textcheck CD_ROOT
+
+draws text with both fonts through draw_kos over the software PowerVR and
+fails unless each scene reached the TA as the text stream should send it:
+one header per font change, vertices in DRAW_TEXT_VERTS bursts, and the
+header sent again after anything else went out in between. CD_ROOT is a
+menu_data style directory holding FONT/BASILEA.FNT, FONT/BASILEA_W.PVR and
+FONT/GDMNUFNT.PVR.
+*/
+
+#define LETTERS       "ABCDEFGHIJKLMNOP" /* no spaces, every letter is a quad */
+#define STRING_VERTS  (16 * 4)
+#define STRING_HEIGHT (16)
+
+typedef void (*scene_fn)(void);
+
+static int failures;
+
+static void bmf_strings(int count) {
+  for (int i = 0; i < count; i++) {
+    font_bmf_draw(16, 16 + (i % 24) * STRING_HEIGHT, COLOR_WHITE, LETTERS);
+  }
+}
+
+static void bmp_strings(int count) {
+  for (int i = 0; i < count; i++) {
+    font_bmp_draw_main(320, 16 + (i % 24) * STRING_HEIGHT, LETTERS);
+  }
+}
+
+/* Enough letters for four full bursts, the last goes out on draw_flush */
+static void scene_one_font(void) {
+  font_bmf_begin_draw();
+  bmf_strings(4 * DRAW_TEXT_VERTS / STRING_VERTS);
+}
+
+static void scene_two_fonts(void) {
+  font_bmf_begin_draw();
+  bmf_strings(4);
+  font_bmp_begin_draw();
+  font_bmp_set_color(COLOR_ORANGE_U);
+  bmp_strings(4);
+  font_bmf_begin_draw();
+  bmf_strings(4);
+}
+
+/* Starting the same font again keeps filling the same burst */
+static void scene_shared_header(void) {
+  font_bmf_begin_draw();
+  bmf_strings(4);
+  font_bmf_begin_draw();
+  bmf_strings(4);
+}
+
+/* The quad is queued, the next header sends the text before it and the quad,
+ * then the text after needs its header again */
+static void scene_image_between(void) {
+  font_bmf_begin_draw();
+  bmf_strings(2);
+  draw_draw_quad(0, 0, 64, 64, 0x80FFFFFF);
+  font_bmf_begin_draw();
+  bmf_strings(2);
+}
+
+static void check_scene(const char *what, scene_fn draw, uint32_t prims, uint32_t headers, uint32_t verts) {
+  pvr_wait_ready();
+  pvr_scene_begin();
+  z_reset();
+  draw_set_list(PVR_LIST_TR_POLY);
+  pvr_list_begin(PVR_LIST_TR_POLY);
+  draw();
+  draw_flush();
+  pvr_list_finish();
+  pvr_scene_finish();
+
+  const pvr_soft_stats *stats = pvr_soft_get_stats();
+  const pvr_soft_list_stats *tr = &stats->lists[PVR_LIST_TR_POLY];
+  const int ok = stats->prims == prims && tr->headers == headers && tr->verts == verts;
+  printf("%-4s %-14s %3u pvr_prim (want %3u) %2u headers (want %2u) %5u verts (want %5u)\n", ok ? "ok" : "FAIL",
+         what, stats->prims, prims, tr->headers, headers, tr->verts, verts);
+  failures += !ok;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    printf("Incorrect usage!\n\t./textcheck CD_ROOT\n");
+    return EXIT_FAILURE;
+  }
+
+  om_file_set_cd_root(argv[1]);
+  pvr_init(NULL);
+  draw_init();
+  if (font_bmf_init("FONT/BASILEA.FNT", "FONT/BASILEA_W.PVR", 0) || font_bmp_init("FONT/GDMNUFNT.PVR", 8, 16)) {
+    printf("Err: cant load the fonts from %s!\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  /* Each header and each burst of vertices is its own pvr_prim */
+  check_scene("one font", scene_one_font, 1 + 4, 1, 4 * DRAW_TEXT_VERTS);
+  check_scene("two fonts", scene_two_fonts, 3 * 2, 3, 12 * STRING_VERTS);
+  check_scene("shared header", scene_shared_header, 1 + 1, 1, 8 * STRING_VERTS);
+  check_scene("image between", scene_image_between, 3 * 2, 3, 4 * STRING_VERTS + 4);
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,99 @@
+/*
+ * File: twiddle_bench.c
+ * Project: tools
+ * File Created: Sunday, 18th October 2026 3:02:18 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "pvr_image.h"
+
+/* Called:
+./twiddlebench [iterations]
+
+times the quad twiddle kernel used by datpack against the per texel
+reference and checks both produce the same layout
+*/
+
+#define DEFAULT_ITERATIONS (200)
+
+static double now_sec(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void twiddle_reference(const uint16_t *src, uint16_t *dst, uint32_t width, uint32_t height) {
+  for (uint32_t y = 0; y < height; y++) {
+    for (uint32_t x = 0; x < width; x++) {
+      dst[pvr_twiddle_index(x, y, width, height)] = src[y * width + x];
+    }
+  }
+}
+
+static int bench_size(uint32_t width, uint32_t height, int iterations) {
+  const uint32_t texels = width * height;
+  uint16_t *src = malloc(texels * sizeof(uint16_t));
+  uint16_t *ref = malloc(texels * sizeof(uint16_t));
+  uint16_t *out = malloc(texels * sizeof(uint16_t));
+  if (!src || !ref || !out) {
+    printf("%s no free memory\n", __func__);
+    free(src);
+    free(ref);
+    free(out);
+    return -1;
+  }
+  for (uint32_t i = 0; i < texels; i++) {
+    src[i] = (uint16_t)(i * 2654435761u >> 7);
+  }
+
+  twiddle_reference(src, ref, width, height);
+  pvr_twiddle_16bpp(src, out, width, height);
+  if (memcmp(ref, out, texels * sizeof(uint16_t))) {
+    printf("%4ux%-4u MISMATCH\n", width, height);
+    free(src);
+    free(ref);
+    free(out);
+    return -1;
+  }
+
+  double start = now_sec();
+  for (int i = 0; i < iterations; i++) {
+    twiddle_reference(src, ref, width, height);
+  }
+  const double ref_time = now_sec() - start;
+
+  start = now_sec();
+  for (int i = 0; i < iterations; i++) {
+    pvr_twiddle_16bpp(src, out, width, height);
+  }
+  const double kern_time = now_sec() - start;
+
+  const double mb = (double)texels * sizeof(uint16_t) * iterations / (1024.0 * 1024.0);
+  printf("%4ux%-4u reference %8.1f MB/s   kernel %8.1f MB/s   x%.2f\n", width, height, mb / ref_time,
+         mb / kern_time, ref_time / kern_time);
+
+  free(src);
+  free(ref);
+  free(out);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  static const uint32_t sizes[][2] = {{64, 64}, {128, 128}, {256, 256}, {512, 512}, {1024, 1024}, {256, 128}, {128, 512}};
+  const int iterations = (argc > 1) ? atoi(argv[1]) : DEFAULT_ITERATIONS;
+  int ret = EXIT_SUCCESS;
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    if (bench_size(sizes[i][0], sizes[i][1], iterations)) {
+      ret = EXIT_FAILURE;
+    }
+  }
+  return ret;
+}
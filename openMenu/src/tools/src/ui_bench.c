@@ -0,0 +1,474 @@
+/*
+ * File: ui_bench.c
+ * Project: tools
+ * File Created: Tuesday, 20th October 2026 1:26:40 pm
+ * Author: Hayden Kowalchuk
+ * -----
+ * Copyright (c) 2026 Hayden Kowalchuk, Hayden Kowalchuk
+ * License: BSD 3-clause "New" or "Revised" License, http://www.opensource.org/licenses/BSD-3-Clause
+ */
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <backend/db_list.h>
+#include <backend/gd_item.h>
+#include <backend/gd_list.h>
+#include <om_reader.h>
+#include <openmenu_savefile.h>
+#include <openmenu_settings.h>
+#include <profiler.h>
+#include <pvr_soft.h>
+#include <texture/serial_sanitize.h>
+
+#include "boot.h"
+#include "texture/txr_manager.h"
+#include "ui/common.h"
+#include "ui/dc/input.h"
+#include "ui/draw_prototypes.h"
+#include "ui/input_control.h"
+#include "ui/input_script.h"
+#include "ui/theme_manager.h"
+#include "ui/ui_common.h"
+#include "vm2/vm2_api.h"
+
+/* UI Collection, as main.c has it */
+#include "ui/ui_grid.h"
+#undef UI_NAME
+#include "ui/ui_line_desc.h"
+#undef UI_NAME
+#include "ui/ui_scroll.h"
+#undef UI_NAME
+#include "ui/ui_folders.h"
+#undef UI_NAME
+
+/* Called:
+./uibench [-u UI] [-n FRAMES] [-c CSV] [-s OUT.png] [-v] CARD_DIR SCRIPT
+
+runs a UI of the menu frame by frame on the host, input replayed from an
+input_script (see ui/input_script.h), drawing through draw_kos into the
+software PowerVR. Sessions like holding DOWN through a 3000 game card are then
+the same every run and can be compared between changes
+  -u UI      LINE_DESC, GRID3, SCROLL or FOLDERS, or its number (default the saved setting)
+  -n FRAMES  frames to run (default the script's length)
+  -c CSV     write every frame here: control, CPU time, TA and texture upload counts
+  -s OUT     render the final screen and write it out, PNG or PPM by extension
+  -v         keep the menu's own output, it is sent to /dev/null otherwise
+
+CARD_DIR is a card with the menu_data assets (FONT/, THEME/, EMPTY.PVR...) and a
+game list, normally ./menufaker -g run over a copy of menu_data. A session ends
+early when the UI launches a game or exits to the BIOS.
+
+Reports the median, p99 and worst CPU time a frame takes in handle_input plus
+drawing, what went to the TA a frame and the textures uploaded, which are the
+art cache misses. With -DOPENMENU_PROFILER=ON the cache hits and misses are
+also counted from the profiler.
+*/
+
+#define VM2_MAX_DEVICES (8)
+
+typedef struct ui_template {
+  void (*init)(void);
+  void (*setup)(void);
+  void (*drawOP)(void);
+  void (*drawTR)(void);
+  void (*handle_input)(unsigned int);
+} ui_template;
+
+#define UI_TEMPLATE(name)                                                                                              \
+  (ui_template) {                                                                                                      \
+    .init = FUNC_NAME(name, init), .setup = FUNC_NAME(name, setup), .drawOP = FUNC_NAME(name, drawOP),                 \
+    .drawTR = FUNC_NAME(name, drawTR), .handle_input = FUNC_NAME(name, handle_input),                                  \
+  }
+
+/* In CFG_UI order */
+static const char *ui_names[] = {"LINE_DESC", "GRID3", "SCROLL", "FOLDERS"};
+static ui_template ui_choices[4];
+
+typedef struct frame_result {
+  int control;
+  uint64_t input_ns;
+  uint64_t draw_ns;
+  uint32_t headers;
+  uint32_t verts;
+  uint32_t txr_loads;
+  uint32_t txr_bytes;
+  uint32_t txr_hit;
+  uint32_t txr_miss;
+} frame_result;
+
+static const ui_template *current_ui;
+static int need_reload_ui;
+static const char *session_end;
+
+/* What main.c and the backend give the UIs on the Dreamcast */
+maple_device_t *vm2_devices[VM2_MAX_DEVICES] = {NULL};
+int vm2_device_count = 0;
+
+void vm2_rescan(void) {
+  vm2_device_count = 0;
+}
+
+void reload_ui(void) {
+  need_reload_ui = 1;
+}
+
+void exit_to_bios_ex(int do_mount, int do_send_id) {
+  (void)do_mount;
+  (void)do_send_id;
+  session_end = "exit to bios";
+}
+
+void exit_to_bios(void) {
+  exit_to_bios_ex(1, 1);
+}
+
+void bloom_launch(const struct gd_item *disc) {
+  (void)disc;
+  session_end = "bloom launch";
+}
+
+void bleem_launch(const struct gd_item *disc) {
+  (void)disc;
+  session_end = "bleem launch";
+}
+
+void dreamcast_launch_disc(const struct gd_item *disc) {
+  (void)disc;
+  session_end = "disc launch";
+}
+
+void dreamcast_launch_cb(const struct gd_item *disc) {
+  (void)disc;
+  session_end = "codebreaker launch";
+}
+
+int is_bloom_available(void) {
+  return 0;
+}
+
+int gdemu_get_version(void *buffer, uint32_t *size) {
+  (void)buffer;
+  (void)size;
+  return -1;
+}
+
+/* Every stage is run before the first frame */
+int boot_require(BOOT_STAGE stage) {
+  (void)stage;
+  return 0;
+}
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void ui_set_choice(int choice) {
+  need_reload_ui = 0;
+  if (choice < UI_START || choice > UI_END) {
+    choice = UI_START;
+  }
+  current_ui = &ui_choices[choice];
+  current_ui->init();
+  current_ui->setup();
+}
+
+static int ui_parse(const char *name) {
+  for (int i = 0; i < (int)(sizeof(ui_names) / sizeof(ui_names[0])); i++) {
+    if (!strcmp(name, ui_names[i])) {
+      return i;
+    }
+  }
+  char *end;
+  const long num = strtol(name, &end, 10);
+  return (!*end && end != name && num >= UI_START && num <= UI_END) ? (int)num : -1;
+}
+
+/* boot_sort from main.c */
+static void sort_list(void) {
+  if (sf_filter[0]) {
+    list_set_genre_sort(sf_filter[0] - 1, sf_sort[0]);
+    return;
+  }
+  switch (sf_sort[0]) {
+    case SORT_NAME: list_set_sort_name(); break;
+    case SORT_DATE: list_set_sort_region(); break;
+    case SORT_PRODUCT: list_set_sort_genre(); break;
+    case SORT_SD_CARD: list_set_sort_default(); break;
+    default:
+    case SORT_DEFAULT: list_set_sort_alphabetical(); break;
+  }
+}
+
+/* The boot stages main.c runs, all of them up front */
+static int boot(int ui) {
+  pvr_init(NULL);
+  savefile_init();
+  if (ui >= 0) {
+    sf_ui[0] = (uint8_t)ui;
+  }
+  txr_create_small_pool();
+  txr_create_large_pool();
+  serial_sanitizer_init();
+  if (list_read_default()) {
+    fprintf(stderr, "Err: cant read the game list!\n");
+    return -1;
+  }
+  list_folder_init();
+  db_load_DAT();
+  theme_manager_load();
+  sort_list();
+  draw_init();
+  txr_load_DATs();
+
+  ui_choices[UI_LINE_DESC] = UI_TEMPLATE(LIST_DESC);
+  ui_choices[UI_GRID3] = UI_TEMPLATE(GRID_3);
+  ui_choices[UI_SCROLL] = UI_TEMPLATE(SCROLL);
+  ui_choices[UI_FOLDERS] = UI_TEMPLATE(FOLDERS);
+  ui_set_choice(sf_ui[0]);
+  return 0;
+}
+
+static void draw(void) {
+  pvr_wait_ready();
+  pvr_scene_begin();
+
+  draw_set_list(PVR_LIST_OP_POLY);
+  pvr_list_begin(PVR_LIST_OP_POLY);
+  current_ui->drawOP();
+  draw_flush();
+  pvr_list_finish();
+
+  draw_set_list(PVR_LIST_TR_POLY);
+  pvr_list_begin(PVR_LIST_TR_POLY);
+  current_ui->drawTR();
+  draw_flush();
+  pvr_list_finish();
+
+  pvr_scene_finish();
+}
+
+/* One turn of main.c's loop with the script standing in for maple */
+static void run_frame(const input_script *script, uint32_t frame, frame_result *res) {
+  inputs in;
+  input_script_frame(script, frame, &in);
+  INPT_ReceiveFromHost(in);
+
+  z_reset();
+  const uint64_t input_start = now_ns();
+  res->control = input_control();
+  current_ui->handle_input(res->control);
+  const uint64_t draw_start = now_ns();
+  if (need_reload_ui) {
+    /* Timed as the frame's draw, main.c skips drawing for it too */
+    ui_set_choice(sf_ui[0]);
+  } else {
+    draw();
+    const pvr_soft_stats *stats = pvr_soft_get_stats();
+    for (int i = 0; i < PVR_SOFT_LISTS; i++) {
+      res->headers += stats->lists[i].headers;
+      res->verts += stats->lists[i].verts;
+    }
+    res->txr_loads = stats->txr_loads;
+    res->txr_bytes = stats->txr_bytes;
+  }
+  const uint64_t end = now_ns();
+  res->input_ns = draw_start - input_start;
+  res->draw_ns = end - draw_start;
+
+  PROF_FRAME_END();
+#if PROFILER
+  const prof_frame *prof = prof_get_frame(0);
+  res->txr_hit = prof->counter[PROF_TXR_HIT];
+  res->txr_miss = prof->counter[PROF_TXR_MISS] + prof->counter[PROF_TXR_MISSING];
+#endif
+}
+
+static int cmp_u64(const void *a, const void *b) {
+  const uint64_t va = *(const uint64_t *)a;
+  const uint64_t vb = *(const uint64_t *)b;
+  return (va > vb) - (va < vb);
+}
+
+static void write_csv(FILE *out, const frame_result *res, uint32_t num) {
+  fprintf(out, "frame,control,input_us,draw_us,headers,verts,txr_loads,txr_bytes%s\n",
+          PROFILER ? ",txr_hit,txr_miss" : "");
+  for (uint32_t i = 0; i < num; i++) {
+    fprintf(out, "%u,%d,%.1f,%.1f,%u,%u,%u,%u", i, res[i].control, res[i].input_ns / 1e3, res[i].draw_ns / 1e3,
+            res[i].headers, res[i].verts, res[i].txr_loads, res[i].txr_bytes);
+    if (PROFILER) {
+      fprintf(out, ",%u,%u", res[i].txr_hit, res[i].txr_miss);
+    }
+    fprintf(out, "\n");
+  }
+}
+
+static int write_summary(FILE *out, const char *ui, const frame_result *res, uint32_t num) {
+  uint64_t *frame_ns = malloc(num * sizeof(uint64_t));
+  if (!frame_ns) {
+    fprintf(stderr, "%s no free memory\n", __func__);
+    return -1;
+  }
+
+  uint64_t input_ns = 0, draw_ns = 0, verts = 0, headers = 0, txr_bytes = 0;
+  uint32_t worst = 0, max_verts = 0, txr_loads = 0, txr_frames = 0, txr_worst = 0, txr_hit = 0, txr_miss = 0;
+  for (uint32_t i = 0; i < num; i++) {
+    frame_ns[i] = res[i].input_ns + res[i].draw_ns;
+    if (frame_ns[i] > frame_ns[worst]) {
+      worst = i;
+    }
+    input_ns += res[i].input_ns;
+    draw_ns += res[i].draw_ns;
+    headers += res[i].headers;
+    verts += res[i].verts;
+    if (res[i].verts > max_verts) {
+      max_verts = res[i].verts;
+    }
+    txr_loads += res[i].txr_loads;
+    txr_bytes += res[i].txr_bytes;
+    txr_frames += !!res[i].txr_loads;
+    if (res[i].txr_loads > res[txr_worst].txr_loads) {
+      txr_worst = i;
+    }
+    txr_hit += res[i].txr_hit;
+    txr_miss += res[i].txr_miss;
+  }
+  const uint64_t worst_ns = frame_ns[worst];
+  qsort(frame_ns, num, sizeof(uint64_t), cmp_u64);
+
+  fprintf(out, "ui %s, %d games, %u frames%s%s\n", ui, list_length(), num, session_end ? ", ended by " : "",
+          session_end ? session_end : "");
+  fprintf(out, "frame us: median %.1f, p99 %.1f, worst %.1f (frame %u)\n", frame_ns[num / 2] / 1e3,
+          frame_ns[(num * 99) / 100] / 1e3, worst_ns / 1e3, worst);
+  fprintf(out, "  average input %.1f, draw %.1f\n", input_ns / 1e3 / num, draw_ns / 1e3 / num);
+  fprintf(out, "TA a frame: %.1f headers, %.1f verts, %u verts worst\n", (double)headers / num,
+          (double)verts / num, max_verts);
+  fprintf(out, "texture uploads: %u (%llu bytes) over %u frames, %u at most (frame %u)\n", txr_loads,
+          (unsigned long long)txr_bytes, txr_frames, res[txr_worst].txr_loads, txr_worst);
+  if (PROFILER) {
+    fprintf(out, "art cache: %u hits, %u misses\n", txr_hit, txr_miss);
+  }
+  free(frame_ns);
+  return 0;
+}
+
+static void print_usage(const char *prog) {
+  fprintf(stderr, "Usage: %s [-u UI] [-n FRAMES] [-c CSV] [-s OUT.png] [-v] CARD_DIR SCRIPT\n", prog);
+}
+
+int main(int argc, char **argv) {
+  const char *ui_arg = NULL;
+  const char *csv = NULL;
+  const char *shot = NULL;
+  const char *card = NULL;
+  const char *script_path = NULL;
+  long frames_arg = 0;
+  int verbose = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-u") && i + 1 < argc) {
+      ui_arg = argv[++i];
+    } else if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      frames_arg = atol(argv[++i]);
+    } else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+      csv = argv[++i];
+    } else if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      shot = argv[++i];
+    } else if (!strcmp(argv[i], "-v")) {
+      verbose = 1;
+    } else if (argv[i][0] != '-' && !card) {
+      card = argv[i];
+    } else if (argv[i][0] != '-' && !script_path) {
+      script_path = argv[i];
+    } else {
+      print_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  const int ui = ui_arg ? ui_parse(ui_arg) : -1;
+  if (!card || !script_path || (ui_arg && ui < 0) || frames_arg < 0) {
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  /* Everything named relative to where we started is opened before entering the card */
+  input_script script;
+  if (input_script_load(&script, script_path)) {
+    fprintf(stderr, "Err: cant load %s!\n", script_path);
+    return EXIT_FAILURE;
+  }
+  const uint32_t frames = frames_arg ? (uint32_t)frames_arg : script.length;
+  if (!frames) {
+    fprintf(stderr, "Err: %s has no frames, give -n!\n", script_path);
+    return EXIT_FAILURE;
+  }
+  FILE *out = fdopen(dup(STDOUT_FILENO), "w");
+  FILE *csv_out = csv ? fopen(csv, "w") : NULL;
+  char shot_path[FILENAME_MAX] = {0};
+  if (shot && shot[0] != '/') {
+    if (!getcwd(shot_path, sizeof(shot_path))) {
+      shot_path[0] = '\0';
+    }
+    strncat(shot_path, "/", sizeof(shot_path) - strlen(shot_path) - 1);
+  }
+  if (shot) {
+    strncat(shot_path, shot, sizeof(shot_path) - strlen(shot_path) - 1);
+  }
+  if (!out || (csv && !csv_out)) {
+    fprintf(stderr, "Err: cant write %s!\n", csv ? csv : "stdout");
+    return EXIT_FAILURE;
+  }
+  if (chdir(card)) {
+    fprintf(stderr, "Err: cant enter %s!\n", card);
+    return EXIT_FAILURE;
+  }
+  om_file_set_cd_root(".");
+  if (!verbose) {
+    const int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd != -1) {
+      fflush(stdout);
+      dup2(null_fd, STDOUT_FILENO);
+      close(null_fd);
+    }
+  }
+
+  frame_result *results = calloc(frames, sizeof(frame_result));
+  if (!results || boot(ui)) {
+    return EXIT_FAILURE;
+  }
+
+  uint32_t ran = 0;
+  while (ran < frames && !session_end) {
+    run_frame(&script, ran, &results[ran]);
+    ran++;
+  }
+
+  if (csv_out) {
+    write_csv(csv_out, results, ran);
+    fclose(csv_out);
+  }
+  if (write_summary(out, ui_names[current_ui - ui_choices], results, ran)) {
+    return EXIT_FAILURE;
+  }
+
+  /* One more untimed frame, rasterized */
+  if (shot) {
+    pvr_soft_set_render(1);
+    draw();
+    if (pvr_soft_write_frame(shot_path)) {
+      fprintf(stderr, "Err: cant write %s!\n", shot);
+      return EXIT_FAILURE;
+    }
+    fprintf(out, "wrote %s\n", shot);
+  }
+  fclose(out);
+  input_script_free(&script);
+  free(results);
+  return EXIT_SUCCESS;
+}